@@ -421,10 +421,20 @@ LOCAL_SRC_FILES := \
     src/cometbuster_spawn.cpp \
     src/cometbuster_init.cpp \
     src/cometbuster_physics.cpp \
+    src/cometbuster_jobs.cpp \
+    src/cometbuster_fastmath.cpp \
+    src/cometbuster_simd.cpp \
+    src/comet_sim_thread.cpp \
+    src/comet_frame_scheduler.cpp \
+    src/cometbuster_patterns.cpp \
+    src/comet_replay.cpp \
     src/cometbuster_collision.cpp \
     src/cometbuster_boss.cpp \
     src/cometbuster_starboss.cpp \
     src/cometbuster_render_gl.cpp \
+    src/cometbuster_render_gl_stream.cpp \
+    src/cometbuster_drawlist.cpp \
+    src/cometbuster_quality.cpp \
     src/cometbuster_util.cpp \
     src/cometbuster_splashscreen.cpp \
     src/joystick.cpp \
@@ -459,6 +469,12 @@ LOCAL_LDLIBS := -llog -lGLESv2 -lz -landroid
 include $(BUILD_SHARED_LIBRARY)
 EOF
 
+# float32 entity state (sim_real in cometbuster.h): SIM_FLOAT32=1 ./build_android.sh
+if [ -n "$SIM_FLOAT32" ]; then
+    sed -i 's/^LOCAL_CFLAGS := -DExternalSound -DANDROID$/& -DSIM_FLOAT32/' android/app/src/jni/Android.mk
+    echo "Building with float32 simulation state"
+fi
+
 echo -e "${GREEN}✓ NDK build files created${NC}"
 
 echo -e "${YELLOW}Step 8: Creating OpenGL stubs...${NC}"
@@ -0,0 +1,676 @@
+#include <SDL2/SDL.h>
+#include <GL/glew.h>
+#include <GL/gl.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#ifdef CAIROBUILD
+#include <cairo.h>
+#endif
+
+#include "cometbuster.h"
+#include "visualization.h"
+#include "cometbuster_drawlist.h"
+#include "cometbuster_render_gl.h"
+#include "cometbuster_jobs.h"
+#include "cometbuster_quality.h"
+#include "comet_replay.h"
+
+// ============================================================
+// HEADLESS RENDER BENCHMARK
+// ============================================================
+// Steps the game over fixed synthetic scenes (or a recorded replay)
+// and draws every frame offscreen with both renderers:
+//
+//   GL     EGL surfaceless context (Mesa llvmpipe on a GPU-less box)
+//          drawing into a 1920x1080 framebuffer object
+//   Cairo  a 1920x1080 image surface (CAIROBUILD builds only)
+//
+// For each scene it reports the average CPU time of every pipeline
+// stage (not render passes - a stage is one step of producing a frame),
+// the GL draw calls, stream uploads and uploaded bytes per frame,
+// and an FNV-1a hash of every frame. A per-field breakdown of the
+// simulation state's size comes first. --write-hashes stores the
+// hashes; --check-hashes compares against a stored file and exits
+// with 1 on any difference, so CI can catch visual regressions:
+//
+//   ./cometbuster_bench --write-hashes bench.hashes
+//   ./cometbuster_bench --check-hashes bench.hashes --dump-dir diff/
+//
+// Hashes are only comparable between runs with the same Mesa,
+// Cairo and FreeType versions - regenerate the file when the CI
+// image changes. Worker threads are disabled so rand() is called in
+// the same order on every run, GPU particles so both renderers draw
+// the same debris.
+// ============================================================
+
+#define BENCH_WIDTH 1920
+#define BENCH_HEIGHT 1080
+#define BENCH_DT (1.0 / 60.0)
+#define BENCH_SEED 20240601u
+#define BENCH_DEFAULT_FRAMES 60
+
+typedef enum {
+    BENCH_STAGE_BUILD = 0,      // drawlist_build_game
+    BENCH_STAGE_GL_SUBMIT,      // draw_comet_buster_gl_list (batching, mid-frame flushes)
+    BENCH_STAGE_GL_FLUSH,       // gl_end_frame (final upload and draws)
+    BENCH_STAGE_GL_FINISH,      // glFinish - rasterisation on llvmpipe
+    BENCH_STAGE_GL_READBACK,    // glReadPixels + hash
+    BENCH_STAGE_CAIRO_DRAW,     // draw_comet_buster
+    BENCH_STAGE_CAIRO_HASH,
+    BENCH_STAGE_COUNT
+} BenchStage;
+
+static const char *bench_stage_names[BENCH_STAGE_COUNT] = {
+    "build", "gl submit", "gl flush", "gl finish", "gl readback", "cairo draw", "cairo hash"
+};
+
+typedef struct {
+    const char *name;
+    bool splash;            // Stay on the opening crawl
+    int warmup_steps;       // Simulation steps before the first drawn frame
+    bool crowd;             // Fill every entity pool - the worst case for the renderers
+} BenchScene;
+
+static const BenchScene bench_scenes[] = {
+    { "splash", true,  120, false },
+    { "wave",   false, 300, false },
+    { "crowd",  false, 60,  true  },
+};
+#define BENCH_SCENE_COUNT ((int)(sizeof(bench_scenes) / sizeof(bench_scenes[0])))
+
+typedef struct {
+    int frames;
+    double seconds[BENCH_STAGE_COUNT];
+    long long draw_calls;
+    long long uploads;
+    long long upload_bytes;
+    long long commands;         // Draw list commands
+} BenchTotals;
+
+typedef struct {
+    char key[64];               // "<backend> <scene> <frame>"
+    unsigned long long hash;
+    bool seen;
+} BenchHash;
+
+typedef struct {
+    int frames;
+    const char *scene;          // NULL = all
+    const char *replay_path;
+    const char *write_path;
+    const char *check_path;
+    const char *dump_dir;
+    bool gl;
+    bool cairo;
+
+    std::vector<BenchHash> expected;
+    std::vector<BenchHash> written;
+    int mismatches;
+    int missing;
+} BenchOptions;
+
+// ============================================================
+// TIMING AND HASHING
+// ============================================================
+
+static double bench_seconds_since(Uint64 start) {
+    return (double)(SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+}
+
+// FNV-1a over 'rows' rows of 'row_bytes', skipping any stride padding
+static unsigned long long bench_hash_pixels(const unsigned char *pixels, int rows, int row_bytes, int stride) {
+    unsigned long long hash = 14695981039346656037ULL;
+    for (int y = 0; y < rows; y++) {
+        const unsigned char *row = pixels + (size_t)y * stride;
+        for (int x = 0; x < row_bytes; x++) {
+            hash ^= row[x];
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+static void bench_write_ppm(const char *path, const unsigned char *pixels, int width, int height,
+                            int stride, bool bottom_up, bool bgra) {
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        SDL_Log("[Comet Busters] [BENCH] Could not write %s\n", path);
+        return;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    std::vector<unsigned char> rgb(width * 3);
+    for (int y = 0; y < height; y++) {
+        const unsigned char *row = pixels + (size_t)(bottom_up ? height - 1 - y : y) * stride;
+        for (int x = 0; x < width; x++) {
+            const unsigned char *p = row + x * 4;
+            rgb[x * 3 + 0] = bgra ? p[2] : p[0];
+            rgb[x * 3 + 1] = p[1];
+            rgb[x * 3 + 2] = bgra ? p[0] : p[2];
+        }
+        fwrite(rgb.data(), 1, rgb.size(), f);
+    }
+    fclose(f);
+}
+
+static bool bench_load_hashes(BenchOptions *opts, const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        SDL_Log("[Comet Busters] [BENCH] Could not open hash file %s\n", path);
+        return false;
+    }
+    char backend[16], scene[32];
+    int frame;
+    unsigned long long hash;
+    while (fscanf(f, "%15s %31s %d %llx", backend, scene, &frame, &hash) == 4) {
+        BenchHash entry;
+        memset(&entry, 0, sizeof(entry));
+        snprintf(entry.key, sizeof(entry.key), "%s %s %d", backend, scene, frame);
+        entry.hash = hash;
+        opts->expected.push_back(entry);
+    }
+    fclose(f);
+    SDL_Log("[Comet Busters] [BENCH] Loaded %d frame hashes from %s\n", (int)opts->expected.size(), path);
+    return true;
+}
+
+// Record a frame hash and compare it with the expected one. Returns
+// false on a mismatch so the caller can dump the frame.
+static bool bench_record_hash(BenchOptions *opts, const char *backend, const char *scene,
+                              int frame, unsigned long long hash) {
+    BenchHash entry;
+    memset(&entry, 0, sizeof(entry));
+    snprintf(entry.key, sizeof(entry.key), "%s %s %d", backend, scene, frame);
+    entry.hash = hash;
+    opts->written.push_back(entry);
+
+    if (!opts->check_path) return true;
+
+    for (size_t i = 0; i < opts->expected.size(); i++) {
+        BenchHash *expected = &opts->expected[i];
+        if (strcmp(expected->key, entry.key) != 0) continue;
+        expected->seen = true;
+        if (expected->hash == hash) return true;
+
+        if (opts->mismatches == 0) {
+            SDL_Log("[Comet Busters] [BENCH] FIRST MISMATCH: %s (expected %016llx, got %016llx)\n",
+                    entry.key, expected->hash, hash);
+        }
+        opts->mismatches++;
+        return false;
+    }
+
+    opts->missing++;
+    return true;
+}
+
+static void bench_dump_path(char *path, size_t size, const BenchOptions *opts,
+                            const char *backend, const char *scene, int frame) {
+    snprintf(path, size, "%s/%s-%s-%04d.ppm", opts->dump_dir, backend, scene, frame);
+}
+
+// ============================================================
+// GL BACKEND (EGL SURFACELESS)
+// ============================================================
+
+static struct {
+    EGLDisplay display;
+    EGLContext context;
+    GLuint fbo;
+    GLuint color_rb;
+    GLuint depth_rb;
+    std::vector<unsigned char> pixels;
+} g_bench_gl;
+
+static bool bench_gl_init(void) {
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    g_bench_gl.display = EGL_NO_DISPLAY;
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+    if (get_platform_display) {
+        g_bench_gl.display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    }
+#endif
+    if (g_bench_gl.display == EGL_NO_DISPLAY) {
+        g_bench_gl.display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+
+    EGLint major = 0, minor = 0;
+    if (g_bench_gl.display == EGL_NO_DISPLAY || !eglInitialize(g_bench_gl.display, &major, &minor)) {
+        SDL_Log("[Comet Busters] [BENCH] eglInitialize failed (0x%x)\n", eglGetError());
+        return false;
+    }
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        SDL_Log("[Comet Busters] [BENCH] EGL has no desktop OpenGL\n");
+        return false;
+    }
+
+    const EGLint config_attribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config = NULL;
+    EGLint config_count = 0;
+    eglChooseConfig(g_bench_gl.display, config_attribs, &config, 1, &config_count);
+
+    // Same context the SDL front-end asks for
+    const EGLint context_attribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+        EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+        EGL_NONE
+    };
+    g_bench_gl.context = eglCreateContext(g_bench_gl.display, config_count ? config : NULL,
+                                          EGL_NO_CONTEXT, context_attribs);
+    if (g_bench_gl.context == EGL_NO_CONTEXT ||
+        !eglMakeCurrent(g_bench_gl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, g_bench_gl.context)) {
+        SDL_Log("[Comet Busters] [BENCH] Could not create a surfaceless GL 3.3 context (0x%x)\n", eglGetError());
+        return false;
+    }
+
+    // GLX builds of GLEW report the missing X display after they have
+    // loaded every entry point - harmless here
+    glewExperimental = GL_TRUE;
+    GLenum err = glewInit();
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    if (err == GLEW_ERROR_NO_GLX_DISPLAY) err = GLEW_OK;
+#endif
+    if (err != GLEW_OK) {
+        SDL_Log("[Comet Busters] [BENCH] glewInit: %s\n", glewGetErrorString(err));
+        return false;
+    }
+
+    SDL_Log("[Comet Busters] [BENCH] EGL %d.%d, %s / %s\n", major, minor,
+            (const char*)glGetString(GL_RENDERER), (const char*)glGetString(GL_VERSION));
+
+    glGenRenderbuffers(1, &g_bench_gl.color_rb);
+    glBindRenderbuffer(GL_RENDERBUFFER, g_bench_gl.color_rb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, BENCH_WIDTH, BENCH_HEIGHT);
+    glGenRenderbuffers(1, &g_bench_gl.depth_rb);
+    glBindRenderbuffer(GL_RENDERBUFFER, g_bench_gl.depth_rb);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, BENCH_WIDTH, BENCH_HEIGHT);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &g_bench_gl.fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, g_bench_gl.fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, g_bench_gl.color_rb);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, g_bench_gl.depth_rb);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        SDL_Log("[Comet Busters] [BENCH] Offscreen framebuffer incomplete\n");
+        return false;
+    }
+
+    g_bench_gl.pixels.resize((size_t)BENCH_WIDTH * BENCH_HEIGHT * 4);
+
+    // CPU particles, so the Cairo frames (which have no GPU debris) show
+    // the same explosions
+    gl_set_gpu_particles_allowed(false);
+    return true;
+}
+
+static void bench_gl_shutdown(void) {
+    if (g_bench_gl.context == EGL_NO_CONTEXT) return;
+    glDeleteFramebuffers(1, &g_bench_gl.fbo);
+    glDeleteRenderbuffers(1, &g_bench_gl.color_rb);
+    glDeleteRenderbuffers(1, &g_bench_gl.depth_rb);
+    eglMakeCurrent(g_bench_gl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(g_bench_gl.display, g_bench_gl.context);
+    eglTerminate(g_bench_gl.display);
+}
+
+static void bench_gl_frame(BenchOptions *opts, Visualizer *vis, const char *scene, int frame,
+                           BenchTotals *totals) {
+    static DrawList list;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, g_bench_gl.fbo);
+    glViewport(0, 0, BENCH_WIDTH, BENCH_HEIGHT);
+    glClearColor(0.05f, 0.075f, 0.15f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // draw_comet_buster_gl(), split so the list build is timed on its own
+    Uint64 start = SDL_GetPerformanceCounter();
+    drawlist_build_game(&list, &vis->comet_buster, vis->width, vis->height);
+    totals->seconds[BENCH_STAGE_BUILD] += bench_seconds_since(start);
+    totals->commands += (long long)list.cmds.size();
+
+    start = SDL_GetPerformanceCounter();
+    draw_comet_buster_gl_list(vis, &list);
+    totals->seconds[BENCH_STAGE_GL_SUBMIT] += bench_seconds_since(start);
+
+    start = SDL_GetPerformanceCounter();
+    gl_end_frame();
+    totals->seconds[BENCH_STAGE_GL_FLUSH] += bench_seconds_since(start);
+
+    start = SDL_GetPerformanceCounter();
+    glFinish();
+    totals->seconds[BENCH_STAGE_GL_FINISH] += bench_seconds_since(start);
+
+    start = SDL_GetPerformanceCounter();
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, BENCH_WIDTH, BENCH_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, g_bench_gl.pixels.data());
+    unsigned long long hash = bench_hash_pixels(g_bench_gl.pixels.data(), BENCH_HEIGHT,
+                                                BENCH_WIDTH * 4, BENCH_WIDTH * 4);
+    totals->seconds[BENCH_STAGE_GL_READBACK] += bench_seconds_since(start);
+
+    GLFrameStats stats;
+    gl_get_frame_stats(&stats);
+    totals->draw_calls += stats.draw_calls;
+    totals->uploads += stats.uploads;
+    totals->upload_bytes += stats.upload_bytes;
+
+    if (!bench_record_hash(opts, "gl", scene, frame, hash) && opts->dump_dir) {
+        char path[512];
+        bench_dump_path(path, sizeof(path), opts, "gl", scene, frame);
+        bench_write_ppm(path, g_bench_gl.pixels.data(), BENCH_WIDTH, BENCH_HEIGHT,
+                        BENCH_WIDTH * 4, true, false);
+    }
+}
+
+// ============================================================
+// CAIRO BACKEND (IMAGE SURFACE)
+// ============================================================
+
+#ifdef CAIROBUILD
+static cairo_surface_t *g_bench_surface = NULL;
+
+static void bench_cairo_frame(BenchOptions *opts, Visualizer *vis, const char *scene, int frame,
+                              BenchTotals *totals) {
+    if (!g_bench_surface) {
+        g_bench_surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, BENCH_WIDTH, BENCH_HEIGHT);
+    }
+
+    cairo_t *cr = cairo_create(g_bench_surface);
+    cairo_set_operator(cr, CAIRO_OPERATOR_CLEAR);
+    cairo_paint(cr);
+    cairo_set_operator(cr, CAIRO_OPERATOR_OVER);
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    draw_comet_buster(vis, cr);
+    cairo_surface_flush(g_bench_surface);
+    totals->seconds[BENCH_STAGE_CAIRO_DRAW] += bench_seconds_since(start);
+    cairo_destroy(cr);
+
+    start = SDL_GetPerformanceCounter();
+    const unsigned char *pixels = cairo_image_surface_get_data(g_bench_surface);
+    int stride = cairo_image_surface_get_stride(g_bench_surface);
+    unsigned long long hash = bench_hash_pixels(pixels, BENCH_HEIGHT, BENCH_WIDTH * 4, stride);
+    totals->seconds[BENCH_STAGE_CAIRO_HASH] += bench_seconds_since(start);
+
+    if (!bench_record_hash(opts, "cairo", scene, frame, hash) && opts->dump_dir) {
+        char path[512];
+        bench_dump_path(path, sizeof(path), opts, "cairo", scene, frame);
+        // ARGB32 is a native-endian word: B, G, R, A in memory on x86
+        bench_write_ppm(path, pixels, BENCH_WIDTH, BENCH_HEIGHT, stride, false, true);
+    }
+}
+#endif
+
+// ============================================================
+// GAME STATES
+// ============================================================
+
+static void bench_reset(Visualizer *vis, bool splash) {
+    memset(vis, 0, sizeof(Visualizer));
+    vis->width = BENCH_WIDTH;
+    vis->height = BENCH_HEIGHT;
+    vis->mouse_x = BENCH_WIDTH / 2;
+    vis->mouse_y = BENCH_HEIGHT / 2;
+
+    vis->comet_buster.splash_screen_active = splash;
+    comet_buster_reset_game_with_splash(&vis->comet_buster, splash, MEDIUM);
+
+    // update_comet_buster() only centres the ship on its very first call
+    vis->comet_buster.ship_x = BENCH_WIDTH / 2.0;
+    vis->comet_buster.ship_y = BENCH_HEIGHT / 2.0;
+}
+
+// Scripted input: circle the mouse around the ship with the gun held
+// down, and keep the ship alive so every run draws the same kind of
+// frame
+static void bench_step(Visualizer *vis, const BenchScene *scene, int step) {
+    CometBusterGame *game = &vis->comet_buster;
+
+    if (!scene->splash) {
+        double angle = step * 0.02;
+        vis->mouse_x = (int)(BENCH_WIDTH / 2 + cos(angle) * 300.0);
+        vis->mouse_y = (int)(BENCH_HEIGHT / 2 + sin(angle) * 300.0);
+        vis->mouse_left_pressed = true;
+        game->invulnerability_time = 1.0;
+        game->ship_lives = 3;
+    }
+
+    if (scene->crowd) {
+        if (game->comet_count < MAX_COMETS) {
+            comet_buster_spawn_random_comets(game, MAX_COMETS - game->comet_count, BENCH_WIDTH, BENCH_HEIGHT);
+        }
+        if (game->enemy_ship_count < MAX_ENEMY_SHIPS) {
+            comet_buster_spawn_enemy_ship(game, BENCH_WIDTH, BENCH_HEIGHT);
+        }
+        if (game->ufo_count < MAX_UFOS) {
+            comet_buster_spawn_ufo(game, BENCH_WIDTH, BENCH_HEIGHT);
+        }
+        if (step % 10 == 0) {
+            comet_buster_spawn_explosion(game, rand() % BENCH_WIDTH, rand() % BENCH_HEIGHT,
+                                         rand() % 3, 60);
+        }
+    }
+
+    update_comet_buster(vis, BENCH_DT);
+    vis->scroll_direction = 0;
+}
+
+static void bench_render(BenchOptions *opts, Visualizer *vis, const char *scene, int frame,
+                         BenchTotals *gl_totals, BenchTotals *cairo_totals) {
+    if (opts->gl) {
+        bench_gl_frame(opts, vis, scene, frame, gl_totals);
+        gl_totals->frames++;
+    }
+#ifdef CAIROBUILD
+    if (opts->cairo) {
+        bench_cairo_frame(opts, vis, scene, frame, cairo_totals);
+        cairo_totals->frames++;
+    }
+#else
+    (void)cairo_totals;
+#endif
+}
+
+static void bench_report(const char *scene, const char *backend, const BenchTotals *totals) {
+    if (totals->frames == 0) return;
+
+    double frames = (double)totals->frames;
+    printf("%-8s %-6s %4d frames", scene, backend, totals->frames);
+    for (int p = 0; p < BENCH_STAGE_COUNT; p++) {
+        if (totals->seconds[p] == 0.0) continue;
+        printf("  %s %.3f ms", bench_stage_names[p], totals->seconds[p] * 1000.0 / frames);
+    }
+    if (totals->commands) {
+        printf("  %.0f cmds", totals->commands / frames);
+    }
+    if (totals->draw_calls) {
+        printf("  %.1f draw calls  %.1f uploads  %.1f KB",
+               totals->draw_calls / frames, totals->uploads / frames,
+               totals->upload_bytes / 1024.0 / frames);
+    }
+    printf("\n");
+}
+
+static void bench_run_scene(BenchOptions *opts, const BenchScene *scene) {
+    static Visualizer vis;
+    BenchTotals gl_totals, cairo_totals;
+    memset(&gl_totals, 0, sizeof(gl_totals));
+    memset(&cairo_totals, 0, sizeof(cairo_totals));
+
+    srand(BENCH_SEED);
+    bench_reset(&vis, scene->splash);
+
+    int step = 0;
+    for (; step < scene->warmup_steps; step++) {
+        bench_step(&vis, scene, step);
+    }
+    for (int frame = 0; frame < opts->frames; frame++, step++) {
+        bench_step(&vis, scene, step);
+        bench_render(opts, &vis, scene->name, frame, &gl_totals, &cairo_totals);
+    }
+
+    bench_report(scene->name, "gl", &gl_totals);
+    bench_report(scene->name, "cairo", &cairo_totals);
+}
+
+// Same stepping as the SDL front-end's --check-replay run, drawing
+// every step until the recording ends or 'frames' is reached
+static void bench_run_replay(BenchOptions *opts) {
+    static Visualizer vis;
+    static ReplaySession replay;
+    BenchTotals gl_totals, cairo_totals;
+    memset(&gl_totals, 0, sizeof(gl_totals));
+    memset(&cairo_totals, 0, sizeof(cairo_totals));
+
+    // Seeds rand() with the recording's seed. Recordings start on the
+    // splash screen, like a normal launch.
+    memset(&replay, 0, sizeof(replay));
+    if (!replay_start_check(&replay, opts->replay_path)) {
+        opts->mismatches++;
+        return;
+    }
+    bench_reset(&vis, true);
+
+    for (int frame = 0; frame < opts->frames; frame++) {
+        double dt = BENCH_DT;
+        replay_before_step(&replay, &vis, &dt);
+        if (replay.finished) break;
+        update_comet_buster(&vis, dt);
+        replay_after_step(&replay, &vis);
+        vis.scroll_direction = 0;
+
+        bench_render(opts, &vis, "replay", frame, &gl_totals, &cairo_totals);
+    }
+    replay_finish(&replay);
+
+    bench_report("replay", "gl", &gl_totals);
+    bench_report("replay", "cairo", &cairo_totals);
+}
+
+// ============================================================
+// MAIN
+// ============================================================
+
+static void bench_usage(void) {
+    printf("Usage: cometbuster_bench [options]\n"
+           "  --frames N           Frames drawn per scene (default %d; replays: all)\n"
+           "  --scene NAME         Only run one scene (splash, wave, crowd)\n"
+           "  --replay FILE        Draw a --record-replay recording instead of the scenes\n"
+           "  --gl-only            Skip the Cairo renderer\n"
+           "  --cairo-only         Skip the GL renderer\n"
+           "  --write-hashes FILE  Store every frame hash\n"
+           "  --check-hashes FILE  Compare frame hashes, exit 1 on any difference\n"
+           "  --dump-dir DIR       Write mismatching frames as PPM images\n",
+           BENCH_DEFAULT_FRAMES);
+}
+
+int main(int argc, char *argv[]) {
+    static BenchOptions opts;
+    opts.frames = -1;
+    opts.gl = true;
+#ifdef CAIROBUILD
+    opts.cairo = true;
+#endif
+
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--frames") == 0 && has_value) {
+            opts.frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--scene") == 0 && has_value) {
+            opts.scene = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && has_value) {
+            opts.replay_path = argv[++i];
+        } else if (strcmp(argv[i], "--write-hashes") == 0 && has_value) {
+            opts.write_path = argv[++i];
+        } else if (strcmp(argv[i], "--check-hashes") == 0 && has_value) {
+            opts.check_path = argv[++i];
+        } else if (strcmp(argv[i], "--dump-dir") == 0 && has_value) {
+            opts.dump_dir = argv[++i];
+        } else if (strcmp(argv[i], "--gl-only") == 0) {
+            opts.cairo = false;
+        } else if (strcmp(argv[i], "--cairo-only") == 0) {
+            opts.gl = false;
+        } else {
+            bench_usage();
+            return strcmp(argv[i], "--help") == 0 ? 0 : 2;
+        }
+    }
+    if (opts.frames < 0) {
+        opts.frames = opts.replay_path ? 1 << 30 : BENCH_DEFAULT_FRAMES;
+    }
+    if (!opts.gl && !opts.cairo) {
+        SDL_Log("[Comet Busters] [BENCH] No renderer selected (Cairo needs a CAIROBUILD build)\n");
+        return 2;
+    }
+    if (opts.check_path && !bench_load_hashes(&opts, opts.check_path)) {
+        return 2;
+    }
+
+    // Frame hashes compare the same work every run: top quality, no governor
+    job_system_init(JOB_WORKERS_NONE);
+    quality_governor_set_enabled(false);
+    if (opts.gl && !bench_gl_init()) {
+        return 2;
+    }
+
+    // Memory the scenes walk: the simulation state, field by field
+    comet_buster_log_state_sizes();
+
+    if (opts.replay_path) {
+        bench_run_replay(&opts);
+    } else {
+        bool ran = false;
+        for (int i = 0; i < BENCH_SCENE_COUNT; i++) {
+            if (opts.scene && strcmp(opts.scene, bench_scenes[i].name) != 0) continue;
+            bench_run_scene(&opts, &bench_scenes[i]);
+            ran = true;
+        }
+        if (!ran) {
+            SDL_Log("[Comet Busters] [BENCH] Unknown scene '%s'\n", opts.scene);
+            return 2;
+        }
+    }
+
+    if (opts.write_path) {
+        FILE *f = fopen(opts.write_path, "w");
+        if (!f) {
+            SDL_Log("[Comet Busters] [BENCH] Could not write %s\n", opts.write_path);
+            return 2;
+        }
+        for (size_t i = 0; i < opts.written.size(); i++) {
+            fprintf(f, "%s %016llx\n", opts.written[i].key, opts.written[i].hash);
+        }
+        fclose(f);
+        SDL_Log("[Comet Busters] [BENCH] Wrote %d frame hashes to %s\n", (int)opts.written.size(), opts.write_path);
+    }
+
+    int result = 0;
+    if (opts.check_path) {
+        // Stored frames this run did not draw
+        for (size_t i = 0; i < opts.expected.size(); i++) {
+            if (!opts.expected[i].seen) opts.missing++;
+        }
+        if (opts.mismatches == 0) {
+            SDL_Log("[Comet Busters] [BENCH] PASS: %d frames match%s\n", (int)opts.written.size(),
+                    opts.missing ? " (some frames are only in one run - see --frames/--scene)" : "");
+        } else {
+            SDL_Log("[Comet Busters] [BENCH] FAIL: %d of %d frames differ\n",
+                    opts.mismatches, (int)opts.written.size());
+            result = 1;
+        }
+    }
+
+    bench_gl_shutdown();
+#ifdef CAIROBUILD
+    draw_comet_buster_cleanup();
+    if (g_bench_surface) cairo_surface_destroy(g_bench_surface);
+#endif
+    job_system_shutdown();
+    return result;
+}
@@ -0,0 +1,206 @@
+#include <stdio.h>
+#include <string.h>
+#ifndef _WIN32
+#include <time.h>
+#endif
+#include "comet_frame_scheduler.h"
+
+#define FRAME_SCHED_SPIN_US 500         // Sleeps overshoot - spin the last half millisecond
+#define FRAME_SCHED_BAR_WIDTH 40        // Longest histogram bar in the exit log
+
+// ============================================================================
+// CLOCK
+// ============================================================================
+
+void frame_sched_sleep_until(Uint64 deadline) {
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    Uint64 spin = freq * FRAME_SCHED_SPIN_US / 1000000;
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    while (now < deadline) {
+        Uint64 left = deadline - now;
+        if (left > spin) {
+            double seconds = (double)(left - spin) / (double)freq;
+#ifdef _WIN32
+            // Whole milliseconds at best; the spin below covers the rest
+            Uint32 ms = (Uint32)(seconds * 1000.0);
+            SDL_Delay(ms > 1 ? ms - 1 : 0);
+#else
+            struct timespec ts;
+            ts.tv_sec = (time_t)seconds;
+            ts.tv_nsec = (long)((seconds - (double)ts.tv_sec) * 1e9);
+            nanosleep(&ts, NULL);
+#endif
+        }
+        now = SDL_GetPerformanceCounter();
+    }
+}
+
+// ============================================================================
+// PACING
+// ============================================================================
+
+void frame_sched_init(FrameScheduler *sched, int target_fps, bool vsync, int refresh_hz) {
+    memset(sched, 0, sizeof(FrameScheduler));
+    sched->target_fps = target_fps > 0 ? target_fps : 0;
+    sched->vsync = vsync;
+    sched->refresh_hz = refresh_hz > 0 ? refresh_hz : 0;
+    frame_sched_set_clock(sched, SDL_GetPerformanceFrequency());
+
+    SDL_Log("[Comet Busters] [FRAME] Target %d fps%s, vsync %s, display %d Hz%s\n",
+            sched->target_fps, sched->target_fps ? "" : " (uncapped)",
+            vsync ? "ON" : "OFF", sched->refresh_hz, sched->refresh_hz ? "" : " (unknown)");
+}
+
+void frame_sched_set_clock(FrameScheduler *sched, Uint64 ticks_per_second) {
+    sched->freq = ticks_per_second;
+    sched->period = sched->target_fps ? ticks_per_second / sched->target_fps : 0;
+    sched->next_deadline = 0;
+    sched->last_frame = 0;
+    sched->fps_window_start = 0;
+    sched->fps_frames = 0;
+}
+
+static void frame_sched_record(FrameScheduler *sched, double interval) {
+    int bucket = (int)(interval * 1e6 / FRAME_SCHED_BUCKET_US);
+    if (bucket >= FRAME_SCHED_BUCKETS) bucket = FRAME_SCHED_BUCKETS - 1;
+    sched->histogram[bucket]++;
+    sched->samples++;
+    sched->interval_sum += interval;
+    if (interval > sched->worst) sched->worst = interval;
+}
+
+static double frame_sched_count(FrameScheduler *sched, Uint64 now) {
+    double interval = 0.0;
+    if (sched->last_frame) {
+        interval = (double)(now - sched->last_frame) / (double)sched->freq;
+        frame_sched_record(sched, interval);
+    }
+    sched->last_frame = now;
+
+    if (!sched->fps_window_start) sched->fps_window_start = now;
+    sched->fps_frames++;
+    if (now - sched->fps_window_start >= sched->freq) {
+        sched->fps = sched->fps_frames * (double)sched->freq / (double)(now - sched->fps_window_start);
+        sched->fps_frames = 0;
+        sched->fps_window_start = now;
+    }
+    return interval;
+}
+
+static void frame_sched_step(FrameScheduler *sched, Uint64 now) {
+    if (!sched->period) return;
+    if (!sched->next_deadline) sched->next_deadline = now;
+    sched->next_deadline += sched->period;
+
+    // Missed a whole frame (stall, window drag) - start a new grid
+    // rather than presenting a burst of catch-up frames
+    if (now >= sched->next_deadline) sched->next_deadline = now + sched->period;
+}
+
+static double frame_sched_start(FrameScheduler *sched, Uint64 now) {
+    frame_sched_step(sched, now);
+    return frame_sched_count(sched, now);
+}
+
+double frame_sched_begin(FrameScheduler *sched) {
+    return frame_sched_start(sched, SDL_GetPerformanceCounter());
+}
+
+void frame_sched_advance(FrameScheduler *sched) {
+    frame_sched_step(sched, SDL_GetPerformanceCounter());
+}
+
+double frame_sched_present(FrameScheduler *sched) {
+    return frame_sched_count(sched, SDL_GetPerformanceCounter());
+}
+
+void frame_sched_wait(FrameScheduler *sched) {
+    if (!sched->period) return;
+
+    // The swap waits for vblank - sleeping as well would only risk
+    // missing one
+    if (sched->vsync && (sched->refresh_hz == 0 || sched->target_fps >= sched->refresh_hz)) return;
+
+    frame_sched_sleep_until(sched->next_deadline);
+}
+
+bool frame_sched_due(FrameScheduler *sched, Uint64 now) {
+    // Ticks land on vblanks, not on the deadlines: take the tick within
+    // a quarter frame of one
+    if (sched->period && sched->next_deadline &&
+        now + sched->period / 4 < sched->next_deadline) {
+        return false;
+    }
+    frame_sched_start(sched, now);
+    return true;
+}
+
+int frame_sched_delay_ms(const FrameScheduler *sched) {
+    if (!sched->period) return 0;
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (now >= sched->next_deadline) return 0;
+    return (int)((sched->next_deadline - now) * 1000 / sched->freq);
+}
+
+// ============================================================================
+// FRAME-TIME HISTOGRAM
+// ============================================================================
+
+double frame_sched_percentile(const FrameScheduler *sched, double fraction) {
+    if (sched->samples == 0) return 0.0;
+
+    Uint32 wanted = (Uint32)(fraction * sched->samples + 0.5);
+    if (wanted < 1) wanted = 1;
+    Uint32 seen = 0;
+    for (int i = 0; i < FRAME_SCHED_BUCKETS - 1; i++) {
+        seen += sched->histogram[i];
+        if (seen >= wanted) return (i + 1) * FRAME_SCHED_BUCKET_US / 1000.0;
+    }
+    return sched->worst * 1000.0;
+}
+
+void frame_sched_describe(const FrameScheduler *sched, char *text, size_t size) {
+    double avg = sched->samples ? sched->interval_sum / sched->samples * 1000.0 : 0.0;
+    snprintf(text, size,
+             "%.1f FPS  frame avg %.2f ms  p50 %.2f  p99 %.2f  max %.1f ms  (target %d%s)",
+             sched->fps, avg, frame_sched_percentile(sched, 0.5), frame_sched_percentile(sched, 0.99),
+             sched->worst * 1000.0, sched->target_fps, sched->vsync ? ", vsync" : "");
+}
+
+void frame_sched_log_stats(const FrameScheduler *sched, const char *front_end) {
+    if (sched->samples == 0) return;
+
+    SDL_Log("[Comet Busters] [FRAME] %s: %u frames, avg %.2f ms, p50 %.2f, p95 %.2f, p99 %.2f, max %.2f ms\n",
+            front_end, (unsigned)sched->samples, sched->interval_sum / sched->samples * 1000.0,
+            frame_sched_percentile(sched, 0.5), frame_sched_percentile(sched, 0.95),
+            frame_sched_percentile(sched, 0.99), sched->worst * 1000.0);
+
+    // Group the 0.25 ms buckets into milliseconds for the log; the last
+    // row holds the slowest bucket
+    const int per_ms = 1000 / FRAME_SCHED_BUCKET_US;
+    const int rows = FRAME_SCHED_BUCKETS / per_ms;
+    Uint32 counts[FRAME_SCHED_BUCKETS / (1000 / FRAME_SCHED_BUCKET_US)];
+    Uint32 most = 0;
+    for (int row = 0; row < rows; row++) {
+        counts[row] = 0;
+        for (int i = row * per_ms; i < (row + 1) * per_ms; i++) {
+            counts[row] += sched->histogram[i];
+        }
+        if (counts[row] > most) most = counts[row];
+    }
+
+    for (int row = 0; row < rows; row++) {
+        if (!counts[row]) continue;
+        char bar[FRAME_SCHED_BAR_WIDTH + 1];
+        int len = (int)((Uint64)counts[row] * FRAME_SCHED_BAR_WIDTH / most);
+        if (len < 1) len = 1;
+        memset(bar, '#', len);
+        bar[len] = '\0';
+        if (row == rows - 1) {
+            SDL_Log("[Comet Busters] [FRAME]   >= %2d ms %6u %s\n", row, (unsigned)counts[row], bar);
+        } else {
+            SDL_Log("[Comet Busters] [FRAME]   %2d-%2d ms %6u %s\n", row, row + 1, (unsigned)counts[row], bar);
+        }
+    }
+}
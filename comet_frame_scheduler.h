@@ -0,0 +1,104 @@
+#ifndef COMET_FRAME_SCHEDULER_H
+#define COMET_FRAME_SCHEDULER_H
+
+#ifdef ANDROID
+#include <SDL.h>
+#else
+#include <SDL2/SDL.h>
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// ============================================================
+// FRAME SCHEDULER
+// ============================================================
+// One frame pacing policy for the SDL, GTK and Qt front-ends.
+//
+// Frames sit on a grid of deadlines 1 / target_fps apart, kept in
+// high-resolution clock ticks (SDL_GetPerformanceCounter, which is
+// clock_gettime(CLOCK_MONOTONIC) on Linux). A whole-millisecond delay
+// like SDL_Delay(16 - elapsed) drifts against 60 Hz and oversleeps by
+// up to a millisecond; here the sleep is cut short and the last half
+// millisecond is spun.
+//
+// Vsync-aware: when swaps wait for vblank and the target is at least
+// the display refresh rate (or the rate is unknown), the swap already
+// paces frames and frame_sched_wait() returns at once. A lower target
+// (30 fps on a 60 Hz display) sleeps to the deadline and lets the
+// swap land on the next vblank. A frame that misses its deadline by a
+// whole period restarts the grid instead of rushing to catch up.
+//
+// Loops driven by another clock (GdkFrameClock ticks, Qt timers) ask
+// frame_sched_due() or frame_sched_delay_ms() instead of sleeping. When
+// the tick only requests a repaint (Qt's update()), the tick calls
+// frame_sched_advance() and the paint handler frame_sched_present(),
+// so the histogram measures drawn frames rather than timer wakeups.
+//
+// Every frame interval goes into a histogram (0.25 ms buckets up to
+// 50 ms) shown by the front-ends and logged at exit.
+// ============================================================
+
+#define FRAME_SCHED_BUCKET_US 250
+#define FRAME_SCHED_BUCKETS 200         // The last bucket collects everything slower
+
+typedef struct {
+    Uint64 freq;                        // Clock ticks per second
+    Uint64 period;                      // Ticks per frame, 0 = uncapped
+    Uint64 next_deadline;               // 0 until the first frame
+    Uint64 last_frame;
+    int target_fps;                     // 0 = uncapped
+    int refresh_hz;                     // 0 = unknown
+    bool vsync;                         // Swaps wait for vblank
+
+    // Frame intervals
+    Uint32 histogram[FRAME_SCHED_BUCKETS];
+    Uint32 samples;
+    double interval_sum;                // Seconds
+    double worst;
+
+    // Frames over the last second
+    Uint32 fps_frames;
+    Uint64 fps_window_start;
+    double fps;
+} FrameScheduler;
+
+// target_fps <= 0 leaves the rate to vsync (or the GPU)
+void frame_sched_init(FrameScheduler *sched, int target_fps, bool vsync, int refresh_hz);
+
+// Timestamps passed to frame_sched_due() count ticks_per_second
+// instead of the performance counter
+void frame_sched_set_clock(FrameScheduler *sched, Uint64 ticks_per_second);
+
+// Start a frame now. Returns the seconds since the previous frame
+// (0 for the first one).
+double frame_sched_begin(FrameScheduler *sched);
+
+// Split frame_sched_begin() for loops that draw after the tick:
+// advance moves to the next deadline, present records a frame drawn now
+void frame_sched_advance(FrameScheduler *sched);
+double frame_sched_present(FrameScheduler *sched);
+
+// Sleep to the next deadline unless vsync already paces presentation
+void frame_sched_wait(FrameScheduler *sched);
+
+// Externally clocked loops: true (and the frame is started) when a
+// frame should be drawn on the tick at 'now'
+bool frame_sched_due(FrameScheduler *sched, Uint64 now);
+
+// Whole milliseconds to the next deadline, for timer-driven loops
+int frame_sched_delay_ms(const FrameScheduler *sched);
+
+// Sleep until 'deadline' on the performance counter
+void frame_sched_sleep_until(Uint64 deadline);
+
+// Frame interval in milliseconds that 'fraction' of frames beat
+double frame_sched_percentile(const FrameScheduler *sched, double fraction);
+
+// One line for overlays and status bars
+void frame_sched_describe(const FrameScheduler *sched, char *text, size_t size);
+
+// Summary and histogram, one line per non-empty millisecond
+void frame_sched_log_stats(const FrameScheduler *sched, const char *front_end);
+
+#endif // COMET_FRAME_SCHEDULER_H
@@ -23,6 +23,10 @@
 #include "audio_wad.h"
 #include "comet_help.h"
 #include "comet_lang.h"
+#include "comet_sim_thread.h"
+#include "comet_frame_scheduler.h"
+#include "cometbuster_jobs.h"
+#include "cometbuster_quality.h"
 
 #ifdef ANDROID
 #include <SDL.h>
@@ -66,6 +70,8 @@ typedef struct {
     
     Visualizer visualizer;
     AudioManager audio;          // Audio system
+    SimThread sim;               // Simulation thread + render snapshots
+    FrameScheduler frame_sched;  // Redraw pacing on the frame clock + frame-time histogram
     
     int frame_count;
     double total_time;
@@ -1100,6 +1106,9 @@ void on_new_game_easy(GtkWidget *widget, gpointer data) {
     
     // Reset high score dialog flag
     gui->high_score_dialog_shown = false;
+    
+    // Hold the simulation off while the game is rebuilt
+    sim_thread_lock(&gui->sim);
     gui->game_paused = false;
     
     // Reset mouse state
@@ -1127,6 +1136,7 @@ void on_new_game_easy(GtkWidget *widget, gpointer data) {
     
     // Start new game WITH splash screen
     comet_buster_reset_game_with_splash(&gui->visualizer.comet_buster, true, 0);  // 0 = EASY
+    sim_thread_unlock(&gui->sim);
     
     // Play intro music
 #ifdef ExternalSound
@@ -1150,6 +1160,9 @@ void on_new_game_medium(GtkWidget *widget, gpointer data) {
     
     // Reset high score dialog flag
     gui->high_score_dialog_shown = false;
+    
+    // Hold the simulation off while the game is rebuilt
+    sim_thread_lock(&gui->sim);
     gui->game_paused = false;
     
     // Reset mouse state
@@ -1177,6 +1190,7 @@ void on_new_game_medium(GtkWidget *widget, gpointer data) {
     
     // Start new game WITH splash screen
     comet_buster_reset_game_with_splash(&gui->visualizer.comet_buster, true, 1);  // 1 = MEDIUM
+    sim_thread_unlock(&gui->sim);
     
     // Play intro music
 #ifdef ExternalSound
@@ -1199,6 +1213,9 @@ void on_new_game_hard(GtkWidget *widget, gpointer data) {
     
     // Reset high score dialog flag
     gui->high_score_dialog_shown = false;
+    
+    // Hold the simulation off while the game is rebuilt
+    sim_thread_lock(&gui->sim);
     gui->game_paused = false;
     
     // Reset mouse state
@@ -1226,6 +1243,7 @@ void on_new_game_hard(GtkWidget *widget, gpointer data) {
     
     // Start new game WITH splash screen
     comet_buster_reset_game_with_splash(&gui->visualizer.comet_buster, true, 2);  // 2 = HARD
+    sim_thread_unlock(&gui->sim);
     
     // Play intro music
 #ifdef ExternalSound
@@ -1287,6 +1305,8 @@ void on_debug_wave_selected(GtkComboBox *widget, gpointer data) {
     
     // Reset high score dialog flag
     gui->high_score_dialog_shown = false;
+    
+    sim_thread_lock(&gui->sim);
     gui->game_paused = false;
     
     // Initialize game WITHOUT splash screen
@@ -1300,6 +1320,7 @@ void on_debug_wave_selected(GtkComboBox *widget, gpointer data) {
     
     // Spawn wave comets
     comet_buster_spawn_wave(game, gui->visualizer.width, gui->visualizer.height);
+    sim_thread_unlock(&gui->sim);
     
     SDL_Log("[Comet Busters] [DEBUG] Jumped to Wave %d! Score: %d, Multiplier: %.2fx\n", 
             selected_wave, game->score, game->score_multiplier);
@@ -1384,6 +1405,8 @@ void on_debug_jump_to_wave_5(GtkWidget *widget, gpointer data) {
     
     // Reset high score dialog flag
     gui->high_score_dialog_shown = false;
+    
+    sim_thread_lock(&gui->sim);
     gui->game_paused = false;
     
     // Initialize game first
@@ -1397,6 +1420,7 @@ void on_debug_jump_to_wave_5(GtkWidget *widget, gpointer data) {
     
     // Spawn Wave 5 comets
     comet_buster_spawn_wave(game, gui->visualizer.width, gui->visualizer.height);
+    sim_thread_unlock(&gui->sim);
     
     SDL_Log("[Comet Busters] [DEBUG] Jumped to Wave 5! Score: %d, Multiplier: %.1fx\n", 
             game->score, game->score_multiplier);
@@ -1407,6 +1431,7 @@ void on_debug_spawn_boss(GtkWidget *widget, gpointer data) {
     if (!gui) return;
     
     CometBusterGame *game = &gui->visualizer.comet_buster;
+    sim_thread_lock(&gui->sim);
     
     // Clear existing comets for cleaner boss fight
     game->comet_count = 0;
@@ -1418,6 +1443,7 @@ void on_debug_spawn_boss(GtkWidget *widget, gpointer data) {
     
     // Spawn the boss directly
     comet_buster_spawn_boss(game, gui->visualizer.width, gui->visualizer.height);
+    sim_thread_unlock(&gui->sim);
     
     SDL_Log("[Comet Busters] [DEBUG] Boss spawned directly! Wave: %d\n", game->current_wave);
 }
@@ -1427,6 +1453,7 @@ void on_debug_skip_to_boss_phase(GtkWidget *widget, gpointer data) {
     if (!gui) return;
     
     CometBusterGame *game = &gui->visualizer.comet_buster;
+    sim_thread_lock(&gui->sim);
     
     // Jump to Wave 5, clear comets, and spawn boss
     game->current_wave = 5;
@@ -1436,6 +1463,7 @@ void on_debug_skip_to_boss_phase(GtkWidget *widget, gpointer data) {
     
     // Spawn boss directly
     comet_buster_spawn_boss(game, gui->visualizer.width, gui->visualizer.height);
+    sim_thread_unlock(&gui->sim);
     
     SDL_Log("[Comet Busters] [DEBUG] Boss fight ready! Score: %d, Multiplier: %.1fx\n", 
             game->score, game->score_multiplier);
@@ -1470,6 +1498,8 @@ void on_cheat_boss_level_selected(GtkComboBox *widget, gpointer data) {
     
     // Reset high score dialog flag
     gui->high_score_dialog_shown = false;
+    
+    sim_thread_lock(&gui->sim);
     gui->game_paused = false;
     
     // Initialize game WITHOUT splash screen, set to EASY difficulty when selecting a boss
@@ -1483,6 +1513,7 @@ void on_cheat_boss_level_selected(GtkComboBox *widget, gpointer data) {
     
     // Spawn wave comets
     comet_buster_spawn_wave(game, gui->visualizer.width, gui->visualizer.height);
+    sim_thread_unlock(&gui->sim);
     
     SDL_Log("[Comet Busters] [CHEAT] Jumped to Boss Level %d! Score: %d, Multiplier: %.2fx\n", 
             selected_level, game->score, game->score_multiplier);
@@ -1775,36 +1806,116 @@ void on_toggle_fullscreen(GtkWidget *widget, gpointer data) {
 void update_status_text(CometGUI *gui) {
     if (!gui || !gui->status_label) return;
     
+    char pacing[192];
     char status[256];
-    snprintf(status, sizeof(status),
-             "Score: %d | FPS: %.1f",
-             gui->visualizer.comet_buster.score,
-             gui->frame_count > 0 ? (1000.0 / (gui->total_time / gui->frame_count)) : 0);
+    frame_sched_describe(&gui->frame_sched, pacing, sizeof(pacing));
+    snprintf(status, sizeof(status), "Score: %d | %s",
+             gui->visualizer.comet_buster.score, pacing);
     
     gtk_label_set_text(GTK_LABEL(gui->status_label), status);
 }
 
-gboolean game_update_timer(gpointer data) {
-    CometGUI *gui = (CometGUI*)data;
-    if (!gui) return TRUE;
+// ============================================================================
+// SIMULATION STEP (runs on the simulation thread)
+// ============================================================================
+// Only the calls that advance game state live here. Everything that touches
+// GTK widgets, dialogs or music stays in game_update_timer on the main thread.
+
+static void gtk_sim_step(void *user, double dt) {
+    CometGUI *gui = (CometGUI*)user;
     
     // Handle splash screen if active
     if (gui->visualizer.comet_buster.splash_screen_active) {
-        // Sync audio settings to visualizer (copy current state)
-        gui->visualizer.audio = gui->audio;
-        
-        // Temporarily disable audio to prevent explosion/firing sounds during splash
-        bool audio_was_enabled = gui->audio.audio_enabled;
-        gui->audio.audio_enabled = false;
+        // Temporarily disable audio to prevent explosion/firing sounds during splash.
+        // Only the visualizer's copy - gui->audio belongs to the main thread.
+        bool audio_was_enabled = gui->visualizer.audio.audio_enabled;
         gui->visualizer.audio.audio_enabled = false;
         
         // Update the splash screen
-        comet_buster_update_splash_screen(&gui->visualizer.comet_buster, 1.0 / 60.0, 1920, 1080, &gui->visualizer);
+        comet_buster_update_splash_screen(&gui->visualizer.comet_buster, dt, 1920, 1080, &gui->visualizer);
         
         // Restore audio setting
-        gui->audio.audio_enabled = audio_was_enabled;
         gui->visualizer.audio.audio_enabled = audio_was_enabled;
+        return;
+    }
+    
+    // Update the victory scroll if game is won
+    if (gui->visualizer.comet_buster.game_won && gui->visualizer.comet_buster.splash_screen_active) {
+        comet_buster_update_victory_scroll(&gui->visualizer.comet_buster, dt);
+        return;
+    }
+    
+    // Update the finale splash (Wave 30 victory)
+    if (gui->visualizer.comet_buster.finale_splash_active) {
+        comet_buster_update_finale_splash(&gui->visualizer.comet_buster, dt);
+        return;
+    }
+    
+    if (!gui->game_paused) {
+        // Update game
+        update_comet_buster(&gui->visualizer, dt);
         
+        // Reset scroll wheel input after processing
+        gui->visualizer.scroll_direction = 0;
+    }
+}
+
+// Debug overlay (F3): the same two lines as the SDL front-end. Returns
+// false when the overlay is off.
+static bool gtk_debug_overlay_text(CometGUI *gui, char *pacing, char *quality, size_t size) {
+    if (!gui->visualizer.options.show_debug_info) return false;
+    frame_sched_describe(&gui->frame_sched, pacing, size);
+    quality_governor_describe(quality, size);
+    return true;
+}
+
+// The GL draw callbacks only see the snapshot, so the text is handed to
+// the renderer before each draw is queued
+static void gtk_update_debug_overlay(CometGUI *gui) {
+    char pacing[256];
+    char quality[256];
+    if (gtk_debug_overlay_text(gui, pacing, quality, sizeof(pacing))) {
+        gl_set_debug_overlay(pacing, quality);
+    } else {
+        gl_set_debug_overlay(NULL, NULL);
+    }
+}
+
+static void gtk_draw_debug_overlay_cairo(CometGUI *gui, cairo_t *cr, int width, int height) {
+    char pacing[256];
+    char quality[256];
+    if (!gtk_debug_overlay_text(gui, pacing, quality, sizeof(pacing))) return;
+
+    cairo_set_source_rgba(cr, 0.0, 0.0, 0.0, 0.6);
+    cairo_rectangle(cr, 0, height - 48, width, 48);
+    cairo_fill(cr);
+    cairo_set_source_rgb(cr, 0.6, 1.0, 0.6);
+    cairo_select_font_face(cr, "Monospace", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
+    cairo_set_font_size(cr, 14);
+    cairo_move_to(cr, 10, height - 29);
+    cairo_show_text(cr, pacing);
+    cairo_move_to(cr, 10, height - 9);
+    cairo_show_text(cr, quality);
+}
+
+// Windows draws through SDL/WGL straight away, once per timer tick.
+// GTK widgets are drawn from the frame clock instead (on_frame_tick),
+// so the timer no longer queues its own draws on top.
+static void gtk_request_redraw(CometGUI *gui) {
+#ifdef _WIN32
+    frame_sched_begin(&gui->frame_sched);
+    gtk_update_debug_overlay(gui);
+    sdl_wgl_render_frame(sim_thread_acquire_snapshot(&gui->sim));
+#else
+    (void)gui;
+#endif
+}
+
+// Main-thread half of the frame: splash/finale exits, high scores, music and
+// status text. Runs with the simulation locked out.
+static void game_update_ui(CometGUI *gui) {
+    // Handle splash screen if active
+    if (gui->visualizer.comet_buster.splash_screen_active) {
         // Check if user wants to exit splash screen
         if (comet_buster_splash_screen_input_detected(&gui->visualizer)) {
             SDL_Log("[Comet Busters] [SPLASH] User pressed key - exiting splash screen\n");
@@ -1823,6 +1934,7 @@ gboolean game_update_timer(gpointer data) {
                 }
                 gtk_widget_grab_focus(gui->gl_area);
                 gui->rendering_engine = 1;
+                gl_set_gpu_particles_active(true);
                 gui->auto_switch_to_opengl = false;  // Only do this once
             }
             
@@ -1843,23 +1955,12 @@ gboolean game_update_timer(gpointer data) {
         }
         
         // Redraw and return early (don't update normal game during splash)
-        if (gui->rendering_engine == 1) {
-#ifdef _WIN32
-            sdl_wgl_render_frame(&gui->visualizer);
-#else
-            gtk_widget_queue_draw(gui->gl_area);
-#endif
-        } else {
-            gtk_widget_queue_draw(gui->drawing_area);
-        }
-        return TRUE;
+        gtk_request_redraw(gui);
+        return;
     }
     
     // Handle victory scroll if game is won
     if (gui->visualizer.comet_buster.game_won && gui->visualizer.comet_buster.splash_screen_active) {
-        // Update the victory scroll
-        comet_buster_update_victory_scroll(&gui->visualizer.comet_buster, 1.0 / 60.0);
-        
         // Check if user wants to exit victory scroll
         if (comet_buster_victory_scroll_input_detected(&gui->visualizer.comet_buster, &gui->visualizer)) {
             SDL_Log("[Comet Busters] [VICTORY] User pressed key - exiting victory scroll\n");
@@ -1886,16 +1987,8 @@ gboolean game_update_timer(gpointer data) {
         }
         
         // Redraw and return early (don't update normal game during victory scroll)
-        if (gui->rendering_engine == 1) {
-#ifdef _WIN32
-            sdl_wgl_render_frame(&gui->visualizer);
-#else
-            gtk_widget_queue_draw(gui->gl_area);
-#endif
-        } else {
-            gtk_widget_queue_draw(gui->drawing_area);
-        }
-        return TRUE;
+        gtk_request_redraw(gui);
+        return;
     }
     
     // Handle finale splash if active (Wave 30 victory)
@@ -1911,9 +2004,6 @@ gboolean game_update_timer(gpointer data) {
             gui->finale_music_started = true;
         }
         
-        // Update the finale splash
-        comet_buster_update_finale_splash(&gui->visualizer.comet_buster, 1.0 / 60.0);
-        
         // Check if user wants to continue to next wave (can right-click anytime to skip)
         if (gui->visualizer.mouse_right_pressed) {
             SDL_Log("[Comet Busters] [FINALE] Player skipping to Wave 31\n");
@@ -1957,25 +2047,11 @@ gboolean game_update_timer(gpointer data) {
         }
         
         // Redraw and return early (don't update normal game during finale splash)
-        if (gui->rendering_engine == 1) {
-#ifdef _WIN32
-            sdl_wgl_render_frame(&gui->visualizer);
-#else
-            gtk_widget_queue_draw(gui->gl_area);
-#endif
-        } else {
-            gtk_widget_queue_draw(gui->drawing_area);
-        }
-        return TRUE;
+        gtk_request_redraw(gui);
+        return;
     }
     
     if (!gui->game_paused) {
-        // Update game
-        update_comet_buster(&gui->visualizer, 1.0 / 60.0);
-        
-        // Reset scroll wheel input after processing
-        gui->visualizer.scroll_direction = 0;
-        
         // Check if game just ended and it's a high score
         if (gui->visualizer.comet_buster.game_over || gui->visualizer.comet_buster.ship_lives<=0) {
             // Check if this is a high score
@@ -2008,17 +2084,44 @@ gboolean game_update_timer(gpointer data) {
         }
         
         // Redraw
-        if (gui->rendering_engine == 1) {
-#ifdef _WIN32
-            sdl_wgl_render_frame(&gui->visualizer);
-#else
-            gtk_widget_queue_draw(gui->gl_area);
+        gtk_request_redraw(gui);
+    }
+}
+
+#ifndef _WIN32
+// Runs once per display refresh (GdkFrameClock). Queues a draw of the
+// visible renderer when the frame scheduler says one is due, which
+// holds GameOptions::target_fps below the refresh rate.
+static gboolean on_frame_tick(GtkWidget *widget, GdkFrameClock *clock, gpointer data) {
+    (void)widget;
+    CometGUI *gui = (CometGUI*)data;
+    
+    if (frame_sched_due(&gui->frame_sched, (Uint64)gdk_frame_clock_get_frame_time(clock))) {
+        gtk_update_debug_overlay(gui);
+        gtk_widget_queue_draw(gui->rendering_engine == 1 ? gui->gl_area : gui->drawing_area);
+    }
+    return G_SOURCE_CONTINUE;
+}
 #endif
-        } else {
-            gtk_widget_queue_draw(gui->drawing_area);
-        }
+
+gboolean game_update_timer(gpointer data) {
+    CometGUI *gui = (CometGUI*)data;
+    if (!gui) return TRUE;
+    
+    // No simulation thread (creation failed): step inline like before
+    if (!gui->sim.threaded) {
+        sim_thread_step(&gui->sim, 1.0 / 60.0);
     }
     
+    sim_thread_lock(&gui->sim);
+    
+    // Sync audio settings to visualizer (copy current state). gui->audio
+    // only changes on this thread, so the copy is made here under the lock.
+    gui->visualizer.audio = gui->audio;
+    
+    game_update_ui(gui);
+    sim_thread_unlock(&gui->sim);
+    
     return TRUE;  // Continue timer
 }
 
@@ -2050,26 +2153,31 @@ gboolean on_draw(GtkWidget *widget, cairo_t *cr, gpointer data) {
     // Apply the scale transform to cairo
     cairo_scale(cr, scale, scale);
     
+    // Draw the newest simulation snapshot, not the live game
+    Visualizer *vis = sim_thread_acquire_snapshot(&gui->sim);
+    
     // Game always renders at logical size
-    gui->visualizer.width = game_width;
-    gui->visualizer.height = game_height;
+    vis->width = game_width;
+    vis->height = game_height;
     
     // Draw victory scroll if game is won
-    if (gui->visualizer.comet_buster.game_won && gui->visualizer.comet_buster.splash_screen_active) {
-        comet_buster_draw_victory_scroll(&gui->visualizer.comet_buster, cr, game_width, game_height);
+    if (vis->comet_buster.game_won && vis->comet_buster.splash_screen_active) {
+        comet_buster_draw_victory_scroll(&vis->comet_buster, cr, game_width, game_height);
     }
     // Draw finale splash (Wave 30 victory) if active
-    else if (gui->visualizer.comet_buster.finale_splash_active) {
-        draw_comet_buster(&gui->visualizer, cr);  // Draw game in background
-        comet_buster_draw_finale_splash(&gui->visualizer.comet_buster, cr, game_width, game_height);
+    else if (vis->comet_buster.finale_splash_active) {
+        draw_comet_buster(vis, cr);  // Draw game in background
+        comet_buster_draw_finale_splash(&vis->comet_buster, cr, game_width, game_height);
     }
     // Draw splash screen if active, otherwise draw normal game
-    else if (gui->visualizer.comet_buster.splash_screen_active) {
-        comet_buster_draw_splash_screen(&gui->visualizer.comet_buster, cr, game_width, game_height);
+    else if (vis->comet_buster.splash_screen_active) {
+        comet_buster_draw_splash_screen(&vis->comet_buster, cr, game_width, game_height);
     } else {
-        draw_comet_buster(&gui->visualizer, cr);
+        draw_comet_buster(vis, cr);
     }
     
+    gtk_draw_debug_overlay_cairo(gui, cr, game_width, game_height);
+    
     return FALSE;
 }
 
@@ -2101,6 +2209,8 @@ gboolean on_button_press(GtkWidget *widget, GdkEventButton *event, gpointer data
     // Get the current zoom scale
     double scale = get_current_zoom_scale(widget);
     
+    sim_thread_lock(&gui->sim);
+    
     // Convert physical screen coordinates to logical game coordinates
     gui->visualizer.mouse_x = event->x / scale;
     gui->visualizer.mouse_y = event->y / scale;
@@ -2119,6 +2229,7 @@ gboolean on_button_press(GtkWidget *widget, GdkEventButton *event, gpointer data
         }
     }
     
+    sim_thread_unlock(&gui->sim);
     return FALSE;
 }
 
@@ -2129,6 +2240,8 @@ gboolean on_button_release(GtkWidget *widget, GdkEventButton *event, gpointer da
     // Get the current zoom scale
     double scale = get_current_zoom_scale(widget);
     
+    sim_thread_lock(&gui->sim);
+    
     // Convert physical screen coordinates to logical game coordinates
     gui->visualizer.mouse_x = event->x / scale;
     gui->visualizer.mouse_y = event->y / scale;
@@ -2137,9 +2250,18 @@ gboolean on_button_release(GtkWidget *widget, GdkEventButton *event, gpointer da
     if (event->button == 2) gui->visualizer.mouse_middle_pressed = false;
     if (event->button == 3) gui->visualizer.mouse_right_pressed = false;
     
+    sim_thread_unlock(&gui->sim);
     return FALSE;
 }
 
+// Input handlers run on the main thread; writes to the live visualizer
+// are locked against the simulation thread
+static void gtk_set_scroll_direction(CometGUI *gui, int direction) {
+    sim_thread_lock(&gui->sim);
+    gui->visualizer.scroll_direction = direction;
+    sim_thread_unlock(&gui->sim);
+}
+
 gboolean on_scroll(GtkWidget *widget, GdkEventScroll *event, gpointer data) {
     CometGUI *gui = (CometGUI*)data;
     if (!gui || !event) return FALSE;
@@ -2148,22 +2270,22 @@ gboolean on_scroll(GtkWidget *widget, GdkEventScroll *event, gpointer data) {
     
     // Handle scroll wheel events for weapon switching
     if (event->direction == GDK_SCROLL_UP) {
-        gui->visualizer.scroll_direction = 1;
+        gtk_set_scroll_direction(gui, 1);
         SDL_Log("[Comet Busters] [SCROLL] UP detected - setting scroll_direction to 1\n");
         return TRUE;
     } else if (event->direction == GDK_SCROLL_DOWN) {
-        gui->visualizer.scroll_direction = -1;
+        gtk_set_scroll_direction(gui, -1);
         SDL_Log("[Comet Busters] [SCROLL] DOWN detected - setting scroll_direction to -1\n");
         return TRUE;
     } else if (event->direction == GDK_SCROLL_SMOOTH) {
         // Handle smooth scrolling (modern mice/trackpads)
         SDL_Log("[Comet Busters] [SCROLL] SMOOTH scroll - delta_y: %.2f\n", event->delta_y);
         if (event->delta_y < 0) {
-            gui->visualizer.scroll_direction = 1;
+            gtk_set_scroll_direction(gui, 1);
             SDL_Log("[Comet Busters] [SCROLL] SMOOTH UP - setting scroll_direction to 1\n");
             return TRUE;
         } else if (event->delta_y > 0) {
-            gui->visualizer.scroll_direction = -1;
+            gtk_set_scroll_direction(gui, -1);
             SDL_Log("[Comet Busters] [SCROLL] SMOOTH DOWN - setting scroll_direction to -1\n");
             return TRUE;
         }
@@ -2180,6 +2302,7 @@ gboolean on_motion_notify(GtkWidget *widget, GdkEventMotion *event, gpointer dat
     // Get the current zoom scale
     double scale = get_current_zoom_scale(widget);
     
+    sim_thread_lock(&gui->sim);
     gui->visualizer.last_mouse_x = gui->visualizer.mouse_x;
     gui->visualizer.last_mouse_y = gui->visualizer.mouse_y;
     
@@ -2188,6 +2311,7 @@ gboolean on_motion_notify(GtkWidget *widget, GdkEventMotion *event, gpointer dat
     gui->visualizer.mouse_y = event->y / scale;
     gui->visualizer.mouse_just_moved = true;
     gui->visualizer.mouse_movement_timer = 0.5;
+    sim_thread_unlock(&gui->sim);
     
     return FALSE;
 }
@@ -2209,7 +2333,9 @@ gboolean on_focus_out(GtkWidget *widget, GdkEvent *event, gpointer data) {
     
     // Stop music immediately when window loses focus
     if (!gui->game_paused) {
+        sim_thread_lock(&gui->sim);
         gui->game_paused = true;
+        sim_thread_unlock(&gui->sim);
         audio_stop_music(&gui->audio);
     }
     return FALSE;
@@ -2226,64 +2352,78 @@ gboolean on_focus_in(GtkWidget *widget, GdkEvent *event, gpointer data) {
     
     // Resume the game when window regains focus (music will restart naturally from game loop)
     if (gui->game_paused) {
+        sim_thread_lock(&gui->sim);
         gui->game_paused = false;
+        sim_thread_unlock(&gui->sim);
     }
     return FALSE;
 }
 
-gboolean on_key_press(GtkWidget *widget, GdkEventKey *event, gpointer data) {
-    CometGUI *gui = (CometGUI*)data;
-    if (!gui) return FALSE;
+// Movement and fire keys, shared by press and release. Returns false for
+// keys that aren't game controls. Caller holds the simulation lock.
+static bool gtk_game_key(CometGUI *gui, guint keyval, bool pressed) {
+    Visualizer *vis = &gui->visualizer;
     
-    switch (event->keyval) {
+    switch (keyval) {
         case GDK_KEY_a:
         case GDK_KEY_A:
         case GDK_KEY_Left:  // Arrow left = turn left
-            gui->visualizer.key_a_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_a_pressed = pressed;
             break;
         case GDK_KEY_d:
         case GDK_KEY_D:
         case GDK_KEY_Right:  // Arrow right = turn right
-            gui->visualizer.key_d_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_d_pressed = pressed;
             break;
         case GDK_KEY_w:
         case GDK_KEY_W:
         case GDK_KEY_Up:  // Arrow up = forward thrust
-            gui->visualizer.key_w_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_w_pressed = pressed;
             break;
         case GDK_KEY_s:
         case GDK_KEY_S:
         case GDK_KEY_Down:  // Arrow down = backward thrust
-            gui->visualizer.key_s_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_s_pressed = pressed;
             break;
         case GDK_KEY_z:
         case GDK_KEY_Z:
-            gui->visualizer.key_z_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_z_pressed = pressed;
             break;
         case GDK_KEY_x:
         case GDK_KEY_X:
-            gui->visualizer.key_x_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_x_pressed = pressed;
             break;
         case GDK_KEY_space:
-            gui->visualizer.key_space_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_space_pressed = pressed;
             break;
         case GDK_KEY_Control_L:
         case GDK_KEY_Control_R:
-            gui->visualizer.key_ctrl_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_ctrl_pressed = pressed;
             break;
         case GDK_KEY_q:
         case GDK_KEY_Q:
-            gui->visualizer.key_q_pressed = true;
-            gui->visualizer.mouse_just_moved = false;  // Disable mouse when keyboard is used
+            vis->key_q_pressed = pressed;
             break;
+        default:
+            return false;
+    }
+    
+    // Disable mouse when keyboard is used
+    if (pressed) vis->mouse_just_moved = false;
+    return true;
+}
+
+gboolean on_key_press(GtkWidget *widget, GdkEventKey *event, gpointer data) {
+    CometGUI *gui = (CometGUI*)data;
+    if (!gui) return FALSE;
+    
+    // Movement and fire keys go to the live game
+    sim_thread_lock(&gui->sim);
+    bool game_key = gtk_game_key(gui, event->keyval, true);
+    sim_thread_unlock(&gui->sim);
+    if (game_key) return FALSE;
+    
+    switch (event->keyval) {
         case GDK_KEY_v:
         case GDK_KEY_V:
             on_volume_dialog_open(NULL, gui);
@@ -2300,12 +2440,22 @@ gboolean on_key_press(GtkWidget *widget, GdkEventKey *event, gpointer data) {
             on_toggle_fullscreen(NULL, gui);
             return TRUE;
             break;
+        case GDK_KEY_F3:
+            // Snapshots copy the options, so the change goes in under the lock
+            sim_thread_lock(&gui->sim);
+            gui->visualizer.options.show_debug_info = !gui->visualizer.options.show_debug_info;
+            sim_thread_unlock(&gui->sim);
+            SDL_Log("[Comet Busters] [INPUT] F3 - Debug overlay: %s\n",
+                    gui->visualizer.options.show_debug_info ? "ON" : "OFF");
+            return TRUE;
         case GDK_KEY_p:
         case GDK_KEY_P:
         case GDK_KEY_Escape:
             // Don't allow pause during splash screens (intro, victory scroll, finale)
             if (!gui->visualizer.comet_buster.splash_screen_active) {
+                sim_thread_lock(&gui->sim);
                 gui->game_paused = !gui->game_paused;
+                sim_thread_unlock(&gui->sim);
                 if (gui->game_paused) {
                     audio_stop_music(&gui->audio);
                     SDL_Log("[Comet Busters] %s\n", "[*] Game Paused");
@@ -2348,47 +2498,9 @@ gboolean on_key_release(GtkWidget *widget, GdkEventKey *event, gpointer data) {
     CometGUI *gui = (CometGUI*)data;
     if (!gui) return FALSE;
     
-    switch (event->keyval) {
-        case GDK_KEY_a:
-        case GDK_KEY_A:
-        case GDK_KEY_Left:  // Arrow left
-            gui->visualizer.key_a_pressed = false;
-            break;
-        case GDK_KEY_d:
-        case GDK_KEY_D:
-        case GDK_KEY_Right:  // Arrow right
-            gui->visualizer.key_d_pressed = false;
-            break;
-        case GDK_KEY_w:
-        case GDK_KEY_W:
-        case GDK_KEY_Up:  // Arrow up
-            gui->visualizer.key_w_pressed = false;
-            break;
-        case GDK_KEY_s:
-        case GDK_KEY_S:
-        case GDK_KEY_Down:  // Arrow down
-            gui->visualizer.key_s_pressed = false;
-            break;
-        case GDK_KEY_z:
-        case GDK_KEY_Z:
-            gui->visualizer.key_z_pressed = false;
-            break;
-        case GDK_KEY_x:
-        case GDK_KEY_X:
-            gui->visualizer.key_x_pressed = false;
-            break;
-        case GDK_KEY_space:
-            gui->visualizer.key_space_pressed = false;
-            break;
-        case GDK_KEY_Control_L:
-        case GDK_KEY_Control_R:
-            gui->visualizer.key_ctrl_pressed = false;
-            break;
-        case GDK_KEY_q:
-        case GDK_KEY_Q:
-            gui->visualizer.key_q_pressed = false;
-            break;
-    }
+    sim_thread_lock(&gui->sim);
+    gtk_game_key(gui, event->keyval, false);
+    sim_thread_unlock(&gui->sim);
     
     return FALSE;
 }
@@ -2460,6 +2572,7 @@ void on_rendering_cairo(GtkWidget *widget, gpointer data) {
     
     gtk_widget_grab_focus(gui->drawing_area);
     gui->rendering_engine = 0;
+    gl_set_gpu_particles_active(false);
     gtk_widget_queue_draw(gui->drawing_area);
 #endif
 }
@@ -2483,6 +2596,7 @@ void on_rendering_opengl(GtkWidget *widget, gpointer data) {
     
     gtk_widget_grab_focus(gui->gl_area);
     gui->rendering_engine = 1;
+    gl_set_gpu_particles_active(true);
 #ifndef _WIN32
     gtk_widget_queue_draw(gui->gl_area);
 #endif
@@ -2492,6 +2606,22 @@ void on_rendering_opengl(GtkWidget *widget, gpointer data) {
 // END RENDERING ENGINE SELECTION FUNCTIONS
 // ============================================================
 
+/**
+ * Refresh rate of the monitor showing the window, 0 if unknown
+ */
+static int gtk_refresh_hz(GtkWidget *window) {
+#if GTK_CHECK_VERSION(3, 22, 0)
+    GdkWindow *gdk_window = gtk_widget_get_window(window);
+    if (!gdk_window) return 0;
+    GdkMonitor *monitor = gdk_display_get_monitor_at_window(gdk_window_get_display(gdk_window), gdk_window);
+    if (!monitor) return 0;
+    return (gdk_monitor_get_refresh_rate(monitor) + 500) / 1000;  // millihertz
+#else
+    (void)window;
+    return 0;
+#endif
+}
+
 
 int main(int argc, char *argv[]) {
     gtk_init(&argc, &argv);
@@ -2512,6 +2642,9 @@ int main(int argc, char *argv[]) {
     // Set rendering engine
     gui.rendering_engine = rendering_engine;
     
+    // Explosion debris only goes to the GPU while the OpenGL view is up
+    gl_set_gpu_particles_active(rendering_engine == 1);
+    
     // Auto-switch to OpenGL after splash screen unless user explicitly requested Cairo
     gui.auto_switch_to_opengl = (rendering_engine == 0);  // If starting with Cairo, auto-switch to OpenGL
     
@@ -2902,6 +3035,7 @@ int main(int argc, char *argv[]) {
     SDL_Log("[Comet Busters] [MAIN] Windows: creating SDL/OpenGL rendering surface\n");
     gui.rendering_engine = 1;
     gui.auto_switch_to_opengl = false;
+    gl_set_gpu_particles_active(true);
 
     gui.gl_area = gtk_drawing_area_new();
     gtk_widget_set_size_request(gui.gl_area, -1, -1);
@@ -2968,7 +3102,7 @@ int main(int argc, char *argv[]) {
                          GDK_KEY_RELEASE_MASK |
                          GDK_SCROLL_MASK);
     g_signal_connect(gui.gl_area, "realize", G_CALLBACK(on_realize), NULL);
-    g_signal_connect(gui.gl_area, "render", G_CALLBACK(on_render), &gui.visualizer);
+    g_signal_connect(gui.gl_area, "render", G_CALLBACK(on_render), &gui.sim);
     g_signal_connect(gui.gl_area, "button-press-event", G_CALLBACK(on_button_press), &gui);
     g_signal_connect(gui.gl_area, "button-release-event", G_CALLBACK(on_button_release), &gui);
     g_signal_connect(gui.gl_area, "scroll-event", G_CALLBACK(on_scroll), &gui);
@@ -3003,14 +3137,44 @@ int main(int argc, char *argv[]) {
         gtk_widget_grab_focus(gui.drawing_area);
     }
 #endif
+    // Before the simulation thread starts copying the visualizer
+    gui.visualizer.options = game_options_default();
+    
+    // Game state advances on the simulation thread; the timer below only
+    // handles the GTK side (dialogs, music, status bar)
+    if (sim_thread_init(&gui.sim, &gui.visualizer, gtk_sim_step, &gui, SIM_DEFAULT_HZ)) {
+        sim_thread_start(&gui.sim);
+    }
+    
     // Start game update timer (approximately 60 FPS)
     gui.update_timer_id = g_timeout_add(17, game_update_timer, &gui);  // ~60 FPS
     
+    // GTK always syncs to its frame clock, so GameOptions::vsync_enabled
+    // does not apply here. Draws are queued from the frame clock
+    // (on_frame_tick), which follows the display's vblank, and a
+    // GtkGLArea has no swap interval to turn off. The WGL child window on
+    // Windows keeps the driver's default swap interval of one vblank.
+    // Frame clock timestamps are in microseconds.
+    if (!gui.visualizer.options.vsync_enabled) {
+        SDL_Log("[Comet Busters] [FRAME] GTK always syncs to the frame clock - vsync option ignored\n");
+    }
+    int refresh_hz = gtk_refresh_hz(gui.window);
+    frame_sched_init(&gui.frame_sched, gui.visualizer.options.target_fps, true, refresh_hz);
+    quality_governor_init(gui.visualizer.options.target_fps, refresh_hz);
+#ifndef _WIN32
+    frame_sched_set_clock(&gui.frame_sched, 1000000);
+    gtk_widget_add_tick_callback(gui.window, on_frame_tick, &gui, NULL);
+#endif
+    
     gtk_main();
     
     // Cleanup
     g_source_remove(gui.update_timer_id);
+    frame_sched_log_stats(&gui.frame_sched, "GTK");
+    sim_thread_shutdown(&gui.sim);
+    job_system_shutdown();
     comet_buster_cleanup(&gui.visualizer.comet_buster);
+    draw_comet_buster_cleanup();
     joystick_manager_cleanup(&gui.visualizer.joystick_manager);
     audio_cleanup(&gui.audio);
 #ifdef _WIN32
@@ -31,6 +31,10 @@
 #include "comet_main_gl_gui.h"
 #include "comet_main_gl_menu.h"
 #include "comet_haptics.h"
+#include "cometbuster_jobs.h"
+#include "cometbuster_fastmath.h"
+#include "cometbuster_simd.h"
+#include "cometbuster_quality.h"
 
 #ifdef STEAM_ENABLED
 #include "steam/steam_api.h"
@@ -212,7 +216,7 @@ static bool init_sdl_and_opengl(CometGUI *gui, int width, int height) {
 // GAME LOOP
 // ============================================================
 
-static void update_game(CometGUI *gui, HighScoreEntryUI *hs_entry) {
+static void update_game(CometGUI *gui, HighScoreEntryUI *hs_entry, double dt) {
     // Don't update if menu is open, game is paused, or help overlay is showing
     if (gui->show_menu || gui->game_paused || gui->show_help_overlay) return;
     
@@ -231,7 +235,7 @@ static void update_game(CometGUI *gui, HighScoreEntryUI *hs_entry) {
         }
         
         // Update the finale splash (THIS IS CRITICAL - animates the finale)
-        comet_buster_update_finale_splash(&gui->visualizer.comet_buster, 1.0 / 60.0);
+        comet_buster_update_finale_splash(&gui->visualizer.comet_buster, dt);
         
         // Check if user wants to continue to next wave (can right-click anytime to skip)
         if (gui->visualizer.mouse_right_pressed) {
@@ -276,7 +280,7 @@ static void update_game(CometGUI *gui, HighScoreEntryUI *hs_entry) {
     // Call the master update function from visualization.h
     // This handles ALL game updates including collisions, audio, wave progression, etc.
     // (This is skipped during finale when we return above)
-    update_comet_buster(&gui->visualizer, gui->delta_time);
+    update_comet_buster(&gui->visualizer, dt);
     
     // Check if current music track has finished and queue the next one
 #ifdef ExternalSound
@@ -362,13 +366,20 @@ static void render_frame(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
     
+    // Draw game from the newest simulation snapshot - no lock needed, the
+    // sim thread keeps stepping while we draw
+    Visualizer *snapshot = sim_thread_acquire_snapshot(&gui->sim);
+    snapshot->width = int(GAME_WIDTH);
+    snapshot->height = int(GAME_HEIGHT);
+    draw_comet_buster_gl(snapshot, NULL);
+    
+    // Overlays read menu and score state straight from the live game
+    sim_thread_lock(&gui->sim);
+    
     // Game always in logical space
     gui->visualizer.width = int(GAME_WIDTH);
     gui->visualizer.height = int(GAME_HEIGHT);
     
-    // Draw game
-    draw_comet_buster_gl(&gui->visualizer, NULL);
-    
     // Render menu overlay if open
     
     // Render menu system (separated into comet_main_gl_menu.cpp)
@@ -700,13 +711,36 @@ static void render_frame(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI
         
     }
     
+    // Debug overlay (F3): frame pacing, frame timing and the quality
+    // governor's knobs
+    if (gui->visualizer.options.show_debug_info) {
+        char pacing_text[256];
+        char debug_text[256];
+        frame_sched_describe(&gui->frame_sched, pacing_text, sizeof(pacing_text));
+        quality_governor_describe(debug_text, sizeof(debug_text));
+        gl_set_debug_overlay(pacing_text, debug_text);
+        gl_draw_debug_overlay((int)GAME_WIDTH, (int)GAME_HEIGHT);
+    }
+    
+    sim_thread_unlock(&gui->sim);
+    
+    gl_end_frame();
+    quality_frame_work_done();
     SDL_GL_SwapWindow(gui->window);
 }
 
 static void cleanup(CometGUI *gui) {
+    // Stop simulating before anything the sim thread touches is torn down
+    sim_thread_shutdown(&gui->sim);
+    frame_sched_log_stats(&gui->frame_sched, "SDL");
+    replay_finish(&gui->replay);
+    
     // ✅ Cleanup touch input manager
     touch_manager_cleanup(&gui->visualizer.touch_manager);
 
+    // Join the update worker threads before the game state goes away
+    job_system_shutdown();
+
 #ifdef STEAM_ENABLED
     SteamAPI_Shutdown();
     SDL_Log("[Comet Busters] [STEAM] SteamAPI shut down\n");
@@ -718,16 +752,124 @@ static void cleanup(CometGUI *gui) {
     SDL_Quit();
 }
 
+// ============================================================
+// SIMULATION STEP (runs on the simulation thread)
+// ============================================================
+
+typedef struct {
+    CometGUI *gui;
+    HighScoreEntryUI *hs_entry;
+    bool splash_was_active;
+} SimStepContext;
+
+static void sim_step(void *user, double dt) {
+    SimStepContext *ctx = (SimStepContext *)user;
+    CometGUI *gui = ctx->gui;
+    
+    replay_before_step(&gui->replay, &gui->visualizer, &dt);
+    update_game(gui, ctx->hs_entry, dt);
+    
+    // ✅ UPDATE TOUCH INPUT - This makes ships follow your finger
+    update_touch_input(&gui->visualizer, &gui->visualizer.comet_buster, dt);
+    
+    // Detect splash screen exit and stop intro music (handles ALL exit methods)
+    if (ctx->splash_was_active && !gui->visualizer.comet_buster.splash_screen_active) {
+        SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP DETECTOR: Splash screen exited\n");
+        
+        // Always stop music when splash exits, regardless of what's playing
+        SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP: Stopping intro music...\n");
+        audio_stop_music(&gui->audio);
+        
+        SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP: Starting background music...\n");
+        audio_play_random_music(&gui->audio);
+        
+        SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP: Music transition complete\n");
+        ctx->splash_was_active = false;
+    } else if (!ctx->splash_was_active && gui->visualizer.comet_buster.splash_screen_active) {
+        // Splash screen reactivated (shouldn't happen normally)
+        SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP: Splash screen reactivated\n");
+        ctx->splash_was_active = true;
+    }
+    
+    replay_after_step(&gui->replay, &gui->visualizer);
+    
+    // Reset scroll wheel input after processing (for weapon changing)
+    gui->visualizer.scroll_direction = 0;
+}
+
 // ============================================================
 // MAIN
 // ============================================================
 
-int main(int argc __attribute__((unused)), char *argv[] __attribute__((unused))) {
+int main(int argc, char *argv[]) {
     SDL_Log("[Comet Busters] === Comet Busters ===\n");
     
     CometGUI gui;
     memset(&gui, 0, sizeof(CometGUI));
     
+#ifdef DEBUG
+    // Accuracy/speed of the fast trig paths and vector kernels on this machine,
+    // and how big the simulation state is
+    fm_self_check();
+    simd_self_check();
+    comet_buster_log_state_sizes();
+#endif
+    
+    // Replay record/check: seed rand() before anything uses it and keep the
+    // update stages on this thread so rand() is called in a fixed order
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--record-replay") == 0) {
+            replay_start_recording(&gui.replay, argv[i + 1], REPLAY_DEFAULT_SEED);
+        } else if (strcmp(argv[i], "--check-replay") == 0) {
+            replay_start_check(&gui.replay, argv[i + 1]);
+        }
+    }
+    if (gui.replay.mode != REPLAY_OFF) {
+        job_system_init(JOB_WORKERS_NONE);
+    }
+    
+    // Explosion debris is simulated on the GPU when the context allows it.
+    // Particles draw from their own generator, so replays recorded with
+    // either path check out with the other.
+    bool gpu_particle_test = false;
+    bool multiview_test = false;
+    bool math_test = false;
+    bool fixed_quality = false;
+    int target_fps_arg = -1;
+    bool no_vsync = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--cpu-particles") == 0) {
+            gl_set_gpu_particles_allowed(false);
+        } else if (strcmp(argv[i], "--fixed-quality") == 0) {
+            fixed_quality = true;
+        } else if (strcmp(argv[i], "--target-fps") == 0 && i + 1 < argc) {
+            target_fps_arg = atoi(argv[++i]);   // 0 = uncapped
+        } else if (strcmp(argv[i], "--no-vsync") == 0) {
+            no_vsync = true;
+        } else if (strcmp(argv[i], "--gpu-particle-test") == 0) {
+            gpu_particle_test = true;
+        } else if (strcmp(argv[i], "--multiview-test") == 0) {
+            multiview_test = true;
+        } else if (strcmp(argv[i], "--math-test") == 0) {
+            math_test = true;
+        }
+    }
+    
+    // Fast trig against libm and every vector kernel against the scalar
+    // one, then exit. Needs no window, so CI can run it anywhere:
+    //   ./cometbuster --math-test
+    if (math_test) {
+        bool pass = fm_self_check();
+        if (!simd_self_check()) pass = false;
+        return pass ? 0 : 1;
+    }
+    // Quality follows the measured frame time (quality_governor_init once
+    // the frame rate target is known). It only changes what is drawn, so
+    // replays play back the same at any level.
+    if (fixed_quality) {
+        quality_governor_set_enabled(false);
+    }
+    
     // Explicitly initialize preferences struct to avoid junk data
     memset(&gui.preferences, 0, sizeof(CometPreferences));
     
@@ -854,6 +996,34 @@ int main(int argc __attribute__((unused)), char *argv[] __attribute__((unused)))
         return 1;
     }
 
+    // Compare the GPU particle path with the CPU kernel and exit. Works on
+    // Mesa llvmpipe, so CI can run it without a GPU:
+    //   LIBGL_ALWAYS_SOFTWARE=1 xvfb-run ./cometbuster --gpu-particle-test
+    if (gpu_particle_test) {
+        gl_init();
+        bool pass = gl_gpu_particles_self_test();
+        SDL_GL_DeleteContext(gui.gl_context);
+        SDL_DestroyWindow(gui.window);
+        SDL_Quit();
+        return pass ? 0 : 1;
+    }
+
+    // Same for the OpenXR single-pass stereo path, against an offscreen
+    // texture array instead of a headset swapchain:
+    //   LIBGL_ALWAYS_SOFTWARE=1 xvfb-run ./cometbuster --multiview-test
+    if (multiview_test) {
+        gl_init();
+        bool pass = gl_multiview_self_test();
+        SDL_GL_DeleteContext(gui.gl_context);
+        SDL_DestroyWindow(gui.window);
+        SDL_Quit();
+        return pass ? 0 : 1;
+    }
+#ifdef DEBUG
+    gl_init();
+    gl_gpu_particles_self_test();
+#endif
+
 #ifdef STEAM_ENABLED
     if (!SteamAPI_Init()) {
         SDL_Log("[Comet Busters] [STEAM] WARNING: SteamAPI_Init() failed - Steam not running or steam_appid.txt missing\n");
@@ -944,6 +1114,21 @@ int main(int argc __attribute__((unused)), char *argv[] __attribute__((unused)))
     SDL_Log("[Comet Busters] [ANDROID] SDL/OpenGL initialized successfully\n");
 #endif
     
+    // Frame pacing from the game options; the window and GL context
+    // exist on every platform by now
+    gui.visualizer.options = game_options_default();
+    if (target_fps_arg >= 0) gui.visualizer.options.target_fps = target_fps_arg;
+    if (no_vsync) gui.visualizer.options.vsync_enabled = false;
+    if (SDL_GL_SetSwapInterval(gui.visualizer.options.vsync_enabled ? 1 : 0) != 0) {
+        SDL_Log("[Comet Busters] [FRAME] Swap interval not supported: %s\n", SDL_GetError());
+    }
+    SDL_DisplayMode display_mode;
+    int refresh_hz = SDL_GetWindowDisplayMode(gui.window, &display_mode) == 0 ? display_mode.refresh_rate : 0;
+    frame_sched_init(&gui.frame_sched, gui.visualizer.options.target_fps,
+                     SDL_GL_GetSwapInterval() != 0, refresh_hz);
+    quality_governor_init(gui.visualizer.options.target_fps,
+                          SDL_GL_GetSwapInterval() != 0 ? refresh_hz : 0);
+    
     // Copy audio to visualizer so game code can access it
     gui.visualizer.audio = gui.audio;
     
@@ -1002,8 +1187,6 @@ int main(int argc __attribute__((unused)), char *argv[] __attribute__((unused)))
     gui.last_axis_0_state = 0;      // Initialize axis state tracking
     gui.last_axis_1_state = 0;      // Initialize axis state tracking
     
-    bool splash_was_active = true;  // Track splash screen state for music stop
-    
     // Initialize local high score entry UI
     HighScoreEntryUI hs_entry;
     memset(&hs_entry, 0, sizeof(HighScoreEntryUI));
@@ -1019,31 +1202,30 @@ int main(int argc __attribute__((unused)), char *argv[] __attribute__((unused)))
     cheat_menu.missiles = 0;
     cheat_menu.bombs = 0;
     
-    // Main loop
-    gui.last_frame_ticks = SDL_GetTicks();
+    // Simulation step context - everything that advances game state runs
+    // on the simulation thread from here on
+    SimStepContext sim_ctx;
+    sim_ctx.gui = &gui;
+    sim_ctx.hs_entry = &hs_entry;
+    sim_ctx.splash_was_active = true;  // Track splash screen state for music stop
     
-    // ✅ PERFORMANCE MONITORING: FPS counter
-    static int fps_frame_count = 0;
-    static uint32_t fps_last_time = 0;
+    if (sim_thread_init(&gui.sim, &gui.visualizer, sim_step, &sim_ctx, SIM_DEFAULT_HZ)) {
+        sim_thread_start(&gui.sim);
+    }
     
+    // Main loop - frame pacing and the frame-time histogram live in
+    // gui.frame_sched (F3 shows them, cleanup() logs them)
     while (gui.running) {
-        uint32_t current_ticks = SDL_GetTicks();
-        gui.delta_time = (current_ticks - gui.last_frame_ticks) / 1000.0;
-        gui.last_frame_ticks = current_ticks;
+        quality_frame_begin();
+        gui.delta_time = frame_sched_begin(&gui.frame_sched);
         
         if (gui.delta_time > 0.033) gui.delta_time = 0.033;
         
         gui.total_time += gui.delta_time;
         gui.frame_count++;
         
-        // ✅ PERFORMANCE MONITORING: Update FPS counter
-/*        fps_frame_count++;
-        if (current_ticks - fps_last_time >= 1000) {
-            SDL_Log("[PERF] FPS: %d frames in 1000ms (delta: %.2f ms/frame)\n",  fps_frame_count, (current_ticks - fps_last_time) / (float)fps_frame_count);
-            fps_frame_count = 0;
-            fps_last_time = current_ticks;
-        }
-*/        
+        // Input and menus write straight into the live game
+        sim_thread_lock(&gui.sim);
         handle_events(&gui, &hs_entry, &cheat_menu);
 
 #ifndef ANDROID
@@ -1059,45 +1241,24 @@ int main(int argc __attribute__((unused)), char *argv[] __attribute__((unused)))
         }
 #endif
 
-        update_game(&gui, &hs_entry);
-
 #ifdef STEAM_ENABLED
         SteamAPI_RunCallbacks();
         handle_steam_input(&gui);  // Poll Steam Input and write to abstract key flags
 #endif
+        // Replay check ran out of recorded steps - results are in the log
+        if (gui.replay.finished) gui.running = false;
+        sim_thread_unlock(&gui.sim);
         
-        // ✅ UPDATE TOUCH INPUT - This makes ships follow your finger
-        update_touch_input(&gui.visualizer, &gui.visualizer.comet_buster, gui.delta_time);
-        
-        // Detect splash screen exit and stop intro music (handles ALL exit methods)
-        if (splash_was_active && !gui.visualizer.comet_buster.splash_screen_active) {
-            SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP DETECTOR: Splash screen exited\n");
-            
-            // Always stop music when splash exits, regardless of what's playing
-            SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP: Stopping intro music...\n");
-            audio_stop_music(&gui.audio);
-            
-            SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP: Starting background music...\n");
-            audio_play_random_music(&gui.audio);
-            
-            SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP: Music transition complete\n");
-            splash_was_active = false;
-        } else if (!splash_was_active && gui.visualizer.comet_buster.splash_screen_active) {
-            // Splash screen reactivated (shouldn't happen normally)
-            SDL_Log("[Comet Busters] [SPLASH] MAIN LOOP: Splash screen reactivated\n");
-            splash_was_active = true;
+        // No simulation thread (creation failed): step inline like before
+        if (!gui.sim.threaded) {
+            sim_thread_step(&gui.sim, gui.delta_time);
         }
         
-        // Reset scroll wheel input after processing (for weapon changing)
-        gui.visualizer.scroll_direction = 0;
-        
-        // Reset mouse_just_moved flag for next frame
-        //gui.visualizer.mouse_just_moved = false;
-        
         render_frame(&gui, &hs_entry, &cheat_menu);
         
-        uint32_t elapsed = SDL_GetTicks() - current_ticks;
-        if (elapsed < 16) SDL_Delay(16 - elapsed);
+        // Simulation keeps its own 60 Hz clock; presentation follows the
+        // target frame rate, or just vsync when that is already as fast
+        frame_sched_wait(&gui.frame_sched);
     }
     
     // SAVE PREFERENCES BEFORE EXITING
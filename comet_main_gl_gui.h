@@ -9,6 +9,9 @@
 #include "visualization.h"
 #include "comet_preferences.h"
 #include "comet_haptics.h"
+#include "comet_sim_thread.h"
+#include "comet_frame_scheduler.h"
+#include "comet_replay.h"
 
 typedef enum {
     HIGH_SCORE_ENTRY_NONE = 0,
@@ -79,7 +82,7 @@ typedef struct {
     int frame_count;
     double total_time;
     double delta_time;
-    uint32_t last_frame_ticks;
+    FrameScheduler frame_sched;  // Frame pacing and frame-time histogram
     
     // Joystick state
     SDL_Joystick *joystick;
@@ -89,6 +92,12 @@ typedef struct {
     int music_volume;
     int sfx_volume;
     CometPreferences preferences;  // Persistent user preferences (language, volumes)
+    
+    // Simulation runs on its own thread; render_frame draws its snapshots
+    SimThread sim;
+    
+    // --record-replay / --check-replay (see comet_replay.h)
+    ReplaySession replay;
 } CometGUI;
 
 typedef struct {
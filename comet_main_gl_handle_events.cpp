@@ -395,8 +395,9 @@ void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI *cheat
                     gui->visualizer.comet_buster.comet_count = 0;
                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                     gui->visualizer.comet_buster.bullet_count = 0;
-                    gui->visualizer.comet_buster.particle_count = 0;
+                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                     gui->visualizer.comet_buster.floating_text_count = 0;
                     gui->visualizer.comet_buster.canister_count = 0;
                     gui->visualizer.comet_buster.missile_count = 0;
@@ -497,8 +498,9 @@ void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI *cheat
                                     gui->visualizer.comet_buster.comet_count = 0;
                                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                                     gui->visualizer.comet_buster.bullet_count = 0;
-                                    gui->visualizer.comet_buster.particle_count = 0;
+                                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                                     gui->visualizer.comet_buster.missile_count = 0;
                                     
                                     // Spawn the new wave
@@ -783,8 +785,9 @@ void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI *cheat
                     gui->visualizer.comet_buster.comet_count = 0;
                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                     gui->visualizer.comet_buster.bullet_count = 0;
-                    gui->visualizer.comet_buster.particle_count = 0;
+                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                     gui->visualizer.comet_buster.floating_text_count = 0;
                     gui->visualizer.comet_buster.canister_count = 0;
                     gui->visualizer.comet_buster.missile_count = 0;
@@ -1177,8 +1180,9 @@ void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI *cheat
                                     gui->visualizer.comet_buster.comet_count = 0;
                                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                                     gui->visualizer.comet_buster.bullet_count = 0;
-                                    gui->visualizer.comet_buster.particle_count = 0;
+                                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                                     gui->visualizer.comet_buster.missile_count = 0;
                                     
                                     // Spawn the new wave
@@ -1229,8 +1233,9 @@ void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI *cheat
                     gui->visualizer.comet_buster.comet_count = 0;
                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                     gui->visualizer.comet_buster.bullet_count = 0;
-                    gui->visualizer.comet_buster.particle_count = 0;
+                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                     gui->visualizer.comet_buster.floating_text_count = 0;
                     gui->visualizer.comet_buster.canister_count = 0;
                     gui->visualizer.comet_buster.missile_count = 0;
@@ -1552,8 +1557,9 @@ void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI *cheat
                     gui->visualizer.comet_buster.comet_count = 0;
                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                     gui->visualizer.comet_buster.bullet_count = 0;
-                    gui->visualizer.comet_buster.particle_count = 0;
+                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                     gui->visualizer.comet_buster.floating_text_count = 0;
                     gui->visualizer.comet_buster.canister_count = 0;
                     gui->visualizer.comet_buster.missile_count = 0;
@@ -1853,8 +1859,9 @@ void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI *cheat
                     gui->visualizer.comet_buster.comet_count = 0;
                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                     gui->visualizer.comet_buster.bullet_count = 0;
-                    gui->visualizer.comet_buster.particle_count = 0;
+                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                     gui->visualizer.comet_buster.floating_text_count = 0;
                     gui->visualizer.comet_buster.canister_count = 0;
                     gui->visualizer.comet_buster.missile_count = 0;
@@ -2520,6 +2527,15 @@ void handle_keyboard_input(SDL_Event *event, CometGUI *gui, HighScoreEntryUI *hs
             gui->visualizer.key_q_pressed = pressed;
             gui->visualizer.mouse_just_moved = false;
             break;
+        case SDLK_F3:
+            gui->visualizer.mouse_just_moved = false;
+            if (pressed) {
+                gui->visualizer.options.show_debug_info = !gui->visualizer.options.show_debug_info;
+                SDL_Log("[Comet Busters] [INPUT] F3 - Debug overlay: %s\n",
+                        gui->visualizer.options.show_debug_info ? "ON" : "OFF");
+            }
+            break;
+        
         case SDLK_F5:
             gui->visualizer.mouse_just_moved = false;
             if (pressed) {
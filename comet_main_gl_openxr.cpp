@@ -21,6 +21,7 @@
 
 #include "cometbuster.h"
 #include "visualization.h"
+#include "cometbuster_drawlist.h"
 #include "audio_wad.h"
 #include "openxr_layer.h"
 
@@ -419,8 +420,9 @@ static void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI
                     gui->visualizer.comet_buster.comet_count = 0;
                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                     gui->visualizer.comet_buster.bullet_count = 0;
-                    gui->visualizer.comet_buster.particle_count = 0;
+                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                     gui->visualizer.comet_buster.floating_text_count = 0;
                     gui->visualizer.comet_buster.canister_count = 0;
                     gui->visualizer.comet_buster.missile_count = 0;
@@ -504,8 +506,9 @@ static void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI
                                     gui->visualizer.comet_buster.comet_count = 0;
                                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                                     gui->visualizer.comet_buster.bullet_count = 0;
-                                    gui->visualizer.comet_buster.particle_count = 0;
+                                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                                     gui->visualizer.comet_buster.missile_count = 0;
                                     
                                     // Spawn the new wave
@@ -684,8 +687,9 @@ static void handle_events(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI
                     gui->visualizer.comet_buster.comet_count = 0;
                     gui->visualizer.comet_buster.enemy_ship_count = 0;
                     gui->visualizer.comet_buster.enemy_bullet_count = 0;
+                    boss_bullet_pool_clear(&gui->visualizer.comet_buster.boss_bullets);
                     gui->visualizer.comet_buster.bullet_count = 0;
-                    gui->visualizer.comet_buster.particle_count = 0;
+                    comet_buster_clear_particles(&gui->visualizer.comet_buster);
                     gui->visualizer.comet_buster.floating_text_count = 0;
                     gui->visualizer.comet_buster.canister_count = 0;
                     gui->visualizer.comet_buster.missile_count = 0;
@@ -973,6 +977,40 @@ static void update_game(CometGUI *gui, HighScoreEntryUI *hs_entry) {
     }
 }
 
+// The game is a flat 16:9 screen hanging in front of the player. Maps
+// its 2D clip space onto that screen and through the eye's view and
+// projection.
+#define XR_SCREEN_WIDTH     3.2f    // Metres
+#define XR_SCREEN_DISTANCE  2.5f
+#define XR_SCREEN_CENTRE_Y  1.6f    // Above the stage floor
+
+static void xr_mat4_multiply(const float *a, const float *b, float *out) {
+    for (int col = 0; col < 4; col++) {
+        for (int row = 0; row < 4; row++) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; k++) {
+                sum += a[k * 4 + row] * b[col * 4 + k];
+            }
+            out[col * 4 + row] = sum;
+        }
+    }
+}
+
+static void xr_eye_transform(const float *proj, const float *view, float *out) {
+    float screen[16];
+    memset(screen, 0, sizeof(screen));
+    screen[0] = XR_SCREEN_WIDTH * 0.5f;
+    screen[5] = XR_SCREEN_WIDTH * (1080.0f / 1920.0f) * 0.5f;
+    screen[10] = 1.0f;
+    screen[13] = XR_SCREEN_CENTRE_Y;
+    screen[14] = -XR_SCREEN_DISTANCE;
+    screen[15] = 1.0f;
+    
+    float view_screen[16];
+    xr_mat4_multiply(view, screen, view_screen);
+    xr_mat4_multiply(proj, view_screen, out);
+}
+
 static void render_frame(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI *cheat_menu) {
     // IF USING VR - RENDER STEREO
     if (gui->use_xr) {
@@ -982,44 +1020,58 @@ static void render_frame(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI
             return;
         }
         
-        // Render to both eyes
+        // Game always in logical space. Build the frame once and replay
+        // it for each eye, so both eyes see the same state
+        gui->visualizer.width = 1920;
+        gui->visualizer.height = 1080;
+        static DrawList xr_list;
+        drawlist_build_game(&xr_list, &gui->visualizer.comet_buster, 1920, 1080);
+        
+        // Where the flat game screen lands in each eye
+        float eye_transforms[2][16];
+        int width = 0, height = 0;
         for (int eye = 0; eye < 2; eye++) {
             float proj[16], view[16];
-            int width, height;
-            
             openxr_get_eye_matrices(&gui->xr_ctx, eye, proj, view, &width, &height);
-            
-            // Acquire swapchain image for this eye
-            uint32_t swapchain_index = 0;
-            XrSwapchainImageAcquireInfo acquire_info;
-            memset(&acquire_info, 0, sizeof(acquire_info));
-            acquire_info.type = XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO;
-            xrAcquireSwapchainImage(gui->xr_ctx.swapchain, &acquire_info, &swapchain_index);
-            
-            // Bind eye framebuffer
-            glBindFramebuffer(GL_FRAMEBUFFER, gui->xr_ctx.swapchain_fbos[swapchain_index]);
-            glViewport(0, 0, width, height);
-            glClearColor(0.05f, 0.075f, 0.15f, 1.0f);
+            xr_eye_transform(proj, view, eye_transforms[eye]);
+        }
+        
+        // Acquire swapchain image (both eyes live in it)
+        uint32_t swapchain_index = 0;
+        XrSwapchainImageAcquireInfo acquire_info;
+        memset(&acquire_info, 0, sizeof(acquire_info));
+        acquire_info.type = XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO;
+        xrAcquireSwapchainImage(gui->xr_ctx.swapchain, &acquire_info, &swapchain_index);
+        
+        glViewport(0, 0, width, height);
+        glClearColor(0.05f, 0.075f, 0.15f, 1.0f);
+        
+        // Single pass: each draw reaches both eye layers
+        if (gui->xr_ctx.multiview &&
+            gl_begin_multiview(gui->xr_ctx.swapchain_fbos[swapchain_index])) {
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-            
-            // Setup projection
-            glMatrixMode(GL_PROJECTION);
-            glLoadIdentity();
-            glOrtho(0, 1920.0f, 1080.0f, 0, -1, 1);
-            glMatrixMode(GL_MODELVIEW);
-            glLoadIdentity();
-            
-            // Render game
-            gui->visualizer.width = 1920;
-            gui->visualizer.height = 1080;
-            draw_comet_buster_gl(&gui->visualizer, NULL);
-            
-            // Release swapchain image
-            XrSwapchainImageReleaseInfo release_info;
-            memset(&release_info, 0, sizeof(release_info));
-            release_info.type = XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO;
-            xrReleaseSwapchainImage(gui->xr_ctx.swapchain, &release_info);
+            gl_set_view_transforms(eye_transforms[0], 2);
+            draw_comet_buster_gl_list(&gui->visualizer, &xr_list);
+            gl_end_multiview();
+        } else {
+            // One pass per eye, each into its own layer
+            for (int eye = 0; eye < 2; eye++) {
+                glBindFramebuffer(GL_FRAMEBUFFER, gui->xr_ctx.swapchain_eye_fbos[swapchain_index * 2 + eye]);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                gl_set_view_transforms(eye_transforms[eye], 1);
+                draw_comet_buster_gl_list(&gui->visualizer, &xr_list);
+                gl_flush_batches();
+            }
         }
+        gl_set_view_transforms(NULL, 0);
+        
+        // Release swapchain image
+        XrSwapchainImageReleaseInfo release_info;
+        memset(&release_info, 0, sizeof(release_info));
+        release_info.type = XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO;
+        xrReleaseSwapchainImage(gui->xr_ctx.swapchain, &release_info);
+        
+        gl_end_frame();
         
         // Unbind framebuffer
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
@@ -1462,6 +1514,7 @@ static void render_frame(CometGUI *gui, HighScoreEntryUI *hs_entry, CheatMenuUI
         
     }
     
+    gl_end_frame();
     SDL_GL_SwapWindow(gui->window);
     }
 }
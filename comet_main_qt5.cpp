@@ -71,6 +71,7 @@
 
 #include "visualization.h"
 #include "audio_wad.h"
+#include "cometbuster_jobs.h"
 
 // Forward declarations of game functions (implemented in other .cpp files)
 extern void update_comet_buster(Visualizer *vis, double delta_time);
@@ -80,8 +81,8 @@ extern void draw_comet_buster(Visualizer *vis, cairo_t *cr);
 // CAIRO WIDGET IMPLEMENTATION
 // ============================================================
 
-CairoWidget::CairoWidget(Visualizer *vis, QWidget *parent)
-    : QWidget(parent), visualizer(vis) {
+CairoWidget::CairoWidget(Visualizer *vis, SimThread *sim_thread, FrameScheduler *frame_sched, QWidget *parent)
+    : QWidget(parent), visualizer(vis), sim(sim_thread), frameSched(frame_sched) {
     setFocusPolicy(Qt::StrongFocus);
     setAttribute(Qt::WA_OpaquePaintEvent);
     setMouseTracking(true);  // Enable continuous mouse move events
@@ -119,12 +120,17 @@ void CairoWidget::paintEvent(QPaintEvent *event) {
 
     cairo_t *cr = cairo_create(surface);
 
-    // Always render at 1920x1080
-    visualizer->width = game_width;
-    visualizer->height = game_height;
+    // Frame times are measured here, where frames are actually drawn -
+    // timer ticks that Qt coalesces into one paint are not frames
+    frame_sched_present(frameSched);
+
+    // Always render at 1920x1080, from the newest simulation snapshot
+    Visualizer *snapshot = sim_thread_acquire_snapshot(sim);
+    snapshot->width = game_width;
+    snapshot->height = game_height;
 
     // Call the game rendering function
-    draw_comet_buster(visualizer, cr);
+    draw_comet_buster(snapshot, cr);
 
     cairo_destroy(cr);
     cairo_surface_destroy(surface);
@@ -149,16 +155,21 @@ void CairoWidget::paintEvent(QPaintEvent *event) {
 
 void CairoWidget::keyPressEvent(QKeyEvent *event) {
     if (event->isAutoRepeat()) return;
+    sim_thread_lock(sim);
     handleKeyEvent(event, true);
+    sim_thread_unlock(sim);
 }
 
 void CairoWidget::keyReleaseEvent(QKeyEvent *event) {
     if (event->isAutoRepeat()) return;
+    sim_thread_lock(sim);
     handleKeyEvent(event, false);
+    sim_thread_unlock(sim);
 }
 
 void CairoWidget::mousePressEvent(QMouseEvent *event) {
     if (!visualizer) return;
+    sim_thread_lock(sim);
     
     // Transform widget coordinates to game coordinates (1920x1080)
     int game_x, game_y;
@@ -175,10 +186,12 @@ void CairoWidget::mousePressEvent(QMouseEvent *event) {
     } else if (event->button() == Qt::MiddleButton) {
         visualizer->mouse_middle_pressed = true;
     }
+    sim_thread_unlock(sim);
 }
 
 void CairoWidget::mouseReleaseEvent(QMouseEvent *event) {
     if (!visualizer) return;
+    sim_thread_lock(sim);
 
     if (event->button() == Qt::LeftButton) {
         visualizer->mouse_left_pressed = false;
@@ -187,10 +200,12 @@ void CairoWidget::mouseReleaseEvent(QMouseEvent *event) {
     } else if (event->button() == Qt::MiddleButton) {
         visualizer->mouse_middle_pressed = false;
     }
+    sim_thread_unlock(sim);
 }
 
 void CairoWidget::mouseMoveEvent(QMouseEvent *event) {
     if (!visualizer) return;
+    sim_thread_lock(sim);
     
     // Transform widget coordinates to game coordinates (1920x1080)
     int game_x, game_y;
@@ -202,16 +217,19 @@ void CairoWidget::mouseMoveEvent(QMouseEvent *event) {
     visualizer->last_mouse_y = game_y;
     visualizer->mouse_just_moved = true;
     visualizer->mouse_movement_timer = 2.0;
+    sim_thread_unlock(sim);
 }
 
 void CairoWidget::wheelEvent(QWheelEvent *event) {
     if (!visualizer) return;
+    sim_thread_lock(sim);
     
     if (event->angleDelta().y() > 0) {
         visualizer->scroll_direction = 1;
     } else if (event->angleDelta().y() < 0) {
         visualizer->scroll_direction = -1;
     }
+    sim_thread_unlock(sim);
 }
 
 void CairoWidget::transformMouseCoordinates(int widget_x, int widget_y, int &game_x, int &game_y) {
@@ -294,8 +312,8 @@ void CairoWidget::handleKeyEvent(QKeyEvent *event, bool pressed) {
 // OPENGL WIDGET IMPLEMENTATION
 // ============================================================
 
-GLWidget::GLWidget(Visualizer *vis, QWidget *parent)
-    : QOpenGLWidget(parent), visualizer(vis) {
+GLWidget::GLWidget(Visualizer *vis, SimThread *sim_thread, FrameScheduler *frame_sched, QWidget *parent)
+    : QOpenGLWidget(parent), visualizer(vis), sim(sim_thread), frameSched(frame_sched) {
     setFocusPolicy(Qt::StrongFocus);
     setMouseTracking(true);  // Enable continuous mouse move events
     
@@ -303,6 +321,7 @@ GLWidget::GLWidget(Visualizer *vis, QWidget *parent)
     QSurfaceFormat format;
     format.setVersion(3, 3);
     format.setProfile(QSurfaceFormat::CoreProfile);
+    format.setSwapInterval((!vis || vis->options.vsync_enabled) ? 1 : 0);
     setFormat(format);
 }
 
@@ -365,11 +384,13 @@ void GLWidget::paintGL() {
     );
 
     cairo_t *cr = cairo_create(surface);
-    visualizer->width = game_width;
-    visualizer->height = game_height;
+    frame_sched_present(frameSched);            // Drawn frames, not timer ticks
+    Visualizer *snapshot = sim_thread_acquire_snapshot(sim);
+    snapshot->width = game_width;
+    snapshot->height = game_height;
     
-    // Render game with Cairo
-    draw_comet_buster(visualizer, cr);
+    // Render game with Cairo (newest simulation snapshot)
+    draw_comet_buster(snapshot, cr);
     
     cairo_destroy(cr);
     cairo_surface_destroy(surface);
@@ -396,16 +417,21 @@ void GLWidget::paintGL() {
 
 void GLWidget::keyPressEvent(QKeyEvent *event) {
     if (event->isAutoRepeat()) return;
+    sim_thread_lock(sim);
     handleKeyEvent(event, true);
+    sim_thread_unlock(sim);
 }
 
 void GLWidget::keyReleaseEvent(QKeyEvent *event) {
     if (event->isAutoRepeat()) return;
+    sim_thread_lock(sim);
     handleKeyEvent(event, false);
+    sim_thread_unlock(sim);
 }
 
 void GLWidget::mousePressEvent(QMouseEvent *event) {
     if (!visualizer) return;
+    sim_thread_lock(sim);
     
     // Transform widget coordinates to game coordinates (1920x1080)
     int game_x, game_y;
@@ -422,10 +448,12 @@ void GLWidget::mousePressEvent(QMouseEvent *event) {
     } else if (event->button() == Qt::MiddleButton) {
         visualizer->mouse_middle_pressed = true;
     }
+    sim_thread_unlock(sim);
 }
 
 void GLWidget::mouseReleaseEvent(QMouseEvent *event) {
     if (!visualizer) return;
+    sim_thread_lock(sim);
 
     if (event->button() == Qt::LeftButton) {
         visualizer->mouse_left_pressed = false;
@@ -434,10 +462,12 @@ void GLWidget::mouseReleaseEvent(QMouseEvent *event) {
     } else if (event->button() == Qt::MiddleButton) {
         visualizer->mouse_middle_pressed = false;
     }
+    sim_thread_unlock(sim);
 }
 
 void GLWidget::mouseMoveEvent(QMouseEvent *event) {
     if (!visualizer) return;
+    sim_thread_lock(sim);
     
     // Transform widget coordinates to game coordinates (1920x1080)
     int game_x, game_y;
@@ -449,16 +479,19 @@ void GLWidget::mouseMoveEvent(QMouseEvent *event) {
     visualizer->last_mouse_y = game_y;
     visualizer->mouse_just_moved = true;
     visualizer->mouse_movement_timer = 2.0;
+    sim_thread_unlock(sim);
 }
 
 void GLWidget::wheelEvent(QWheelEvent *event) {
     if (!visualizer) return;
+    sim_thread_lock(sim);
     
     if (event->angleDelta().y() > 0) {
         visualizer->scroll_direction = 1;
     } else if (event->angleDelta().y() < 0) {
         visualizer->scroll_direction = -1;
     }
+    sim_thread_unlock(sim);
 }
 
 void GLWidget::handleKeyEvent(QKeyEvent *event, bool pressed) {
@@ -578,6 +611,11 @@ bool SettingsManager::saveVolumes(int musicVol, int sfxVol) {
 // COMET BUSTER WINDOW IMPLEMENTATION
 // ============================================================
 
+// Trampoline for SimThread (C callback -> member function)
+static void qt_sim_step(void *user, double dt) {
+    ((CometBusterWindow *)user)->simulationStep(dt);
+}
+
 CometBusterWindow::CometBusterWindow(QWidget *parent)
     : QMainWindow(parent), 
       gameTimer(nullptr),
@@ -654,13 +692,28 @@ CometBusterWindow::CometBusterWindow(QWidget *parent)
     fprintf(stdout, "[INIT] Showing splash screen\n");
     comet_buster_reset_game_with_splash(&visualizer.comet_buster, true, EASY);
     
+    // Frame pacing from the game options (GLWidget reads vsync_enabled)
+    visualizer.options = game_options_default();
+    frame_sched_init(&frameSched, visualizer.options.target_fps, visualizer.options.vsync_enabled, 0);
+    
+    // Simulation thread publishes snapshots the widgets draw from
+    sim_thread_init(&sim, &visualizer, qt_sim_step, this, SIM_DEFAULT_HZ);
+    
     // Create UI
     createUI();
     
-    // Setup game timer - 60 FPS
+    // Game state advances on the simulation thread; gameTimer only runs
+    // the Qt side (music, status bar, repaint requests)
+    sim_thread_start(&sim);
+    
+    // Game timer - single shot, re-armed by updateGame() for the next
+    // frame deadline. A repeating 16 ms coarse timer drifts against 60 Hz
+    // and may fire up to 5% late.
     gameTimer = new QTimer(this);
+    gameTimer->setTimerType(Qt::PreciseTimer);
+    gameTimer->setSingleShot(true);
     connect(gameTimer, &QTimer::timeout, this, &CometBusterWindow::updateGame);
-    gameTimer->start(16);  // ~60 FPS (16.67ms per frame)
+    gameTimer->start(0);
     
     // Start window maximized
     showMaximized();
@@ -678,21 +731,53 @@ CometBusterWindow::~CometBusterWindow() {
     if (gameTimer) {
         gameTimer->stop();
     }
+    sim_thread_shutdown(&sim);
+    frame_sched_log_stats(&frameSched, "Qt");
+    job_system_shutdown();
+    draw_comet_buster_cleanup();
     audio_cleanup(&audio);
     fprintf(stdout, "[CLEANUP] Game shutdown complete\n");
 }
 
+void CometBusterWindow::simulationStep(double dt) {
+    if (gamePaused) return;
+    
+    // Update game state
+    update_comet_buster(&visualizer, dt);
+    
+    // Reset scroll wheel input after processing
+    visualizer.scroll_direction = 0;
+}
+
 void CometBusterWindow::updateGame() {
     static int frameCounter = 0;
     static bool last_splash_screen_active = true;  // Track splash state for music transition
     static bool was_minimized = false;  // Track minimize state
     
+    // Re-arm first so early returns below keep the loop going. The
+    // widgets record the frame when they paint it.
+    frame_sched_advance(&frameSched);
+    gameTimer->start(frame_sched_delay_ms(&frameSched));
+    
+    // No simulation thread (creation failed): step inline like before
+    if (!sim.threaded) {
+        simulationStep(1.0 / 60.0);
+    }
+    
+    sim_thread_lock(&sim);
+    
+    // Sync audio state to visualizer. 'audio' only ever changes on this
+    // thread, so the copy is taken here under the lock rather than by
+    // the simulation thread while a menu handler is changing it.
+    visualizer.audio = audio;
+    
     // Pause game if minimized
     if (isMinimized() && !gamePaused && !visualizer.comet_buster.splash_screen_active) {
         gamePaused = true;
         audio_stop_music(&audio);
         was_minimized = true;
         fprintf(stdout, "[GAME] Window minimized - Game paused\n");
+        sim_thread_unlock(&sim);
         return;  // Don't update while minimized
     }
     
@@ -714,15 +799,6 @@ void CometBusterWindow::updateGame() {
     last_splash_screen_active = visualizer.comet_buster.splash_screen_active;
     
     if (!gamePaused) {
-        // Sync audio state to visualizer
-        visualizer.audio = audio;
-        
-        // Update game state
-        update_comet_buster(&visualizer, 1.0 / 60.0);
-        
-        // Reset scroll wheel input after processing
-        visualizer.scroll_direction = 0;
-        
         // Check if game ended and it's a high score
         if ((visualizer.comet_buster.game_over || visualizer.comet_buster.ship_lives <= 0) &&
             comet_buster_is_high_score(&visualizer.comet_buster, visualizer.comet_buster.score)) {
@@ -742,11 +818,14 @@ void CometBusterWindow::updateGame() {
         // Update status bar every 60 frames
         frameCounter++;
         if (frameCounter % 60 == 0) {
-            QString status = QString("Score: %1 | Lives: %2 | Wave: %3 | Bombs: %4")
+            char pacing[192];
+            frame_sched_describe(&frameSched, pacing, sizeof(pacing));
+            QString status = QString("Score: %1 | Lives: %2 | Wave: %3 | Bombs: %4 | %5")
                 .arg(visualizer.comet_buster.score)
                 .arg(visualizer.comet_buster.ship_lives)
                 .arg(visualizer.comet_buster.current_wave + 1)
-                .arg(visualizer.comet_buster.bomb_ammo);
+                .arg(visualizer.comet_buster.bomb_ammo)
+                .arg(QString::fromUtf8(pacing));
             statusLabel->setText(status);
         }
         
@@ -758,43 +837,53 @@ void CometBusterWindow::updateGame() {
             if (glWidget) glWidget->update();
         }
     }
+    
+    sim_thread_unlock(&sim);
 }
 
 void CometBusterWindow::onNewGameEasy() {
     audio_stop_music(&audio);
+    sim_thread_lock(&sim);
     comet_buster_reset_game_with_splash(&visualizer.comet_buster, false, EASY);
+    gamePaused = false;
+    sim_thread_unlock(&sim);
 #ifdef ExternalSound
     audio_play_music(&audio, "music/intro.mp3", false);
 #endif
-    gamePaused = false;
     statusLabel->setText("Game Started - Easy");
     fprintf(stdout, "[GAME] New game started - EASY\n");
 }
 
 void CometBusterWindow::onNewGameMedium() {
     audio_stop_music(&audio);
+    sim_thread_lock(&sim);
     comet_buster_reset_game_with_splash(&visualizer.comet_buster, false, MEDIUM);
+    gamePaused = false;
+    sim_thread_unlock(&sim);
 #ifdef ExternalSound
     audio_play_music(&audio, "music/intro.mp3", false);
 #endif
-    gamePaused = false;
     statusLabel->setText("Game Started - Medium");
     fprintf(stdout, "[GAME] New game started - MEDIUM\n");
 }
 
 void CometBusterWindow::onNewGameHard() {
     audio_stop_music(&audio);
+    sim_thread_lock(&sim);
     comet_buster_reset_game_with_splash(&visualizer.comet_buster, false, HARD);
+    gamePaused = false;
+    sim_thread_unlock(&sim);
 #ifdef ExternalSound
     audio_play_music(&audio, "music/intro.mp3", false);
 #endif
-    gamePaused = false;
     statusLabel->setText("Game Started - Hard");
     fprintf(stdout, "[GAME] New game started - HARD\n");
 }
 
 void CometBusterWindow::onTogglePause() {
+    sim_thread_lock(&sim);
     gamePaused = !gamePaused;
+    sim_thread_unlock(&sim);
     if (gamePaused) {
         audio_stop_music(&audio);
         statusLabel->setText("Game Paused");
@@ -946,8 +1035,8 @@ void CometBusterWindow::createUI() {
     renderingStack = new QStackedWidget();
     renderingStack->setMinimumWidth(1200);  // Game takes up more space on left
     
-    cairoWidget = new CairoWidget(&visualizer);
-    glWidget = new GLWidget(&visualizer);
+    cairoWidget = new CairoWidget(&visualizer, &sim, &frameSched);
+    glWidget = new GLWidget(&visualizer, &sim, &frameSched);
     
     renderingStack->addWidget(cairoWidget);
     renderingStack->addWidget(glWidget);
@@ -17,6 +17,8 @@
 #include "cometbuster.h"
 #include "visualization.h"
 #include "audio_wad.h"
+#include "comet_sim_thread.h"
+#include "comet_frame_scheduler.h"
 
 /**
  * Cairo Rendering Widget
@@ -26,7 +28,7 @@ class CairoWidget : public QWidget {
     Q_OBJECT
     
 public:
-    explicit CairoWidget(Visualizer *vis, QWidget *parent = nullptr);
+    explicit CairoWidget(Visualizer *vis, SimThread *sim, FrameScheduler *frame_sched, QWidget *parent = nullptr);
 
 protected:
     void paintEvent(QPaintEvent *event) override;
@@ -38,7 +40,9 @@ protected:
     void wheelEvent(QWheelEvent *event) override;
 
 private:
-    Visualizer *visualizer;
+    Visualizer *visualizer;                     // Live state (input only)
+    SimThread *sim;                             // Source of render snapshots
+    FrameScheduler *frameSched;                 // Frame-time histogram, recorded on paint
     
     /**
      * Handle key events for the visualizer
@@ -60,7 +64,7 @@ class GLWidget : public QOpenGLWidget {
     Q_OBJECT
     
 public:
-    explicit GLWidget(Visualizer *vis, QWidget *parent = nullptr);
+    explicit GLWidget(Visualizer *vis, SimThread *sim, FrameScheduler *frame_sched, QWidget *parent = nullptr);
 
 protected:
     void initializeGL() override;
@@ -75,7 +79,9 @@ protected:
     void wheelEvent(QWheelEvent *event) override;
 
 private:
-    Visualizer *visualizer;
+    Visualizer *visualizer;                     // Live state (input only)
+    SimThread *sim;                             // Source of render snapshots
+    FrameScheduler *frameSched;                 // Frame-time histogram, recorded on paint
     
     /**
      * Handle key events for the visualizer
@@ -98,10 +104,15 @@ class CometBusterWindow : public QMainWindow {
 public:
     explicit CometBusterWindow(QWidget *parent = nullptr);
     virtual ~CometBusterWindow();
+    
+    /**
+     * One fixed simulation step - runs on the simulation thread
+     */
+    void simulationStep(double dt);
 
 private slots:
     /**
-     * Game update loop - called ~60 times per second
+     * Game update loop - called target_fps times per second
      */
     void updateGame();
     
@@ -151,7 +162,7 @@ private:
     void loadHighScores(CometBusterGame *game);
     
     // UI Components
-    QTimer *gameTimer;                          // Game update timer (~60 FPS)
+    QTimer *gameTimer;                          // Game update timer (target_fps, re-armed each frame)
     QStackedWidget *renderingStack;             // Switches between Cairo/OpenGL
     CairoWidget *cairoWidget;                   // Cairo rendering surface
     GLWidget *glWidget;                         // OpenGL rendering surface
@@ -160,6 +171,8 @@ private:
     // Game State
     Visualizer visualizer;                      // Game visualization state
     AudioManager audio;                         // Audio system
+    SimThread sim;                              // Simulation thread + render snapshots
+    FrameScheduler frameSched;                  // Timer deadlines; widgets record frame times
     
     // Settings
     int musicVolume;                            // Current music volume (0-128)
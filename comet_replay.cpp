@@ -0,0 +1,251 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "comet_replay.h"
+
+// ============================================================================
+// FILE FORMAT
+// ============================================================================
+// Header, then one (ReplayInput, ReplayDigest) pair per simulation step.
+// Files are only meant to be read back on the machine that wrote them.
+
+typedef struct {
+    unsigned int magic;
+    unsigned int version;
+    unsigned int seed;
+    unsigned int input_size;
+    unsigned int digest_size;
+} ReplayHeader;
+
+static void replay_compute_digest(const Visualizer *vis, ReplayDigest *digest) {
+    const CometBusterGame *game = &vis->comet_buster;
+
+    memset(digest, 0, sizeof(ReplayDigest));
+    digest->ship_x = game->ship_x;
+    digest->ship_y = game->ship_y;
+    digest->ship_angle = game->ship_angle;
+
+    for (int i = 0; i < game->comet_count; i++) {
+        if (!game->comets[i].active) continue;
+        digest->comet_sum_x += game->comets[i].x;
+        digest->comet_sum_y += game->comets[i].y;
+    }
+
+    if (game->boss_active) {
+        digest->boss_x = game->boss.x;
+        digest->boss_y = game->boss.y;
+        digest->boss_health = game->boss.health;
+    }
+
+    digest->comet_count = game->comet_count;
+    digest->enemy_ship_count = game->enemy_ship_count;
+    digest->score = game->score;
+    digest->ship_lives = game->ship_lives;
+    digest->current_wave = game->current_wave;
+}
+
+// Largest position difference between two digests. The comet sums are
+// averaged so the tolerance stays per-comet rather than per-field.
+static double replay_position_error(const ReplayDigest *a, const ReplayDigest *b) {
+    double error = fabs(a->ship_x - b->ship_x);
+    error = fmax(error, fabs(a->ship_y - b->ship_y));
+    error = fmax(error, fabs(a->boss_x - b->boss_x));
+    error = fmax(error, fabs(a->boss_y - b->boss_y));
+
+    if (a->comet_count > 0) {
+        error = fmax(error, fabs(a->comet_sum_x - b->comet_sum_x) / a->comet_count);
+        error = fmax(error, fabs(a->comet_sum_y - b->comet_sum_y) / a->comet_count);
+    }
+    return error;
+}
+
+static bool replay_counters_match(const ReplayDigest *a, const ReplayDigest *b) {
+    return a->comet_count == b->comet_count &&
+           a->enemy_ship_count == b->enemy_ship_count &&
+           a->score == b->score &&
+           a->ship_lives == b->ship_lives &&
+           a->current_wave == b->current_wave &&
+           a->boss_health == b->boss_health;
+}
+
+// ============================================================================
+// SESSION CONTROL
+// ============================================================================
+
+bool replay_start_recording(ReplaySession *replay, const char *path, unsigned int seed) {
+    if (!replay || !path) return false;
+
+    memset(replay, 0, sizeof(ReplaySession));
+    replay->first_divergent_frame = -1;
+
+    replay->file = fopen(path, "wb");
+    if (!replay->file) {
+        SDL_Log("[Comet Busters] [REPLAY] ERROR: Cannot create %s\n", path);
+        return false;
+    }
+
+    ReplayHeader header;
+    header.magic = REPLAY_MAGIC;
+    header.version = REPLAY_VERSION;
+    header.seed = seed;
+    header.input_size = sizeof(ReplayInput);
+    header.digest_size = sizeof(ReplayDigest);
+    if (fwrite(&header, sizeof(header), 1, replay->file) != 1) {
+        SDL_Log("[Comet Busters] [REPLAY] ERROR: Failed to write header to %s\n", path);
+        fclose(replay->file);
+        replay->file = NULL;
+        return false;
+    }
+
+    replay->mode = REPLAY_RECORD;
+    replay->seed = seed;
+    srand(seed);
+
+    SDL_Log("[Comet Busters] [REPLAY] Recording to %s (seed %u)\n", path, seed);
+    return true;
+}
+
+bool replay_start_check(ReplaySession *replay, const char *path) {
+    if (!replay || !path) return false;
+
+    memset(replay, 0, sizeof(ReplaySession));
+    replay->first_divergent_frame = -1;
+
+    replay->file = fopen(path, "rb");
+    if (!replay->file) {
+        SDL_Log("[Comet Busters] [REPLAY] ERROR: Cannot open %s\n", path);
+        return false;
+    }
+
+    ReplayHeader header;
+    if (fread(&header, sizeof(header), 1, replay->file) != 1 ||
+        header.magic != REPLAY_MAGIC || header.version != REPLAY_VERSION ||
+        header.input_size != sizeof(ReplayInput) || header.digest_size != sizeof(ReplayDigest)) {
+        SDL_Log("[Comet Busters] [REPLAY] ERROR: %s is not a replay from this build\n", path);
+        fclose(replay->file);
+        replay->file = NULL;
+        return false;
+    }
+
+    replay->mode = REPLAY_CHECK;
+    replay->seed = header.seed;
+    srand(header.seed);
+
+    SDL_Log("[Comet Busters] [REPLAY] Checking against %s (seed %u)\n", path, header.seed);
+    return true;
+}
+
+void replay_finish(ReplaySession *replay) {
+    if (!replay || replay->mode == REPLAY_OFF) return;
+
+    if (replay->mode == REPLAY_RECORD) {
+        SDL_Log("[Comet Busters] [REPLAY] Recorded %u steps\n", replay->frame);
+    } else if (replay->first_divergent_frame < 0) {
+        SDL_Log("[Comet Busters] [REPLAY] PASS: %u steps match (max position error %.4f px)\n",
+                replay->frame, replay->max_position_error);
+    } else {
+        SDL_Log("[Comet Busters] [REPLAY] FAIL: first divergence at step %d, %u of %u steps differ "
+                "(max position error %.4f px)\n",
+                replay->first_divergent_frame, replay->divergent_frames, replay->frame,
+                replay->max_position_error);
+    }
+
+    if (replay->file) {
+        fclose(replay->file);
+        replay->file = NULL;
+    }
+    replay->mode = REPLAY_OFF;
+}
+
+// ============================================================================
+// PER-STEP HOOKS
+// ============================================================================
+
+void replay_before_step(ReplaySession *replay, Visualizer *vis, double *dt) {
+    if (!replay || !vis || !dt || !replay->file || replay->finished) return;
+
+    ReplayInput input;
+
+    if (replay->mode == REPLAY_RECORD) {
+        memset(&input, 0, sizeof(input));
+        input.dt = *dt;
+        input.mouse_x = vis->mouse_x;
+        input.mouse_y = vis->mouse_y;
+        input.scroll_direction = vis->scroll_direction;
+        input.mouse_left_pressed = vis->mouse_left_pressed;
+        input.mouse_right_pressed = vis->mouse_right_pressed;
+        input.mouse_middle_pressed = vis->mouse_middle_pressed;
+        input.key_a_pressed = vis->key_a_pressed;
+        input.key_d_pressed = vis->key_d_pressed;
+        input.key_w_pressed = vis->key_w_pressed;
+        input.key_s_pressed = vis->key_s_pressed;
+        input.key_z_pressed = vis->key_z_pressed;
+        input.key_x_pressed = vis->key_x_pressed;
+        input.key_space_pressed = vis->key_space_pressed;
+        input.key_ctrl_pressed = vis->key_ctrl_pressed;
+        input.key_q_pressed = vis->key_q_pressed;
+        fwrite(&input, sizeof(input), 1, replay->file);
+        return;
+    }
+
+    if (fread(&input, sizeof(input), 1, replay->file) != 1) {
+        // End of recording - stop overriding input and report
+        replay->finished = true;
+        replay_finish(replay);
+        return;
+    }
+
+    *dt = input.dt;
+    vis->mouse_x = input.mouse_x;
+    vis->mouse_y = input.mouse_y;
+    vis->scroll_direction = input.scroll_direction;
+    vis->mouse_left_pressed = input.mouse_left_pressed;
+    vis->mouse_right_pressed = input.mouse_right_pressed;
+    vis->mouse_middle_pressed = input.mouse_middle_pressed;
+    vis->key_a_pressed = input.key_a_pressed;
+    vis->key_d_pressed = input.key_d_pressed;
+    vis->key_w_pressed = input.key_w_pressed;
+    vis->key_s_pressed = input.key_s_pressed;
+    vis->key_z_pressed = input.key_z_pressed;
+    vis->key_x_pressed = input.key_x_pressed;
+    vis->key_space_pressed = input.key_space_pressed;
+    vis->key_ctrl_pressed = input.key_ctrl_pressed;
+    vis->key_q_pressed = input.key_q_pressed;
+}
+
+void replay_after_step(ReplaySession *replay, const Visualizer *vis) {
+    if (!replay || !vis || !replay->file || replay->finished) return;
+
+    ReplayDigest digest;
+    replay_compute_digest(vis, &digest);
+
+    if (replay->mode == REPLAY_RECORD) {
+        fwrite(&digest, sizeof(digest), 1, replay->file);
+        replay->frame++;
+        return;
+    }
+
+    ReplayDigest recorded;
+    if (fread(&recorded, sizeof(recorded), 1, replay->file) != 1) {
+        replay->finished = true;
+        replay_finish(replay);
+        return;
+    }
+
+    double error = replay_position_error(&recorded, &digest);
+    if (error > replay->max_position_error) {
+        replay->max_position_error = error;
+    }
+
+    if (error > REPLAY_POSITION_TOLERANCE || !replay_counters_match(&recorded, &digest)) {
+        if (replay->first_divergent_frame < 0) {
+            replay->first_divergent_frame = (int)replay->frame;
+            SDL_Log("[Comet Busters] [REPLAY] Divergence at step %u: ship (%.3f, %.3f) vs (%.3f, %.3f), "
+                    "score %d vs %d, comets %d vs %d\n",
+                    replay->frame, digest.ship_x, digest.ship_y, recorded.ship_x, recorded.ship_y,
+                    digest.score, recorded.score, digest.comet_count, recorded.comet_count);
+        }
+        replay->divergent_frames++;
+    }
+    replay->frame++;
+}
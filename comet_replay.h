@@ -0,0 +1,109 @@
+#ifndef COMET_REPLAY_H
+#define COMET_REPLAY_H
+
+#ifdef ANDROID
+#include <SDL.h>
+#else
+#include <SDL2/SDL.h>
+#endif
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "visualization.h"
+
+// ============================================================
+// INPUT REPLAY + SIMULATION EQUIVALENCE CHECK
+// ============================================================
+// Recording seeds rand(), then stores the gameplay input and the
+// step length of every simulation step together with a digest of
+// the resulting state (ship, comets, score, wave...).
+//
+// Checking seeds rand() the same way, feeds the recorded input
+// back in place of the live input and compares each new digest with
+// the recorded one. Positions must stay within
+// REPLAY_POSITION_TOLERANCE pixels, counters must match exactly.
+// Recording with the default double build and checking with a
+// -DSIM_FLOAT32 build shows whether float32 entities still play
+// the same game.
+//
+// Only the arcade inputs (mouse, movement/fire keys, scroll wheel)
+// are replayed. Joystick, touch and menu text entry are not.
+// Worker threads must be disabled while recording or checking so
+// rand() is called in the same order every run.
+// ============================================================
+
+#define REPLAY_MAGIC 0x59504C43         // "CLPY"
+#define REPLAY_VERSION 1
+#define REPLAY_DEFAULT_SEED 12345
+#define REPLAY_POSITION_TOLERANCE 0.5   // Pixels
+
+typedef enum {
+    REPLAY_OFF = 0,
+    REPLAY_RECORD,
+    REPLAY_CHECK
+} ReplayMode;
+
+// Gameplay input for one simulation step
+typedef struct {
+    double dt;
+    int mouse_x, mouse_y;
+    int scroll_direction;
+    bool mouse_left_pressed;
+    bool mouse_right_pressed;
+    bool mouse_middle_pressed;
+    bool key_a_pressed;
+    bool key_d_pressed;
+    bool key_w_pressed;
+    bool key_s_pressed;
+    bool key_z_pressed;
+    bool key_x_pressed;
+    bool key_space_pressed;
+    bool key_ctrl_pressed;
+    bool key_q_pressed;
+} ReplayInput;
+
+// State after one simulation step. Always stored as double so
+// recordings from double and float32 builds are interchangeable.
+typedef struct {
+    double ship_x, ship_y;
+    double ship_angle;
+    double comet_sum_x, comet_sum_y;    // Sum over active comets
+    double boss_x, boss_y;
+    int comet_count;
+    int enemy_ship_count;
+    int score;
+    int ship_lives;
+    int current_wave;
+    int boss_health;
+} ReplayDigest;
+
+typedef struct {
+    ReplayMode mode;
+    FILE *file;
+    unsigned int seed;
+    unsigned int frame;
+    bool finished;                  // Check ran out of recorded steps
+
+    // REPLAY_CHECK results
+    double max_position_error;
+    int first_divergent_frame;      // -1 while everything matches
+    unsigned int divergent_frames;
+} ReplaySession;
+
+// Open 'path' for writing and seed rand(). Call before the game is initialised.
+bool replay_start_recording(ReplaySession *replay, const char *path, unsigned int seed);
+
+// Open a recording for checking and seed rand() with its seed.
+bool replay_start_check(ReplaySession *replay, const char *path);
+
+// Before a simulation step: store the live input (record) or overwrite
+// it with the recorded input and step length (check).
+void replay_before_step(ReplaySession *replay, Visualizer *vis, double *dt);
+
+// After a simulation step: store (record) or compare (check) the digest.
+void replay_after_step(ReplaySession *replay, const Visualizer *vis);
+
+// Close the file and log the check summary
+void replay_finish(ReplaySession *replay);
+
+#endif // COMET_REPLAY_H
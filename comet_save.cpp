@@ -236,12 +236,12 @@ int menu_save_state(CometGUI *gui, int slot) {
 
     if (slot < 0 || slot > 10) return 0;
 
-    int version = 1;
+    int version = SAVE_STATE_VERSION;
     time_t now = time(NULL);
-    CometBusterGame *game = &gui->visualizer.comet_buster;
+    SimState *game = &gui->visualizer.comet_buster;
 
-    // ---- Build a flat buffer (header + game data) ----
-    size_t buf_size = sizeof(int) + sizeof(time_t) + sizeof(CometBusterGame);
+    // ---- Build a flat buffer (header + hot game state) ----
+    size_t buf_size = sizeof(int) + sizeof(time_t) + sizeof(SimState);
     uint8_t *buf = (uint8_t*)malloc(buf_size);
     if (!buf) {
         SDL_Log("[Comet Busters] [SAVE STATE] Out of memory\n");
@@ -250,7 +250,7 @@ int menu_save_state(CometGUI *gui, int slot) {
     size_t offset = 0;
     memcpy(buf + offset, &version, sizeof(int));          offset += sizeof(int);
     memcpy(buf + offset, &now,     sizeof(time_t));       offset += sizeof(time_t);
-    memcpy(buf + offset, game,     sizeof(CometBusterGame));
+    memcpy(buf + offset, game,     sizeof(SimState));
 
     // ---- Write local file ----
     ensure_save_dir();
@@ -292,10 +292,11 @@ int menu_load_state(CometGUI *gui, int slot) {
 
     if (slot < 0 || slot > 10) return 0;
 
-    CometBusterGame *game = &gui->visualizer.comet_buster;
-    int saved_language = game->current_language;
+    // Only the hot SimState part is saved - high scores, language and the
+    // other cold settings stay as they are
+    SimState *game = &gui->visualizer.comet_buster;
 
-    size_t buf_size = sizeof(int) + sizeof(time_t) + sizeof(CometBusterGame);
+    size_t buf_size = sizeof(int) + sizeof(time_t) + sizeof(SimState);
     uint8_t *buf = (uint8_t*)malloc(buf_size);
     if (!buf) {
         SDL_Log("[Comet Busters] [LOAD STATE] Out of memory\n");
@@ -309,9 +310,8 @@ int menu_load_state(CometGUI *gui, int slot) {
     if (steam_cloud_read(slot, buf, buf_size)) {
         int version;
         memcpy(&version, buf, sizeof(int));
-        if (version == 1) {
-            memcpy(game, buf + sizeof(int) + sizeof(time_t), sizeof(CometBusterGame));
-            game->current_language = saved_language;
+        if (version == SAVE_STATE_VERSION) {
+            memcpy(game, buf + sizeof(int) + sizeof(time_t), sizeof(SimState));
             SDL_Log("[Comet Busters] [LOAD STATE] State %d loaded from Steam Cloud (%zu bytes)\n",
                     slot, buf_size);
             loaded = 1;
@@ -343,7 +343,7 @@ int menu_load_state(CometGUI *gui, int slot) {
             return 0;
         }
 
-        if (version != 1) {
+        if (version != SAVE_STATE_VERSION) {
             SDL_Log("[Comet Busters] [LOAD STATE] Unsupported save version: %d\n", version);
             fclose(file);
             free(buf);
@@ -357,17 +357,16 @@ int menu_load_state(CometGUI *gui, int slot) {
             return 0;
         }
 
-        if (fread(game, sizeof(CometBusterGame), 1, file) != 1) {
+        if (fread(game, sizeof(SimState), 1, file) != 1) {
             SDL_Log("[Comet Busters] [LOAD STATE] Failed to read game state\n");
             fclose(file);
             free(buf);
             return 0;
         }
 
-        game->current_language = saved_language;
         fclose(file);
         SDL_Log("[Comet Busters] [LOAD STATE] State %d loaded from %s (%zu bytes)\n",
-                slot, filename, sizeof(CometBusterGame) + sizeof(int) + sizeof(time_t));
+                slot, filename, sizeof(SimState) + sizeof(int) + sizeof(time_t));
         loaded = 1;
     }
 
@@ -420,24 +419,27 @@ const char* menu_get_state_info(int slot) {
 
     int version;
     time_t timestamp;
-    CometBusterGame game;
     int read_ok = 0;
 
+    // SimState is a few hundred KB - keep it off the stack
+    SimState *game = (SimState *)malloc(sizeof(SimState));
+    if (!game) return "Error";
+
 #ifdef STEAM
     // Try reading header + game from Steam Cloud
     if (SteamRemoteStorage()) {
         char cloud_filename[64];
         get_steam_cloud_filename(slot, cloud_filename, sizeof(cloud_filename));
 
-        size_t buf_size = sizeof(int) + sizeof(time_t) + sizeof(CometBusterGame);
+        size_t buf_size = sizeof(int) + sizeof(time_t) + sizeof(SimState);
         uint8_t *buf = (uint8_t*)malloc(buf_size);
         if (buf) {
             int32 bytes_read = SteamRemoteStorage()->FileRead(cloud_filename, buf, (int32)buf_size);
             if (bytes_read == (int32)buf_size) {
                 memcpy(&version,   buf,                                        sizeof(int));
                 memcpy(&timestamp, buf + sizeof(int),                          sizeof(time_t));
-                memcpy(&game,      buf + sizeof(int) + sizeof(time_t),         sizeof(CometBusterGame));
-                read_ok = (version == 1);
+                memcpy(game,       buf + sizeof(int) + sizeof(time_t),         sizeof(SimState));
+                read_ok = (version == SAVE_STATE_VERSION);
             }
             free(buf);
         }
@@ -450,25 +452,34 @@ const char* menu_get_state_info(int slot) {
         get_state_filename(slot, filename, sizeof(filename));
 
         FILE *file = fopen(filename, "rb");
-        if (!file) return "Error";
+        if (!file) {
+            free(game);
+            return "Error";
+        }
 
         if (fread(&version,   sizeof(int),           1, file) != 1 ||
             fread(&timestamp, sizeof(time_t),         1, file) != 1 ||
-            fread(&game,      sizeof(CometBusterGame),1, file) != 1) {
+            version != SAVE_STATE_VERSION ||
+            fread(game,       sizeof(SimState),       1, file) != 1) {
             fclose(file);
+            free(game);
             return "Error";
         }
         fclose(file);
         read_ok = 1;
     }
 
-    if (!read_ok) return "Error";
+    if (!read_ok) {
+        free(game);
+        return "Error";
+    }
 
     // Format: "Wave X | Score Y | HH:MM"
     struct tm *timeinfo = localtime(&timestamp);
     snprintf(state_info_buffer, sizeof(state_info_buffer),
              "Wave %d | Score %d | %02d:%02d",
-             game.current_wave, game.score, timeinfo->tm_hour, timeinfo->tm_min);
+             game->current_wave, game->score, timeinfo->tm_hour, timeinfo->tm_min);
+    free(game);
 
     return state_info_buffer;
 }
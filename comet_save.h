@@ -5,6 +5,20 @@
 // SAVE/LOAD STATE MANAGEMENT
 // ============================================================
 
+// Save slots hold the hot SimState only. Version 1 stored the whole
+// CometBusterGame and is no longer readable; version 2 predates the
+// GPU particle spawn ring, version 3 the 4096-bullet boss pool,
+// version 4 the cosmetic particle generator.
+//
+// SIM_FLOAT32 builds lay SimState out differently, so they tag the
+// version and each build turns the other's slots away.
+#ifdef SIM_FLOAT32
+#define SAVE_STATE_PRECISION_TAG 0x100
+#else
+#define SAVE_STATE_PRECISION_TAG 0
+#endif
+#define SAVE_STATE_VERSION (5 | SAVE_STATE_PRECISION_TAG)
+
 /**
  * Saves the current game state to a slot (0-9)
  * Returns 1 on success, 0 on failure
@@ -0,0 +1,163 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "comet_sim_thread.h"
+#include "comet_frame_scheduler.h"
+
+// ============================================================================
+// TRIPLE-BUFFERED SNAPSHOTS
+// ============================================================================
+
+#define SIM_SNAPSHOT_INDEX_MASK 0x3
+
+// Copy the live state into the back slot and swap it into the middle
+static void sim_publish_snapshot(SimThread *sim) {
+    SimSnapshotBuffer *buf = &sim->snapshots;
+
+    memcpy(buf->slots[buf->back], sim->live, sizeof(Visualizer));
+
+    // SDL_AtomicSet returns the previous value - the slot we get back is
+    // either the renderer's old front or a snapshot it never looked at
+    int previous = SDL_AtomicSet(&buf->middle, buf->back | SIM_SNAPSHOT_FRESH);
+    buf->back = previous & SIM_SNAPSHOT_INDEX_MASK;
+}
+
+Visualizer* sim_thread_acquire_snapshot(SimThread *sim) {
+    if (!sim) return NULL;
+    if (!sim->threaded) return sim->live;
+
+    SimSnapshotBuffer *buf = &sim->snapshots;
+    if (SDL_AtomicGet(&buf->middle) & SIM_SNAPSHOT_FRESH) {
+        int previous = SDL_AtomicSet(&buf->middle, buf->front);
+        buf->front = previous & SIM_SNAPSHOT_INDEX_MASK;
+    }
+    return buf->slots[buf->front];
+}
+
+// ============================================================================
+// SIMULATION THREAD
+// ============================================================================
+
+static int sim_thread_main(void *data) {
+    SimThread *sim = (SimThread *)data;
+
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    Uint64 step_ticks = (Uint64)(sim->step_seconds * (double)freq);
+    Uint64 next_step = SDL_GetPerformanceCounter();
+
+    if (step_ticks == 0) step_ticks = 1;
+
+    while (SDL_AtomicGet(&sim->running)) {
+        Uint64 now = SDL_GetPerformanceCounter();
+
+        if (now < next_step) {
+            frame_sched_sleep_until(next_step);
+            continue;
+        }
+
+        SDL_LockMutex(sim->lock);
+        sim->step_func(sim->user, sim->step_seconds);
+        sim_publish_snapshot(sim);
+        SDL_UnlockMutex(sim->lock);
+
+        sim->steps_simulated++;
+        next_step += step_ticks;
+
+        // Fell far behind (window drag, debugger, suspend) - don't try to catch up
+        if (now > next_step + step_ticks * 5) {
+            next_step = now + step_ticks;
+        }
+    }
+    return 0;
+}
+
+bool sim_thread_init(SimThread *sim, Visualizer *live, SimStepFunc step_func, void *user, int hz) {
+    if (!sim || !live || !step_func) return false;
+
+    memset(sim, 0, sizeof(SimThread));
+    sim->live = live;
+    sim->step_func = step_func;
+    sim->user = user;
+    sim->step_seconds = 1.0 / (hz > 0 ? hz : SIM_DEFAULT_HZ);
+
+    for (int i = 0; i < SIM_SNAPSHOT_COUNT; i++) {
+        sim->snapshots.slots[i] = (Visualizer *)malloc(sizeof(Visualizer));
+        if (!sim->snapshots.slots[i]) {
+            SDL_Log("[Comet Busters] [SIM] ERROR: Failed to allocate render snapshot %d\n", i);
+            sim_thread_shutdown(sim);
+            return false;
+        }
+    }
+
+    sim->snapshots.back = 0;
+    sim->snapshots.front = 2;
+    SDL_AtomicSet(&sim->snapshots.middle, 1);
+    return true;
+}
+
+bool sim_thread_start(SimThread *sim) {
+    if (!sim || !sim->snapshots.slots[0] || sim->threaded) return false;
+
+    sim->lock = SDL_CreateMutex();
+    if (!sim->lock) {
+        SDL_Log("[Comet Busters] [SIM] WARNING: Could not create mutex, simulating on the main thread\n");
+        return false;
+    }
+
+    // Every slot starts as a copy of the current state so the renderer
+    // never sees an uninitialized snapshot
+    for (int i = 0; i < SIM_SNAPSHOT_COUNT; i++) {
+        memcpy(sim->snapshots.slots[i], sim->live, sizeof(Visualizer));
+    }
+
+    SDL_AtomicSet(&sim->running, 1);
+    sim->threaded = true;
+    sim->thread = SDL_CreateThread(sim_thread_main, "CometSimulation", sim);
+    if (!sim->thread) {
+        SDL_Log("[Comet Busters] [SIM] WARNING: Failed to create simulation thread: %s\n", SDL_GetError());
+        SDL_AtomicSet(&sim->running, 0);
+        sim->threaded = false;
+        SDL_DestroyMutex(sim->lock);
+        sim->lock = NULL;
+        return false;
+    }
+
+    SDL_Log("[Comet Busters] [SIM] Simulation thread started (%.0f Hz)\n", 1.0 / sim->step_seconds);
+    return true;
+}
+
+void sim_thread_shutdown(SimThread *sim) {
+    if (!sim) return;
+
+    if (sim->thread) {
+        SDL_AtomicSet(&sim->running, 0);
+        SDL_WaitThread(sim->thread, NULL);
+        sim->thread = NULL;
+        SDL_Log("[Comet Busters] [SIM] Simulation thread stopped after %u steps\n", sim->steps_simulated);
+    }
+    sim->threaded = false;
+
+    if (sim->lock) {
+        SDL_DestroyMutex(sim->lock);
+        sim->lock = NULL;
+    }
+
+    for (int i = 0; i < SIM_SNAPSHOT_COUNT; i++) {
+        free(sim->snapshots.slots[i]);
+        sim->snapshots.slots[i] = NULL;
+    }
+}
+
+void sim_thread_step(SimThread *sim, double dt) {
+    if (!sim || sim->threaded) return;
+    sim->step_func(sim->user, dt);
+    sim->steps_simulated++;
+}
+
+void sim_thread_lock(SimThread *sim) {
+    if (sim && sim->lock) SDL_LockMutex(sim->lock);
+}
+
+void sim_thread_unlock(SimThread *sim) {
+    if (sim && sim->lock) SDL_UnlockMutex(sim->lock);
+}
@@ -0,0 +1,86 @@
+#ifndef COMET_SIM_THREAD_H
+#define COMET_SIM_THREAD_H
+
+#ifdef ANDROID
+#include <SDL.h>
+#else
+#include <SDL2/SDL.h>
+#endif
+
+#include <stdbool.h>
+#include "visualization.h"
+
+// ============================================================
+// SIMULATION THREAD + RENDER SNAPSHOTS
+// ============================================================
+// The game simulation runs on its own thread at a fixed rate and
+// publishes a copy of the visible state (the whole Visualizer, which
+// embeds CometBusterGame) after every step. The renderer always draws
+// from the newest published copy, so simulation and rendering of
+// consecutive frames overlap instead of running back to back.
+//
+// Snapshots are triple-buffered with a lock-free handoff:
+//   - the sim thread owns the "back" slot and fills it
+//   - the render thread owns the "front" slot and draws it
+//   - the third slot sits in an atomic "middle" word; both sides
+//     swap their slot with it, the FRESH bit marks unseen data
+// Neither side ever waits on the other.
+//
+// Anything the front-end does to the live game from its own thread
+// (input handlers that reset the game, menu actions, music logic)
+// must be wrapped in sim_thread_lock()/sim_thread_unlock().
+//
+// If the thread can't be created the front-end keeps calling
+// sim_thread_step() itself and acquire returns the live state.
+// ============================================================
+
+#define SIM_SNAPSHOT_COUNT 3
+#define SIM_SNAPSHOT_FRESH 0x4      // Set in 'middle' when it holds an unseen snapshot
+#define SIM_DEFAULT_HZ 60
+
+typedef void (*SimStepFunc)(void *user, double dt);
+
+typedef struct {
+    Visualizer *slots[SIM_SNAPSHOT_COUNT];
+    SDL_atomic_t middle;            // Slot index | SIM_SNAPSHOT_FRESH
+    int back;                       // Owned by the sim thread
+    int front;                      // Owned by the render thread
+} SimSnapshotBuffer;
+
+typedef struct {
+    Visualizer *live;               // State the simulation writes to
+    SimStepFunc step_func;          // One fixed step of front-end update logic
+    void *user;
+    double step_seconds;
+
+    SDL_Thread *thread;
+    SDL_mutex *lock;                // Guards 'live' between sim and UI threads
+    SDL_atomic_t running;
+    bool threaded;
+
+    SimSnapshotBuffer snapshots;
+    Uint32 steps_simulated;
+} SimThread;
+
+// Allocate snapshot slots. hz <= 0 uses SIM_DEFAULT_HZ.
+bool sim_thread_init(SimThread *sim, Visualizer *live, SimStepFunc step_func, void *user, int hz);
+
+// Start the simulation thread. Returns false (and stays single-threaded)
+// if the thread can't be created.
+bool sim_thread_start(SimThread *sim);
+
+// Stop and join the thread, then free the snapshot slots
+void sim_thread_shutdown(SimThread *sim);
+
+// Single-threaded fallback: run one step on the caller's thread
+void sim_thread_step(SimThread *sim, double dt);
+
+// Exclusive access to the live state from the UI thread
+void sim_thread_lock(SimThread *sim);
+void sim_thread_unlock(SimThread *sim);
+
+// Newest published state for drawing. Only call from the render thread.
+// The returned copy is private to the renderer until the next acquire.
+Visualizer* sim_thread_acquire_snapshot(SimThread *sim);
+
+#endif // COMET_SIM_THREAD_H
@@ -9,11 +9,13 @@
 #endif
 #include "cometbuster_bossexplosion.h"
 #include "comet_haptics.h"
+#include "cometbuster_patterns.h"
 
 // Static memory allocation constants
 #define MAX_COMETS 128
 #define MAX_BULLETS 128
 #define MAX_PARTICLES 2048  // Increased for massive explosions
+#define MAX_PARTICLE_SPAWNS 1024  // GPU particle spawn ring
 #define MAX_FLOATING_TEXT 32
 #define MAX_CANISTERS 32
 #define MAX_MISSILES 64
@@ -31,6 +33,15 @@
 #define M_PI 3.1415926535
 #endif
 
+// Scalar type for the hot entity arrays (comets, bullets, particles,
+// missiles, enemy ships, bosses). Build with -DSIM_FLOAT32 to halve their
+// footprint; player/game-level state stays double either way.
+#ifdef SIM_FLOAT32
+typedef float sim_real;
+#else
+typedef double sim_real;
+#endif
+
 typedef enum {
     COMET_SMALL = 0,
     COMET_MEDIUM = 1,
@@ -46,39 +57,50 @@ typedef enum {
 } CometDifficulty;
 
 typedef struct {
-    double x, y;                // Position
-    double vx, vy;              // Velocity
-    double radius;
+    sim_real x, y;                // Position
+    sim_real vx, vy;              // Velocity
+    sim_real radius;
     CometSize size;
     int frequency_band;         // 0=bass, 1=mid, 2=treble
-    double rotation;            // For rotating visual (degrees)
-    double rotation_speed;      // degrees per second
-    double base_angle;          // Base rotation angle (radians) for vector asteroids
-    double color[3];            // RGB
+    sim_real rotation;            // For rotating visual (degrees)
+    sim_real rotation_speed;      // degrees per second
+    sim_real base_angle;          // Base rotation angle (radians) for vector asteroids
+    sim_real color[3];            // RGB
     bool active;
     int health;                 // For special comets
 } Comet;
 
 typedef struct {
-    double x, y;                // Position
-    double vx, vy;              // Velocity
-    double angle;               // Direction
-    double lifetime;            // Seconds remaining
-    double max_lifetime;
+    sim_real x, y;                // Position
+    sim_real vx, vy;              // Velocity
+    sim_real angle;               // Direction
+    sim_real lifetime;            // Seconds remaining
+    sim_real max_lifetime;
     bool active;
     int owner_ship_id;
 } Bullet;
 
 typedef struct {
-    double x, y;                // Position
-    double vx, vy;              // Velocity
-    double lifetime;            // Seconds remaining
-    double max_lifetime;
-    double size;                // Radius
-    double color[3];            // RGB
+    sim_real x, y;                // Position
+    sim_real vx, vy;              // Velocity
+    sim_real lifetime;            // Seconds remaining
+    sim_real max_lifetime;
+    sim_real size;                // Radius
+    sim_real color[3];            // RGB
     bool active;
 } Particle;
 
+// A cosmetic particle handed to the GL renderer's GPU simulation instead
+// of particles[] (see comet_buster_set_gpu_particles). Floats, because
+// the renderer copies them straight into its particle buffer.
+typedef struct {
+    float x, y;
+    float vx, vy;
+    float lifetime;
+    float size;
+    float color[3];
+} ParticleSpawn;
+
 typedef struct {
     double x, y;                // Position
     double lifetime;            // Seconds remaining
@@ -99,17 +121,17 @@ typedef struct {
 } Canister;
 
 typedef struct {
-    double x, y;                // Position
-    double vx, vy;              // Velocity
-    double angle;               // Direction
-    double lifetime;            // Seconds remaining
-    double max_lifetime;
-    double target_x, target_y;  // Target position (for tracking)
+    sim_real x, y;                // Position
+    sim_real vx, vy;              // Velocity
+    sim_real angle;               // Direction
+    sim_real lifetime;            // Seconds remaining
+    sim_real max_lifetime;
+    sim_real target_x, target_y;  // Target position (for tracking)
     int target_id;              // ID of target (-1 = no target)
     bool active;
     bool has_target;            // Is tracking a target?
-    double turn_speed;          // How fast missile can turn (degrees/sec)
-    double speed;               // Missile speed (faster than bullets)
+    sim_real turn_speed;          // How fast missile can turn (degrees/sec)
+    sim_real speed;               // Missile speed (faster than bullets)
     int missile_type;           // 0-4 based on targeting behavior (type 0: furthest, 1: ships/boss, 2: closest comets, 3: comets ~400px, 4: comets 200-600px)
     int owner_ship_id;          // ID of ship that fired this missile (-1 if player, ship index if enemy)
 } Missile;
@@ -170,13 +192,13 @@ typedef struct {
 } KeyboardInput;
 
 typedef struct {
-    double x, y;                // Position
-    double vx, vy;              // Velocity
-    double angle;               // Direction facing
+    sim_real x, y;                // Position
+    sim_real vx, vy;              // Velocity
+    sim_real angle;               // Direction facing
     int health;                 // 1 hit = destroyed
-    double shoot_cooldown;      // Time until next shot
-    double path_time;           // Time along sine wave path (for wave motion)
-    double base_vx, base_vy;    // Original velocity direction (for sine calculation)
+    sim_real shoot_cooldown;      // Time until next shot
+    sim_real path_time;           // Time along sine wave path (for wave motion)
+    sim_real base_vx, base_vy;    // Original velocity direction (for sine calculation)
     int ship_type;              // 0 = patrol (blue), 1 = aggressive (red), 2 = hunter (green), 
                                 // 3 = sentinel (purple), 4 = brown coat (elite blue), 5 = juggernaut (massive gold)
     bool active;
@@ -184,34 +206,34 @@ typedef struct {
     // Shield system for enemy ships
     int shield_health;          // Current shield points
     int max_shield_health;      // Maximum shield points (varies by ship type)
-    double shield_impact_timer; // Visual impact effect timer
-    double shield_impact_angle; // Angle of shield impact
+    sim_real shield_impact_timer; // Visual impact effect timer
+    sim_real shield_impact_angle; // Angle of shield impact
     
     // Sentinel formation system
     int formation_id;           // Groups sentinels that spawned together (-1 if not sentinel)
     int formation_size;         // How many sentinels in this formation (1, 2, or 3)
     bool has_partner;           // Is the paired sentinel still alive?
-    double formation_cohesion;  // How tightly they stay together (0.0-1.0)
+    sim_real formation_cohesion;  // How tightly they stay together (0.0-1.0)
     
     // Patrol behavior system (for blue/green/purple ships)
-    double patrol_behavior_timer;   // Timer for current patrol behavior
-    double patrol_behavior_duration;// How long to maintain current behavior
+    sim_real patrol_behavior_timer;   // Timer for current patrol behavior
+    sim_real patrol_behavior_duration;// How long to maintain current behavior
     int patrol_behavior_type;       // 0=straight, 1=circle, 2=evasive turns
-    double patrol_circle_center_x;  // Center of circle when doing circular behavior
-    double patrol_circle_center_y;
-    double patrol_circle_radius;    // Radius of circular path
-    double patrol_circle_angle;     // Current angle in circle (radians)
+    sim_real patrol_circle_center_x;  // Center of circle when doing circular behavior
+    sim_real patrol_circle_center_y;
+    sim_real patrol_circle_radius;    // Radius of circular path
+    sim_real patrol_circle_angle;     // Current angle in circle (radians)
     
     // BROWN COAT SPECIFIC FIELDS (NEW)
-    double burst_fire_cooldown;     // Cooldown until next omnidirectional burst
-    double burst_trigger_range;     // Distance at which to trigger burst (200-300 px)
+    sim_real burst_fire_cooldown;     // Cooldown until next omnidirectional burst
+    sim_real burst_trigger_range;     // Distance at which to trigger burst (200-300 px)
     int last_burst_direction;       // Last burst angle offset (for visual variety)
-    double proximity_detection_timer; // Timer to check for nearby targets
+    sim_real proximity_detection_timer; // Timer to check for nearby targets
     int burst_count_this_wave;      // Track how many bursts fired this encounter
     
     // THRUSTER/BURNER EFFECT FIELDS
-    double burner_flicker_timer;    // For flickering flame effect
-    double burner_intensity;        // How bright/large the burner is (0.0-1.0)
+    sim_real burner_flicker_timer;    // For flickering flame effect
+    sim_real burner_intensity;        // How bright/large the burner is (0.0-1.0)
     
 } EnemyShip;
 
@@ -246,57 +268,57 @@ typedef struct {
 
 // Boss (Death Star) structure
 typedef struct {
-    double x, y;                // Position
-    double vx, vy;              // Velocity
-    double angle;               // Direction facing
+    sim_real x, y;                // Position
+    sim_real vx, vy;              // Velocity
+    sim_real angle;               // Direction facing
     int health;                 // Boss health (large number like 50-100)
     int max_health;             // Maximum health
-    double shoot_cooldown;      // Time until next shot
+    sim_real shoot_cooldown;      // Time until next shot
     int phase;                  // 0 = normal, 1 = shield up, 2 = enraged
-    double phase_timer;         // Time in current phase
-    double phase_duration;      // How long until phase changes
+    sim_real phase_timer;         // Time in current phase
+    sim_real phase_duration;      // How long until phase changes
     
     // Shield system
     int shield_health;          // Shield durability (10-20 points)
     int max_shield_health;      // Maximum shield durability
     bool shield_active;         // Is shield currently up?
-    double shield_impact_timer; // Visual effect
-    double shield_impact_angle; // Where shield was hit
+    sim_real shield_impact_timer; // Visual effect
+    sim_real shield_impact_angle; // Where shield was hit
     
     // Firing pattern
-    double fire_pattern_timer;  // For special firing patterns
+    sim_real fire_pattern_timer;  // For special firing patterns
     int fire_pattern;           // Different firing modes
     
     // Visual effects
-    double rotation;            // Visual rotation
-    double rotation_speed;
-    double damage_flash_timer;  // Flash when taking damage
+    sim_real rotation;            // Visual rotation
+    sim_real rotation_speed;
+    sim_real damage_flash_timer;  // Flash when taking damage
     
     bool active;                // Is the boss alive?
 
     int fragment_count;           // Number of active fragments (0 = main, 1+ = split)
-    double fragment_positions[4][2];  // X,Y positions of up to 4 fragments
+    sim_real fragment_positions[4][2];  // X,Y positions of up to 4 fragments
     int fragment_health[4];       // Health of each fragment
     bool is_fragment;             // Is this a fragment or main body?
     int fragment_id;              // Which fragment number (0-3)
-    double fragment_reunite_timer; // Time until fragments try to reunite
-    double reunite_speed;         // How fast they move back together
-    double last_damage_time;      // For tracking damage frequency
+    sim_real fragment_reunite_timer; // Time until fragments try to reunite
+    sim_real reunite_speed;         // How fast they move back together
+    sim_real last_damage_time;      // For tracking damage frequency
     int burst_angle_offset;       // For rotating firing pattern
-    double nexus_ship_spawn_timer;
+    sim_real nexus_ship_spawn_timer;
     
-    double laser_angle;             // Current angle of orbital laser
-    double laser_rotation_speed;    // How fast laser rotates
-    double gravity_well_strength;   // Force to pull bullets toward boss
+    sim_real laser_angle;             // Current angle of orbital laser
+    sim_real laser_rotation_speed;    // How fast laser rotates
+    sim_real gravity_well_strength;   // Force to pull bullets toward boss
     bool laser_active;              // Is laser currently firing?
-    double laser_charge_timer;      // Charge time before laser fires
+    sim_real laser_charge_timer;      // Charge time before laser fires
     int bomb_count;                 // Number of active bouncing bombs
     int bomb_spawned_this_phase;    // Track bombs created in current phase
-    double beam_angle_offset;       // For variety in beam attacks
+    sim_real beam_angle_offset;       // For variety in beam attacks
     
     // GRAVITY WELL SYSTEM (SINGULARITY BOSS)
-    double void_radius;              // Radius of gravitational pull (expands in later phases)
-    double gravity_pull_strength;    // How strong the gravitational pull is per phase
+    sim_real void_radius;              // Radius of gravitational pull (expands in later phases)
+    sim_real gravity_pull_strength;    // How strong the gravitational pull is per phase
 } BossShip;
 
 // Spawn Queen (Mothership) structure - spawns Red and Sentinel ships on waves 10, 20, 30, etc.
@@ -333,6 +355,21 @@ typedef struct {
     bool is_spawn_queen;        // Flag: true for queen, false for regular boss
 } SpawnQueenBoss;
 
+// ============================================================
+// GAME STATE: HOT / COLD SPLIT
+// ============================================================
+// SimState is everything the simulation reads or writes every tick:
+// ship, entity arrays, boss, timers and input. It is a contiguous
+// block at the start of CometBusterGame, so saves copy just that.
+//
+// CometBusterGame adds the cold state that is only touched by menus,
+// one-off effects or settings (high scores, finale scroll, boss
+// explosion, language, haptics). Code keeps using game->field for
+// both; pass a SimState * where only the hot part is needed.
+// comet_buster_log_state_sizes() prints the per-field breakdown (the
+// render benchmark shows it before its results).
+// ============================================================
+
 typedef struct {
     // Ship state
     double ship_x, ship_y;
@@ -375,6 +412,15 @@ typedef struct {
     int bullet_count;
     Particle particles[MAX_PARTICLES];
     int particle_count;
+    // GPU particles: a ring written at particle_spawn_seq % MAX_PARTICLE_SPAWNS.
+    // The renderer remembers the last sequence number it consumed, so the
+    // records survive snapshot copies without any handshake. particle_clock
+    // is the simulated time the particles have been advanced by.
+    ParticleSpawn particle_spawns[MAX_PARTICLE_SPAWNS];
+    unsigned int particle_spawn_seq;
+    double particle_clock;
+    unsigned int particle_epoch;    // New value every comet_buster_clear_particles()
+    unsigned int cosmetic_seed;     // comet_buster_cosmetic_rand() state
     FloatingText floating_texts[MAX_FLOATING_TEXT];
     int floating_text_count;
     Canister canisters[MAX_CANISTERS];
@@ -410,6 +456,7 @@ typedef struct {
     int enemy_ship_count;
     Bullet enemy_bullets[MAX_ENEMY_BULLETS];
     int enemy_bullet_count;
+    BossBulletPool boss_bullets;        // Boss pattern fire (SoA, see cometbuster_patterns.h)
     
     // UFO (Flying Saucers) - Random encounters like original Asteroids
     UFO ufos[MAX_UFOS];
@@ -464,33 +511,26 @@ typedef struct {
     bool is_boosting;              // Currently using advanced thrusters
     double boost_thrust_timer;     // Visual effect timer for boosting
     
-    // High scores (static array)
-    HighScore high_scores[MAX_HIGH_SCORES];
-    int high_score_count;
-    
     // Keyboard input (WASD movement)
     KeyboardInput keyboard;
     
-    // Splash screen state
-   bool splash_screen_active;
-   double splash_timer;
-   int splash_comet_count;
-   Comet splash_comets[50];
-   int splash_alien_count;
-   struct {
-       double x, y;
-       double vx, vy;
-       int type;
-       double rotation;
-   } splash_aliens[20];
+    // Splash screen mode (the attract-mode comets run through the normal arrays)
+    bool splash_screen_active;
+    double splash_timer;
+} SimState;
 
+struct CometBusterGame : SimState {
+    // High scores (static array)
+    HighScore high_scores[MAX_HIGH_SCORES];
+    int high_score_count;
+    
     // Finale splash screen (Wave 30 victory)
     bool finale_splash_active;
     bool finale_splash_boss_paused;
-    double finale_splash_timer;
+    bool finale_waiting_for_input;
     int finale_scroll_line_index;
+    double finale_splash_timer;
     double finale_scroll_timer;
-    bool finale_waiting_for_input;
     
     // Boss destruction explosion effect
     BossExplosion boss_explosion_effect;
@@ -498,9 +538,8 @@ typedef struct {
     int current_language;    
     
     HapticManager haptic_manager;
-
-    
-} CometBusterGame;
+};
+typedef struct CometBusterGame CometBusterGame;
 
 // Initialization and cleanup
 void comet_buster_cleanup(CometBusterGame *game);
@@ -516,6 +555,7 @@ void comet_buster_update_particles(CometBusterGame *game, double dt);
 void comet_buster_update_floating_text(CometBusterGame *game, double dt);
 void comet_buster_update_fuel(CometBusterGame *game, double dt);  // Advanced thrusters fuel system
 void comet_buster_update_enemy_bullets(CometBusterGame *game, double dt, int width, int height, void *vis);
+void comet_buster_update_boss_bullets(CometBusterGame *game, double dt, int width, int height, void *vis);
 void comet_buster_update_burner_effects(CometBusterGame *game, double dt);  // Burner/thruster effects
 
 // Spawning
@@ -529,6 +569,17 @@ void comet_buster_spawn_omnidirectional_fire(CometBusterGame *game);
 void comet_buster_spawn_spread_fire(CometBusterGame *game, void *vis);
 void comet_buster_spawn_explosion(CometBusterGame *game, double x, double y, int frequency_band, int particle_count);
 void comet_buster_spawn_ship_death_explosion(CometBusterGame *game, double x, double y);
+// Explosion debris goes to the renderer's GPU particle simulation while
+// this is on (the GL renderer turns it on when transform feedback works).
+// Everything else keeps using particles[].
+void comet_buster_set_gpu_particles(bool enabled);
+bool comet_buster_gpu_particles_enabled(void);
+// rand() for particle looks only. A separate generator, so the number of
+// particles spawned (caps, CPU or GPU debris) never shifts the rand()
+// sequence the gameplay depends on.
+int comet_buster_cosmetic_rand(CometBusterGame *game);
+// Drop every particle, including the GPU debris the renderer holds
+void comet_buster_clear_particles(CometBusterGame *game);
 void comet_buster_spawn_floating_text(CometBusterGame *game, double x, double y, const char *text, double r, double g, double b);
 void comet_buster_spawn_enemy_ship(CometBusterGame *game, int screen_width, int screen_height);
 void comet_buster_spawn_enemy_bullet(CometBusterGame *game, double x, double y, double vx, double vy);
@@ -541,30 +592,8 @@ bool comet_buster_check_ship_canister(CometBusterGame *game, Canister *c);
 
 // Drawing functions for Cairo
 #ifdef CAIROBUILD
-void draw_comet_buster_canisters(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_missile_pickups(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_missiles(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_bomb_pickups(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_bombs(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_boss(CometBusterGame *game, BossShip *boss, cairo_t *cr, int width, int height);
-void draw_spawn_queen_boss(CometBusterGame *game, SpawnQueenBoss *queen, cairo_t *cr, int width, int height);
-void draw_comet_buster_ship(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_comets(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_bullets(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_particles(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_hud(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_game_over(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_enemy_ships(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_enemy_bullets(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_ship_burner(cairo_t *cr, double burner_intensity, double length_multiplier);
-void draw_enemy_ship_burner(cairo_t *cr, double burner_intensity, double ship_size);
-void draw_void_nexus_boss(CometBusterGame *game, BossShip *boss, cairo_t *cr, int width, int height);
 void comet_buster_draw_finale_splash(CometBusterGame *game, cairo_t *cr, int width, int height);                                 
-void draw_harbinger_boss(CometBusterGame *game, BossShip *boss, cairo_t *cr, int width, int height);
-void draw_star_vortex_boss(BossShip *boss, cairo_t *cr, int width, int height);
-void draw_singularity_boss(CometBusterGame *game, BossShip *boss, cairo_t *cr, int width, int height);
 void comet_buster_draw_victory_scroll(CometBusterGame *game, cairo_t *cr, int width, int height);
-void draw_comet_buster_ufos(CometBusterGame *game, cairo_t *cr, int width, int height);
 void comet_buster_draw_splash_screen(CometBusterGame *game, cairo_t *cr, int width, int height);
 #endif
 
@@ -630,6 +659,14 @@ void comet_buster_update_wave_progression(CometBusterGame *game);
 void comet_buster_wrap_position(double *x, double *y, int width, int height);
 double comet_buster_distance(double x1, double y1, double x2, double y2);
 void comet_buster_get_frequency_color(int frequency_band, double *r, double *g, double *b);
+#ifdef SIM_FLOAT32
+// sim_real versions for entity fields
+void comet_buster_wrap_position(sim_real *x, sim_real *y, int width, int height);
+void comet_buster_get_frequency_color(int frequency_band, sim_real *r, sim_real *g, sim_real *b);
+#endif
+
+// Log the per-field size of SimState and the cold part of CometBusterGame
+void comet_buster_log_state_sizes(void);
 
 // High score management - implemented in comet_main.cpp
 bool comet_buster_is_high_score(CometBusterGame *game, int score);
@@ -690,33 +727,9 @@ void comet_buster_exit_victory_scroll(CometBusterGame *game);
 
 // Main rendering function
 
-// Game element drawing functions
-void draw_comet_buster_comets_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_bullets_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_enemy_ships_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_ufos_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_enemy_bullets_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_missiles_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_bombs_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_canisters_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_missile_pickups_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_bomb_pickups_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_particles_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_ship_gl(CometBusterGame *game, void *cr, int width, int height);
 void gl_init(void);
 
-// Boss drawing functions
-void draw_comet_buster_boss_gl(CometBusterGame *game, BossShip *boss, void *cr, int width, int height);
-void draw_spawn_queen_boss_gl(CometBusterGame *game, SpawnQueenBoss *queen, void *cr, int width, int height);
-void draw_void_nexus_boss_gl(CometBusterGame *game, BossShip *boss, void *cr, int width, int height);
-void draw_harbinger_boss_gl(CometBusterGame *game, BossShip *boss, void *cr, int width, int height);
-void draw_star_vortex_boss_gl(BossShip *boss, void *cr, int width, int height);
-void draw_singularity_boss_gl(CometBusterGame *game, BossShip *boss, void *cr, int width, int height);
-
-// UI and effects drawing functions
-void draw_comet_buster_hud_gl(CometBusterGame *game, void *cr, int width, int height);
-void draw_comet_buster_game_over_gl(CometBusterGame *game, void *cr, int width, int height);
-void boss_explosion_draw_gl(BossExplosion *explosion, void *cr);
+// Splash, victory and finale screens
 void comet_buster_draw_splash_screen_gl(CometBusterGame *game, void *cr, int width, int height);
 void comet_buster_draw_victory_scroll_gl(CometBusterGame *game, void *cr, int width, int height);
 void comet_buster_draw_finale_splash_gl(CometBusterGame *game, void *cr, int width, int height);
@@ -382,6 +382,14 @@ void comet_buster_update_bombs(CometBusterGame *game, double dt, int width, int
             }
         }
         
+        // Bomb wave clears boss pattern fire too
+        BossBulletPool *pool = &game->boss_bullets;
+        for (int hit = boss_bullet_pool_first_hit(pool, bomb->x, bomb->y, bomb->wave_max_radius, 0);
+             hit >= 0;
+             hit = boss_bullet_pool_first_hit(pool, bomb->x, bomb->y, bomb->wave_max_radius, hit + 1)) {
+            boss_bullet_pool_kill(pool, hit);
+        }
+        
         // Mark damage as applied if we hit anything
         if (damage_this_frame) {
             bomb->damage_applied = true;
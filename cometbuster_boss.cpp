@@ -287,15 +287,8 @@ void comet_buster_boss_fire(CometBusterGame *game) {
         angle_spread = 30.0 * M_PI / 180.0;  // 30 degree spread
     }
     
-    double start_angle = angle_to_ship - angle_spread / 2.0;
-    
-    for (int i = 0; i < num_bullets; i++) {
-        double angle = start_angle + (angle_spread / (num_bullets - 1)) * i;
-        double vx = cos(angle) * bullet_speed;
-        double vy = sin(angle) * bullet_speed;
-        
-        comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-    }
+    BulletPattern fan = {PATTERN_AIMED_FAN, num_bullets, bullet_speed, angle_spread, 0.0, 0.0};
+    bullet_pattern_emit(&game->boss_bullets, &fan, boss->x, boss->y, angle_to_ship, -3);
 }
 
 bool comet_buster_check_bullet_boss(Bullet *b, BossShip *boss) {
@@ -654,39 +647,20 @@ void comet_buster_spawn_queen_fire(CometBusterGame *game) {
     double angle_to_ship = atan2(dy, dx);
     
     if (queen->phase == 0) {
-        // Phase 0: Minimal fire - 1 bullet toward player
-        int num_bullets = 1;
-        double spread = 15.0 * M_PI / 180.0;
-        
-        for (int i = 0; i < num_bullets; i++) {
-            double fire_angle = angle_to_ship + (spread * (i - num_bullets/2.0));
-            double vx = cos(fire_angle) * bullet_speed;
-            double vy = sin(fire_angle) * bullet_speed;
-            comet_buster_spawn_enemy_bullet_from_ship(game, queen->x, queen->y, vx, vy, -4);  // -4 = Spawn Queen
-        }
+        // Phase 0: Minimal fire - 1 bullet toward player (half a 15 degree step off-axis)
+        double fire_angle = angle_to_ship - (15.0 * M_PI / 180.0) / 2.0;
+        boss_bullet_spawn(&game->boss_bullets, queen->x, queen->y,
+                          cos(fire_angle) * bullet_speed, sin(fire_angle) * bullet_speed, -4);  // -4 = Spawn Queen
         
     } else if (queen->phase == 1) {
         // Phase 1: Burst fire - 3-bullet spread
-        int num_bullets = 3;
-        double spread = 45.0 * M_PI / 180.0;
-        double start_angle = angle_to_ship - spread / 2.0;
-        
-        for (int i = 0; i < num_bullets; i++) {
-            double fire_angle = start_angle + (spread / (num_bullets - 1)) * i;
-            double vx = cos(fire_angle) * bullet_speed;
-            double vy = sin(fire_angle) * bullet_speed;
-            comet_buster_spawn_enemy_bullet_from_ship(game, queen->x, queen->y, vx, vy, -4);  // -4 = Spawn Queen
-        }
+        BulletPattern burst = {PATTERN_AIMED_FAN, 3, bullet_speed, 45.0 * M_PI / 180.0, 0.0, 0.0};
+        bullet_pattern_emit(&game->boss_bullets, &burst, queen->x, queen->y, angle_to_ship, -4);
         
     } else {
         // Phase 2: Ring fire - 16 bullets in all directions
-        int num_bullets = 16;
-        for (int i = 0; i < num_bullets; i++) {
-            double fire_angle = 2.0 * M_PI * i / num_bullets;
-            double vx = cos(fire_angle) * (bullet_speed + 50.0);
-            double vy = sin(fire_angle) * (bullet_speed + 50.0);
-            comet_buster_spawn_enemy_bullet_from_ship(game, queen->x, queen->y, vx, vy, -4);  // -4 = Spawn Queen
-        }
+        BulletPattern ring = {PATTERN_RING, 16, bullet_speed + 50.0, 0.0, 0.0, 0.0};
+        bullet_pattern_emit(&game->boss_bullets, &ring, queen->x, queen->y, 0.0, -4);
     }
 }
 
@@ -887,15 +861,10 @@ void comet_buster_update_void_nexus(CometBusterGame *game, double dt, int width,
     } else if (boss->phase == 2) {
         // Phase 2: OMNIDIRECTIONAL BULLET SPRAY - more intense
         if (boss->shoot_cooldown <= 0) {
-            // Fire bullets in all 8 directions + diagonal
-            int num_directions = 8;
-            for (int i = 0; i < num_directions; i++) {
-                double angle = (i * 2.0 * M_PI / num_directions) + (boss->burst_angle_offset * M_PI / 180.0);
-                double bullet_speed = 220.0;  // Fast bullets
-                double vx = cos(angle) * bullet_speed;
-                double vy = sin(angle) * bullet_speed;
-                comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-            }
+            // Fire bullets in all 8 directions + diagonal, spiralling with burst_angle_offset
+            BulletPattern spray = {PATTERN_RING, 8, 220.0, 0.0, 0.0, 0.0};  // Fast bullets
+            bullet_pattern_emit(&game->boss_bullets, &spray, boss->x, boss->y,
+                                boss->burst_angle_offset * M_PI / 180.0, -3);
             
             boss->shoot_cooldown = 0.4;  // Rapid fire
             boss->burst_angle_offset += 15;  // Rotate pattern for visual variety
@@ -1009,21 +978,12 @@ void void_nexus_fire(CometBusterGame *game) {
     double dy = game->ship_y - boss->y;
     double angle_to_ship = atan2(dy, dx);
     
-    // Fire 3 bullets in a rotating spread
-    int num_bullets = 3;
-    double angle_spread = 60.0 * M_PI / 180.0;  // 60 degree spread
+    // Fire 3 bullets in a rotating spread (60 degrees wide)
+    BulletPattern burst = {PATTERN_AIMED_FAN, 3, bullet_speed, 60.0 * M_PI / 180.0, 0.0, 0.0};
     
     // Offset changes each burst for rotation effect
     double offset = (boss->burst_angle_offset * M_PI / 180.0);
-    double start_angle = angle_to_ship - angle_spread / 2.0 + offset;
-    
-    for (int i = 0; i < num_bullets; i++) {
-        double angle = start_angle + (angle_spread / (num_bullets - 1)) * i;
-        double vx = cos(angle) * bullet_speed;
-        double vy = sin(angle) * bullet_speed;
-        
-        comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-    }
+    bullet_pattern_emit(&game->boss_bullets, &burst, boss->x, boss->y, angle_to_ship + offset, -3);
     
     SDL_Log("[Comet Busters] [VOID NEXUS] 3-way burst fired!\n");
 }
@@ -1049,7 +1009,7 @@ void void_nexus_fragment_fire(CometBusterGame *game, int fragment_id) {
     double vx = cos(angle_to_ship) * bullet_speed;
     double vy = sin(angle_to_ship) * bullet_speed;
     
-    comet_buster_spawn_enemy_bullet(game, frag_x, frag_y, vx, vy);
+    boss_bullet_spawn(&game->boss_bullets, frag_x, frag_y, vx, vy, -1);
 }
 
 // ============================================================================
@@ -1451,13 +1411,9 @@ void comet_buster_update_harbinger(CometBusterGame *game, double dt, int width,
         if (boss->laser_charge_timer >= 3.0) {
             boss->laser_active = true;
             
-            // Fire laser burst in orbital pattern
-            for (int i = 0; i < 5; i++) {
-                double angle = boss->laser_angle + (i * 72.0 * M_PI / 180.0);
-                double vx = cos(angle) * 250.0;
-                double vy = sin(angle) * 250.0;
-                comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-            }
+            // Fire laser burst in orbital pattern (5 bullets, 72 degrees apart)
+            BulletPattern burst = {PATTERN_RING, 5, 250.0, 0.0, 0.0, 0.0};
+            bullet_pattern_emit(&game->boss_bullets, &burst, boss->x, boss->y, boss->laser_angle, -3);
             
             // NEW: Also spawn comet spray with laser attack
             for (int i = 0; i < 6; i++) {
@@ -1512,13 +1468,8 @@ void comet_buster_update_harbinger(CometBusterGame *game, double dt, int width,
         // FRENZY PHASE: Rapid attacks + COMETS + ENEMY SHIPS
         if (boss->shoot_cooldown <= 0) {
             // Spread shot in multiple directions
-            int num_directions = 8;
-            for (int i = 0; i < num_directions; i++) {
-                double angle = (i * 2.0 * M_PI / num_directions) + boss->beam_angle_offset;
-                double vx = cos(angle) * 200.0;
-                double vy = sin(angle) * 200.0;
-                comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-            }
+            BulletPattern spread = {PATTERN_RING, 8, 200.0, 0.0, 0.0, 0.0};
+            bullet_pattern_emit(&game->boss_bullets, &spread, boss->x, boss->y, boss->beam_angle_offset, -3);
             
             // Spawn bombs more rapidly
             if (boss->bomb_spawned_this_phase < 4) {
@@ -1797,20 +1748,16 @@ void comet_buster_update_singularity(CometBusterGame *game, double dt, int width
         case 0: // Phase 0: Mostly fast bullets, rare homing missiles
             if (boss->fire_pattern_timer >= 4.5) {  // REDUCED: was 3.0
                 // Wide 180° beam sweep
-                double sweep_angle = (boss->burst_angle_offset * M_PI / 180.0);
-                for (int i = 0; i < 6; i++) {
-                    double angle = sweep_angle + (i * 30.0 * M_PI / 180.0);
-                    double vx = cos(angle) * 250.0;
-                    double vy = sin(angle) * 250.0;
-                    comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-                }
+                BulletPattern sweep = {PATTERN_SWEEP, 6, 250.0, 0.0, 30.0 * M_PI / 180.0, 0.0};
+                bullet_pattern_emit(&game->boss_bullets, &sweep, boss->x, boss->y,
+                                    boss->burst_angle_offset * M_PI / 180.0, -3);
                 
                 // Fire missile MUCH less frequently (every 9 cycles = ~40.5 seconds)
                 if (((int)(boss->phase_timer / 4.5)) % 9 == 0) {
                     double angle = atan2(game->ship_y - boss->y, game->ship_x - boss->x);
                     double vx = cos(angle) * 200.0;
                     double vy = sin(angle) * 200.0;
-                    comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
+                    boss_bullet_spawn(&game->boss_bullets, boss->x, boss->y, vx, vy, -3);
                 }
                 
                 boss->burst_angle_offset += 180;
@@ -1823,13 +1770,10 @@ void comet_buster_update_singularity(CometBusterGame *game, double dt, int width
                 int cycle = ((int)(boss->phase_timer * 0.5)) % 2;
                 
                 if (cycle == 0) {
-                    // 3 narrow beams - reduced from 3 to 2 missiles
-                    for (int i = 0; i < 3; i++) {
-                        double angle = boss->rotation * M_PI / 180.0 + (i - 1) * 30.0 * M_PI / 180.0;
-                        double vx = cos(angle) * 300.0;
-                        double vy = sin(angle) * 300.0;
-                        comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-                    }
+                    // 3 narrow beams, 30 degrees apart - reduced from 3 to 2 missiles
+                    BulletPattern beams = {PATTERN_AIMED_FAN, 3, 300.0, 60.0 * M_PI / 180.0, 0.0, 0.0};
+                    bullet_pattern_emit(&game->boss_bullets, &beams, boss->x, boss->y,
+                                        boss->rotation * M_PI / 180.0, -3);
                     
                     // Add homing missiles - REDUCED from 2 to 1
                     for (int i = 0; i < 1; i++) {
@@ -1900,7 +1844,7 @@ void comet_buster_update_singularity(CometBusterGame *game, double dt, int width
                             
                             game->missile_count++;
                         } else {
-                            comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
+                            boss_bullet_spawn(&game->boss_bullets, boss->x, boss->y, vx, vy, -3);
                         }
                     }
                 }
@@ -1946,12 +1890,9 @@ void comet_buster_update_singularity(CometBusterGame *game, double dt, int width
         case 2: // Phase 2: Heavy missile presence (40/60 becomes 50/50)
             if (boss->fire_pattern_timer >= 3.0) {  // REDUCED: was 2.0
                 // 4 rotating beams (fast bullets)
-                for (int i = 0; i < 4; i++) {
-                    double angle = (boss->rotation + i * 90.0) * M_PI / 180.0;
-                    double vx = cos(angle) * 300.0;
-                    double vy = sin(angle) * 300.0;
-                    comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-                }
+                BulletPattern beams = {PATTERN_RING, 4, 300.0, 0.0, 0.0, 0.0};
+                bullet_pattern_emit(&game->boss_bullets, &beams, boss->x, boss->y,
+                                    boss->rotation * M_PI / 180.0, -3);
                 
                 // Fragmenting projectiles spiral - REDUCED from 6 to 4 total
                 for (int i = 0; i < 4; i++) {
@@ -1961,7 +1902,7 @@ void comet_buster_update_singularity(CometBusterGame *game, double dt, int width
                     
                     // 50% fast bullets, 50% homing missiles
                     if (i % 2 == 0) {
-                        comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
+                        boss_bullet_spawn(&game->boss_bullets, boss->x, boss->y, vx, vy, -3);
                     } else {
                         // Homing missile toward player
                         if (game->missile_count >= MAX_MISSILES) continue;
@@ -2035,12 +1976,9 @@ void comet_buster_update_singularity(CometBusterGame *game, double dt, int width
         case 3: // Phase 3: Still dangerous but manageable - reduced missile barrage
             if (boss->fire_pattern_timer >= 2.5) {  // REDUCED: was 1.5
                 // 4 rotating laser beams (fast bullets)
-                for (int i = 0; i < 4; i++) {
-                    double angle = (boss->rotation + i * 90.0) * M_PI / 180.0;
-                    double vx = cos(angle) * 320.0;
-                    double vy = sin(angle) * 320.0;
-                    comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
-                }
+                BulletPattern beams = {PATTERN_RING, 4, 320.0, 0.0, 0.0, 0.0};
+                bullet_pattern_emit(&game->boss_bullets, &beams, boss->x, boss->y,
+                                    boss->rotation * M_PI / 180.0, -3);
                 
                 // Fragmenting projectiles - GREATLY REDUCED from 8 to 4 total
                 for (int i = 0; i < 4; i++) {
@@ -2050,7 +1988,7 @@ void comet_buster_update_singularity(CometBusterGame *game, double dt, int width
                     if (i % 2 == 0) {
                         double vx = cos(angle) * 300.0;
                         double vy = sin(angle) * 300.0;
-                        comet_buster_spawn_enemy_bullet_from_ship(game, boss->x, boss->y, vx, vy, -3);
+                        boss_bullet_spawn(&game->boss_bullets, boss->x, boss->y, vx, vy, -3);
                     } else {
                         // Actual homing missile (now only 2 per pattern instead of 7)
                         if (game->missile_count >= MAX_MISSILES) continue;
@@ -1,4 +1,5 @@
 #include "cometbuster_bossexplosion.h"
+#include "cometbuster_fastmath.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -39,8 +40,10 @@ static void create_radial_line(BossExplosion *explosion, double cx, double cy,
     p->is_radial_line = true;
     
     // Velocity for the particle system (slight spread)
-    p->vx = cos(angle) * speed;
-    p->vy = sin(angle) * speed;
+    double dir_s, dir_c;
+    fm_sincos(angle, &dir_s, &dir_c);
+    p->vx = dir_c * speed;
+    p->vy = dir_s * speed;
 }
 
 // Helper: Create a glow particle (trail/secondary effect)
@@ -109,8 +112,10 @@ void boss_explosion_create(BossExplosion *explosion, double x, double y, const c
     for (int i = 0; i < num_glows; i++) {
         double angle = (2.0 * M_PI * rand()) / RAND_MAX;
         double speed = 100.0 + (rand() % 200);
-        double vx = cos(angle) * speed;
-        double vy = sin(angle) * speed;
+        double dir_s, dir_c;
+        fm_sincos(angle, &dir_s, &dir_c);
+        double vx = dir_c * speed;
+        double vy = dir_s * speed;
         
         // Slight color variation for more dynamic look
         double color_var = 0.3 + (rand() % 70) / 100.0;  // 0.3 to 1.0
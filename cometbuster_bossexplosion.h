@@ -36,11 +36,6 @@ void boss_explosion_create(BossExplosion *explosion, double x, double y, const c
 // Update explosion (shrink/fade particles)
 void boss_explosion_update(BossExplosion *explosion, double dt);
 
-#ifdef CAIROBUILD
-// Render explosion particles
-void boss_explosion_draw(BossExplosion *explosion, cairo_t *cr);
-#endif
-
 // Check if explosion is still active
 bool boss_explosion_is_active(BossExplosion *explosion);
 
@@ -4,6 +4,7 @@
 #include <string.h>
 #include <time.h>
 #include "cometbuster.h"
+#include "cometbuster_fastmath.h"
 #include "visualization.h"
 #include "comet_lang.h"
 
@@ -63,9 +64,8 @@ bool comet_buster_check_bullet_comet(Bullet *b, Comet *c) {
     
     double dx = b->x - c->x;
     double dy = b->y - c->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < (c->radius + 2.0);
+    return fm_within(dx, dy, c->radius + 2.0);
 }
 
 bool comet_buster_check_missile_comet(Missile *m, Comet *c) {
@@ -73,9 +73,8 @@ bool comet_buster_check_missile_comet(Missile *m, Comet *c) {
     
     double dx = m->x - c->x;
     double dy = m->y - c->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < (c->radius + 8.0);  // Missiles have larger collision radius
+    return fm_within(dx, dy, c->radius + 8.0);  // Missiles have larger collision radius
 }
 
 bool comet_buster_check_ship_comet(CometBusterGame *game, Comet *c) {
@@ -83,9 +82,8 @@ bool comet_buster_check_ship_comet(CometBusterGame *game, Comet *c) {
     
     double dx = game->ship_x - c->x;
     double dy = game->ship_y - c->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < (c->radius + 15.0);
+    return fm_within(dx, dy, c->radius + 15.0);
 }
 
 bool comet_buster_check_bullet_enemy_ship(Bullet *b, EnemyShip *e) {
@@ -93,9 +91,8 @@ bool comet_buster_check_bullet_enemy_ship(Bullet *b, EnemyShip *e) {
     
     double dx = b->x - e->x;
     double dy = b->y - e->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < 15.0;  // Enemy ship collision radius is 15 pixels
+    return fm_within(dx, dy, 15.0);  // Enemy ship collision radius is 15 pixels
 }
 
 bool comet_buster_check_enemy_bullet_ship(CometBusterGame *game, Bullet *b) {
@@ -103,9 +100,8 @@ bool comet_buster_check_enemy_bullet_ship(CometBusterGame *game, Bullet *b) {
     
     double dx = game->ship_x - b->x;
     double dy = game->ship_y - b->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < 15.0;  // Player ship collision radius
+    return fm_within(dx, dy, 15.0);  // Player ship collision radius
 }
 
 /**
@@ -128,10 +124,9 @@ int comet_buster_check_enemy_bullet_enemy_ship(CometBusterGame *game, Bullet *b)
         
         double dx = ship->x - b->x;
         double dy = ship->y - b->y;
-        double dist = sqrt(dx*dx + dy*dy);
         
         // Enemy ship collision radius is 15 pixels
-        if (dist < 15.0) {
+        if (fm_within(dx, dy, 15.0)) {
             return i;  // Return the ship index that was hit
         }
     }
@@ -226,8 +221,10 @@ void comet_buster_destroy_comet(CometBusterGame *game, int comet_index, int widt
             // Scatter in random direction
             double angle = (rand() % 360) * (M_PI / 180.0);
             double speed = 100.0 + (rand() % 100);
-            child->vx = cos(angle) * speed;
-            child->vy = sin(angle) * speed;
+            double dir_s, dir_c;
+            fm_sincos(angle, &dir_s, &dir_c);
+            child->vx = dir_c * speed;
+            child->vy = dir_s * speed;
             
             // Set as medium asteroid
             child->size = COMET_MEDIUM;
@@ -262,8 +259,10 @@ void comet_buster_destroy_comet(CometBusterGame *game, int comet_index, int widt
             // Scatter in random direction
             double angle = (rand() % 360) * (M_PI / 180.0);
             double speed = 150.0 + (rand() % 100);
-            child->vx = cos(angle) * speed;
-            child->vy = sin(angle) * speed;
+            double dir_s, dir_c;
+            fm_sincos(angle, &dir_s, &dir_c);
+            child->vx = dir_c * speed;
+            child->vy = dir_s * speed;
             
             // Set as small asteroid
             child->size = COMET_SMALL;
@@ -299,8 +298,10 @@ void comet_buster_destroy_comet(CometBusterGame *game, int comet_index, int widt
             // Scatter in random direction
             double angle = (rand() % 360) * (M_PI / 180.0);
             double speed = 80.0 + (rand() % 80);
-            child->vx = cos(angle) * speed;
-            child->vy = sin(angle) * speed;
+            double dir_s, dir_c;
+            fm_sincos(angle, &dir_s, &dir_c);
+            child->vx = dir_c * speed;
+            child->vy = dir_s * speed;
             
             // Set as large asteroid
             child->size = COMET_LARGE;
@@ -693,9 +694,8 @@ bool comet_buster_check_ship_canister(CometBusterGame *game, Canister *c) {
     
     double dx = game->ship_x - c->x;
     double dy = game->ship_y - c->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < 20.0;  // Canister collision radius is 20 pixels
+    return fm_within(dx, dy, 20.0);  // Canister collision radius is 20 pixels
 }
 
 // ============================================================================
@@ -707,9 +707,8 @@ bool comet_buster_check_ship_missile_pickup(CometBusterGame *game, MissilePickup
     
     double dx = game->ship_x - p->x;
     double dy = game->ship_y - p->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < 20.0;  // Missile pickup collision radius is 20 pixels
+    return fm_within(dx, dy, 20.0);  // Missile pickup collision radius is 20 pixels
 }
 
 // ============================================================================
@@ -721,10 +720,9 @@ bool comet_buster_check_ufo_comet(UFO *u, Comet *c) {
     
     double dx = u->x - c->x;
     double dy = u->y - c->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
     // UFO collision radius is 25 pixels (matches UFO size)
-    return dist < (c->radius + 25.0);
+    return fm_within(dx, dy, c->radius + 25.0);
 }
 
 // ============================================================================
@@ -736,9 +734,8 @@ bool comet_buster_check_ship_ufo(CometBusterGame *game, UFO *u) {
     
     double dx = game->ship_x - u->x;
     double dy = game->ship_y - u->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < (25.0 + 15.0);  // UFO radius (25) + Ship radius (15)
+    return fm_within(dx, dy, 25.0 + 15.0);  // UFO radius (25) + Ship radius (15)
 }
 
 // ============================================================================
@@ -750,7 +747,6 @@ bool comet_buster_check_enemy_bullet_ufo(Bullet *b, UFO *u) {
     
     double dx = u->x - b->x;
     double dy = u->y - b->y;
-    double dist = sqrt(dx*dx + dy*dy);
     
-    return dist < 25.0;  // UFO collision radius
+    return fm_within(dx, dy, 25.0);  // UFO collision radius
 }
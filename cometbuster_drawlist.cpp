@@ -0,0 +1,1405 @@
+#include <math.h>
+#include <string.h>
+#include <stdio.h>
+#include "cometbuster_drawlist.h"
+#include "cometbuster_jobs.h"
+#include "cometbuster_fastmath.h"
+#include "comet_lang.h"
+#include "cometbuster_quality.h"
+
+// ============================================================================
+// EMITTERS
+// ============================================================================
+
+static DrawCmd *drawlist_push(DrawList *list, DrawCmdType type, int flags, DrawColor color) {
+    list->cmds.resize(list->cmds.size() + 1);
+    DrawCmd *cmd = &list->cmds.back();
+    memset(cmd, 0, sizeof(*cmd));
+    cmd->type = (unsigned char)type;
+    cmd->flags = (unsigned char)flags;
+    cmd->color = color;
+    return cmd;
+}
+
+void drawlist_clear(DrawList *list, int width, int height) {
+    list->cmds.clear();
+    list->points.clear();
+    list->text.clear();
+    list->width = width;
+    list->height = height;
+}
+
+void drawlist_line(DrawList *list, float x1, float y1, float x2, float y2, float width, DrawColor color) {
+    DrawCmd *cmd = drawlist_push(list, DL_LINE, 0, color);
+    cmd->x = x1;
+    cmd->y = y1;
+    cmd->a = x2;
+    cmd->b = y2;
+    cmd->width = width;
+}
+
+void drawlist_path(DrawList *list, const DrawPoint *points, int count, int flags, float width, DrawColor color) {
+    if (!points || count < 2) return;
+    DrawCmd *cmd = drawlist_push(list, DL_PATH, flags, color);
+    cmd->width = width;
+    cmd->first = (int)list->points.size();
+    cmd->count = count;
+    list->points.insert(list->points.end(), points, points + count);
+}
+
+void drawlist_circle(DrawList *list, float cx, float cy, float radius, int flags, float width, DrawColor color) {
+    DrawCmd *cmd = drawlist_push(list, DL_CIRCLE, flags, color);
+    cmd->x = cx;
+    cmd->y = cy;
+    cmd->size = radius;
+    cmd->width = width;
+}
+
+void drawlist_rect(DrawList *list, float x, float y, float w, float h, int flags, float width, DrawColor color) {
+    DrawCmd *cmd = drawlist_push(list, DL_RECT, flags, color);
+    cmd->x = x;
+    cmd->y = y;
+    cmd->a = w;
+    cmd->b = h;
+    cmd->width = width;
+}
+
+void drawlist_sprite(DrawList *list, DrawSpriteKind kind, float x, float y, float size,
+                     float trail_x, float trail_y, DrawColor color) {
+    DrawCmd *cmd = drawlist_push(list, DL_SPRITE, 0, color);
+    cmd->id = (unsigned short)kind;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->a = trail_x;
+    cmd->b = trail_y;
+    cmd->size = size;
+}
+
+void drawlist_text(DrawList *list, const char *text, float x, float y, int font_size, int flags, DrawColor color) {
+    if (!text || !text[0]) return;
+    DrawCmd *cmd = drawlist_push(list, DL_TEXT, flags, color);
+    cmd->id = (unsigned short)font_size;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->first = (int)list->text.size();
+    cmd->count = (int)strlen(text);
+    list->text.insert(list->text.end(), text, text + cmd->count + 1);
+}
+
+void drawlist_shape(DrawList *list, DrawShapeId shape, float x, float y, float angle, float scale, DrawColor tint) {
+    DrawCmd *cmd = drawlist_push(list, DL_SHAPE, 0, tint);
+    cmd->id = (unsigned short)shape;
+    cmd->x = x;
+    cmd->y = y;
+    cmd->a = angle;
+    cmd->b = scale;
+}
+
+void drawlist_comet(DrawList *list, const Comet *comet) {
+    int shape_seed = drawlist_comet_seed(comet);
+    int num_points = drawlist_comet_points(comet->size, shape_seed);
+    if (num_points <= 0) return;
+
+    DrawCmd *cmd = drawlist_push(list, DL_COMET, 0,
+                                 dl_color((float)comet->color[0], (float)comet->color[1], (float)comet->color[2], 1.0f));
+    cmd->id = (unsigned short)comet->size;
+    cmd->x = (float)comet->x;
+    cmd->y = (float)comet->y;
+    // Spin, and a slower tumble applied first for a 3D-ish roll
+    cmd->a = (float)(comet->base_angle + comet->rotation * M_PI / 180.0f);
+    cmd->b = (float)((comet->rotation * 0.7f) * M_PI / 180.0f);
+    cmd->size = (float)comet->radius;
+    cmd->width = drawlist_comet_width(comet->size);
+    cmd->first = shape_seed;
+    cmd->count = num_points;
+}
+
+void drawlist_background(DrawList *list) {
+    drawlist_push(list, DL_BACKGROUND, 0, dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
+void drawlist_debris(DrawList *list) {
+    drawlist_push(list, DL_DEBRIS, 0, dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
+// ============================================================================
+// SHARED ART
+// ============================================================================
+
+// Juggernauts are 3x, brown coats 1.5x, everything else 1x
+double drawlist_enemy_ship_size(int ship_type) {
+    if (ship_type == 5) return 36.0;
+    if (ship_type == 4) return 18.0;
+    return 12.0;
+}
+
+// Use rotation_speed as deterministic shape seed for variety
+int drawlist_comet_seed(const Comet *comet) {
+    return (int)(comet->rotation_speed * 1000) % 997;  // Large prime for good distribution
+}
+
+int drawlist_comet_points(int size, int shape_seed) {
+    switch (size) {
+        case COMET_MEGA:   return 13 + (shape_seed % 3);  // 13-15 points
+        case COMET_LARGE:  return 10 + (shape_seed % 3);  // 10-12 points
+        case COMET_MEDIUM: return 8 + (shape_seed % 2);   // 8-9 points
+        case COMET_SMALL:  return 6 + (shape_seed % 2);   // 6-7 points
+        default:           return 0;
+    }
+}
+
+float drawlist_comet_width(int size) {
+    switch (size) {
+        case COMET_MEGA:   return 3.5f;
+        case COMET_LARGE:  return 2.5f;
+        case COMET_MEDIUM: return 2.0f;
+        default:           return 1.5f;
+    }
+}
+
+// Generate seed-based pseudo-random value for deterministic asteroid shapes
+static float comet_random_jagged(int seed, int index) {
+    int x = seed * 73856093 ^ (index * 19349663);
+    return (float)((x * 2654435761U) % 1000) / 1000.0f;
+}
+
+// Jagged outline, unrotated, around the origin
+void drawlist_comet_outline(double points[][2], int num_points, double radius, int shape_seed) {
+    for (int i = 0; i < num_points; i++) {
+        double angle = 2.0 * M_PI * i / num_points;
+        
+        // Base radius with random jagger (use seed for determinism)
+        float jagged = 0.6f + 0.4f * comet_random_jagged(shape_seed, i);
+        double point_radius = radius * jagged;
+        
+        // Random angle offset for more irregular shape
+        float angle_offset = (comet_random_jagged(shape_seed + 1, i) - 0.5f) * 0.5f;  // ±0.25 rad variation
+        
+        double s, c;
+        fm_sincos(angle + angle_offset, &s, &c);
+        points[i][0] = point_radius * c;
+        points[i][1] = point_radius * s;
+    }
+}
+
+// ============================================================================
+// GAME OBJECTS
+// ============================================================================
+
+static void drawlist_emit_bullets(DrawList *list, const CometBusterGame *game, int begin, int end) {
+    // Yellow diamond with a faint trail (classic Asteroids style)
+    DrawColor yellow = dl_color(1.0f, 1.0f, 0.0f, 1.0f);
+    const double trail_length = 5.0;
+
+    for (int i = begin; i < end; i++) {
+        const Bullet *b = &game->bullets[i];
+        if (!b->active) continue;
+
+        float trail_x = 0.0f, trail_y = 0.0f;
+        double norm_len = sqrt(b->vx * b->vx + b->vy * b->vy);
+        if (norm_len > 0.1) {
+            trail_x = (float)(b->vx / norm_len * trail_length);
+            trail_y = (float)(b->vy / norm_len * trail_length);
+        }
+        drawlist_sprite(list, DL_SPRITE_DIAMOND, (float)b->x, (float)b->y, 3.0f, trail_x, trail_y, yellow);
+    }
+}
+
+static void drawlist_emit_enemy_ships(DrawList *list, const CometBusterGame *game) {
+    for (int i = 0; i < game->enemy_ship_count; i++) {
+        const EnemyShip *ship = &game->enemy_ships[i];
+        if (!ship->active) continue;
+
+        // Hull, stripes and outline (unknown types look like patrol ships)
+        int shape_type = (ship->ship_type >= 0 && ship->ship_type <= 5) ? ship->ship_type : 0;
+        double ship_size = drawlist_enemy_ship_size(ship->ship_type);
+        drawlist_shape(list, (DrawShapeId)(DL_SHAPE_ENEMY_SHIP + shape_type), (float)ship->x, (float)ship->y,
+                       (float)ship->angle, 1.0f, dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+
+        double cos_a = cos(ship->angle);
+        double sin_a = sin(ship->angle);
+
+        // ========== THRUSTER FLAME EFFECTS ==========
+        // Flame intensity follows speed
+        double velocity = sqrt(ship->vx * ship->vx + ship->vy * ship->vy);
+        double flame_intensity = fmin(velocity / 100.0, 1.0);
+
+        if (flame_intensity > 0.05 || ship->ship_type == 5) {  // Always show flames for Juggernaut
+            // Flame ejection point at rear of ship
+            double flame_base_x = -ship_size * 0.9 * cos_a + ship->x;
+            double flame_base_y = -ship_size * 0.9 * sin_a + ship->y;
+
+            // Flames point away from the velocity, or straight back when still
+            double flame_dir_x = -ship->vx;
+            double flame_dir_y = -ship->vy;
+            double flame_dir_len = sqrt(flame_dir_x * flame_dir_x + flame_dir_y * flame_dir_y);
+            if (flame_dir_len > 0.1) {
+                flame_dir_x /= flame_dir_len;
+                flame_dir_y /= flame_dir_len;
+            } else {
+                flame_dir_x = -cos_a;
+                flame_dir_y = -sin_a;
+            }
+
+            double flame_width = ship_size * 0.6;
+            double outer_flame_length = ship_size * 1.2 * flame_intensity;
+            double flicker = 0.8 + 0.2 * sin(ship->burner_flicker_timer * 30.0 + i);
+
+            // Outer flame (orange/red), fading at the tip
+            DrawPoint outer[3] = {
+                {(float)(flame_base_x - flame_dir_y * flame_width), (float)(flame_base_y + flame_dir_x * flame_width),
+                 dl_color(1.0f, 0.4f, 0.0f, 1.0f)},
+                {(float)(flame_base_x + flame_dir_y * flame_width), (float)(flame_base_y - flame_dir_x * flame_width),
+                 dl_color(1.0f, 0.4f, 0.0f, 1.0f)},
+                {(float)(flame_base_x + flame_dir_x * outer_flame_length), (float)(flame_base_y + flame_dir_y * outer_flame_length),
+                 dl_color(1.0f, 0.2f, 0.0f, (float)flicker * 0.6f)}
+            };
+            drawlist_path(list, outer, 3, DL_FILL | DL_POINT_COLORS, 0.0f,
+                          dl_color(1.0f, 0.4f, 0.0f, 0.7f * (float)flame_intensity));
+
+            // Inner flame (bright yellow), narrower and shorter
+            double inner_flame_length = outer_flame_length * 0.6;
+            double inner_width = flame_width * 0.4;
+            DrawPoint inner[3] = {
+                {(float)(flame_base_x - flame_dir_y * inner_width), (float)(flame_base_y + flame_dir_x * inner_width),
+                 dl_color(1.0f, 1.0f, 0.3f, 1.0f)},
+                {(float)(flame_base_x + flame_dir_y * inner_width), (float)(flame_base_y - flame_dir_x * inner_width),
+                 dl_color(1.0f, 1.0f, 0.3f, 1.0f)},
+                {(float)(flame_base_x + flame_dir_x * inner_flame_length), (float)(flame_base_y + flame_dir_y * inner_flame_length),
+                 dl_color(1.0f, 1.0f, 0.6f, (float)flicker * 0.9f)}
+            };
+            drawlist_path(list, inner, 3, DL_FILL | DL_POINT_COLORS, 0.0f,
+                          dl_color(1.0f, 1.0f, 0.3f, 0.8f * (float)flame_intensity));
+        }
+
+        // Juggernaut health bar (type 5 only), below the ship and not rotated
+        if (ship->ship_type == 5) {
+            float bar_width = 60.0f;
+            float bar_height = 8.0f;
+            float bar_x = (float)ship->x - bar_width / 2.0f;
+            float bar_y = (float)ship->y + 50.0f;
+            DrawColor gray = dl_color(0.3f, 0.3f, 0.3f, 1.0f);
+            drawlist_rect(list, bar_x, bar_y, bar_width, bar_height, DL_FILL, 0.0f, gray);
+            drawlist_rect(list, bar_x, bar_y, bar_width, bar_height, 0, 1.0f, gray);
+
+            // Green to yellow to red as health drops
+            float health_ratio = (float)ship->health / 10.0f;
+            if (health_ratio < 0.0f) health_ratio = 0.0f;
+            if (health_ratio > 1.0f) health_ratio = 1.0f;
+            DrawColor bar = health_ratio > 0.5f ? dl_color((1.0f - health_ratio) * 2.0f, 1.0f, 0.0f, 1.0f)
+                                                : dl_color(1.0f, health_ratio * 2.0f, 0.0f, 1.0f);
+            drawlist_rect(list, bar_x + 1.0f, bar_y + 1.0f, (bar_width - 2.0f) * health_ratio, bar_height - 2.0f,
+                          DL_FILL, 0.0f, bar);
+        }
+
+        // ========== SHIELD CIRCLE ==========
+        if (ship->shield_health > 0) {
+            DrawColor shield;
+            switch (ship->ship_type) {
+                case 1:  shield = dl_color(1.0f, 0.5f, 0.0f, 0.5f); break;   // Red ship: orange/red
+                case 2:  shield = dl_color(0.5f, 1.0f, 0.5f, 0.5f); break;   // Hunter: bright green
+                case 3:  shield = dl_color(0.8f, 0.4f, 1.0f, 0.5f); break;   // Sentinel: bright purple
+                case 4:  shield = dl_color(0.2f, 0.9f, 1.0f, 0.6f); break;   // Brown coat: brighter cyan
+                case 5:  shield = dl_color(1.0f, 0.9f, 0.2f, 0.5f); break;   // Juggernaut: golden glow
+                default: shield = dl_color(0.2f, 0.6f, 1.0f, 0.5f); break;
+            }
+
+            // Shield radius scales with ship size
+            float shield_radius = ship->ship_type == 5 ? 50.0f : (ship->ship_type == 4 ? 24.0f : 22.0f);
+            drawlist_circle(list, (float)ship->x, (float)ship->y, shield_radius, 0, 2.0f, shield);
+
+            // Impact flash with an expanding ring
+            if (ship->shield_impact_timer > 0) {
+                float flash_alpha = (float)(ship->shield_impact_timer / 0.2);
+                if (flash_alpha > 1.0f) flash_alpha = 1.0f;
+
+                float impact_x = (float)(ship->x + 22.0 * cos(ship->shield_impact_angle));
+                float impact_y = (float)(ship->y + 22.0 * sin(ship->shield_impact_angle));
+                drawlist_circle(list, impact_x, impact_y, 4.0f, DL_FILL, 0.0f,
+                                dl_color(1.0f, 1.0f, 1.0f, flash_alpha * 0.8f));
+                drawlist_circle(list, impact_x, impact_y, 6.0f + (1.0f - flash_alpha) * 10.0f, 0, 1.0f,
+                                dl_color(1.0f, 1.0f, 1.0f, flash_alpha * 0.4f));
+            }
+        }
+
+        // Formation lines between sentinels
+        if (ship->ship_type == 3) {
+            for (int j = i + 1; j < game->enemy_ship_count; j++) {
+                const EnemyShip *other = &game->enemy_ships[j];
+                if (other->active && other->ship_type == 3 && other->formation_id == ship->formation_id) {
+                    drawlist_line(list, (float)ship->x, (float)ship->y, (float)other->x, (float)other->y,
+                                  1.0f, dl_color(0.8f, 0.4f, 1.0f, 0.3f));
+                }
+            }
+        }
+    }
+}
+
+static void drawlist_emit_ufos(DrawList *list, const CometBusterGame *game) {
+    for (int i = 0; i < game->ufo_count; i++) {
+        const UFO *ufo = &game->ufos[i];
+        if (!ufo->active) continue;
+
+        // Cyan, white while flashing from a hit
+        DrawColor tint = ufo->damage_flash_timer > 0 ? dl_color(1.0f, 1.0f, 1.0f, 1.0f)
+                                                     : dl_color(0.0f, 1.0f, 1.0f, 1.0f);
+        drawlist_shape(list, DL_SHAPE_UFO, (float)ufo->x, (float)ufo->y, 0.0f, 1.0f, tint);
+
+        // Health dots above the dome once it has been hit
+        if (ufo->health < ufo->max_health) {
+            for (int h = 0; h < ufo->max_health; h++) {
+                DrawColor dot = h < ufo->health ? dl_color(0.0f, 1.0f, 1.0f, 1.0f)
+                                                : dl_color(0.3f, 0.3f, 0.3f, 1.0f);
+                drawlist_circle(list, (float)(ufo->x - 10.0 + h * 10.0), (float)(ufo->y - 20.0 - 8.0),
+                                2.0f, DL_FILL, 0.0f, dot);
+            }
+        }
+    }
+}
+
+static void drawlist_emit_enemy_bullets(DrawList *list, const CometBusterGame *game, int begin, int end) {
+    DrawColor cyan = dl_color(0.0f, 1.0f, 1.0f, 1.0f);
+    for (int i = begin; i < end; i++) {
+        const Bullet *b = &game->enemy_bullets[i];
+        if (!b->active) continue;
+        drawlist_sprite(list, DL_SPRITE_DISC, (float)b->x, (float)b->y, 3.0f, 0.0f, 0.0f, cyan);
+    }
+}
+
+static void drawlist_emit_boss_bullets(DrawList *list, const CometBusterGame *game, int begin, int end) {
+    // Same look as enemy bullets
+    const BossBulletPool *pool = &game->boss_bullets;
+    DrawColor cyan = dl_color(0.0f, 1.0f, 1.0f, 1.0f);
+    for (int i = begin; i < end; i++) {
+        if (pool->lifetime[i] <= 0) continue;
+        drawlist_sprite(list, DL_SPRITE_DISC, (float)pool->x[i], (float)pool->y[i], 3.0f, 0.0f, 0.0f, cyan);
+    }
+}
+
+// Fade out over the last two seconds of a pickup's life
+static float drawlist_pickup_alpha(double lifetime) {
+    return lifetime < 2.0 ? (float)(lifetime / 2.0) : 1.0f;
+}
+
+static void drawlist_emit_pickups(DrawList *list, const CometBusterGame *game) {
+    for (int i = 0; i < game->canister_count; i++) {
+        const Canister *c = &game->canisters[i];
+        if (!c->active) continue;
+        drawlist_shape(list, DL_SHAPE_CANISTER, (float)c->x, (float)c->y, (float)(c->rotation * M_PI / 180.0),
+                       1.0f, dl_color(1.0f, 1.0f, 1.0f, drawlist_pickup_alpha(c->lifetime)));
+    }
+
+    for (int i = 0; i < game->missile_pickup_count; i++) {
+        const MissilePickup *p = &game->missile_pickups[i];
+        if (!p->active) continue;
+        drawlist_shape(list, DL_SHAPE_MISSILE_PICKUP, (float)p->x, (float)p->y, (float)(p->rotation * M_PI / 180.0),
+                       1.0f, dl_color(1.0f, 1.0f, 1.0f, drawlist_pickup_alpha(p->lifetime)));
+    }
+
+    for (int i = 0; i < game->bomb_pickup_count; i++) {
+        const BombPickup *p = &game->bomb_pickups[i];
+        if (!p->active) continue;
+        drawlist_shape(list, DL_SHAPE_BOMB_PICKUP, (float)p->x, (float)p->y, (float)(p->rotation * M_PI / 180.0),
+                       1.0f, dl_color(1.0f, 1.0f, 1.0f, drawlist_pickup_alpha(p->lifetime)));
+    }
+}
+
+static void drawlist_emit_ship(DrawList *list, const CometBusterGame *game) {
+    double ship_size = 12.0;
+    double cos_a = cos(game->ship_angle);
+    double sin_a = sin(game->ship_angle);
+
+    // ========== MAIN SHIP BODY ==========
+    // The invulnerability flash fades the outline
+    float a = 1.0f;
+    if (game->invulnerability_time > 0) {
+        a = (float)(sin(game->invulnerability_time * 10.0) * 0.5 + 0.5);
+    }
+    drawlist_shape(list, DL_SHAPE_PLAYER_SHIP, (float)game->ship_x, (float)game->ship_y,
+                   (float)game->ship_angle, 1.0f, dl_color(1.0f, 1.0f, 1.0f, a));
+
+    // ========== MUZZLE FLASH ==========
+    if (game->muzzle_flash_timer > 0) {
+        float alpha = (float)(game->muzzle_flash_timer / 0.1);
+        if (alpha > 1.0f) alpha = 1.0f;
+
+        // (12,0), (12+20,-5), (12+20,5) in ship space
+        double muzzle_local[3][2] = {
+            {ship_size, 0},
+            {ship_size + 20.0, -5.0},
+            {ship_size + 20.0, 5.0}
+        };
+        DrawColor yellow = dl_color(1.0f, 1.0f, 0.0f, alpha);
+        DrawPoint muzzle[3];
+        for (int i = 0; i < 3; i++) {
+            muzzle[i].x = (float)(muzzle_local[i][0] * cos_a - muzzle_local[i][1] * sin_a + game->ship_x);
+            muzzle[i].y = (float)(muzzle_local[i][0] * sin_a + muzzle_local[i][1] * cos_a + game->ship_y);
+            muzzle[i].color = yellow;
+        }
+        drawlist_path(list, muzzle, 3, DL_FILL, 0.0f, yellow);
+    }
+
+    // ========== BURNER/THRUSTER EFFECT ==========
+    if (game->burner_intensity > 0.01) {
+        float flicker = 0.7f + 0.3f * sinf((float)game->burner_intensity * 20.0f);
+        float effective_intensity = (float)game->burner_intensity * flicker;
+
+        // Longer at speed
+        double speed = sqrt(game->ship_vx * game->ship_vx + game->ship_vy * game->ship_vy);
+        double length_mult = 1.0 + (speed / 150.0) * 0.5;
+        double flame_length = 30.0 * effective_intensity * length_mult;
+        double flame_width = 8.0 * effective_intensity;
+
+        // Tapered flame from the back of the ship (x = -ship_size)
+        double burner_local[4][2] = {
+            {-ship_size, -flame_width},
+            {-ship_size - flame_length, -flame_width * 0.3},
+            {-ship_size - flame_length, flame_width * 0.3},
+            {-ship_size, flame_width}
+        };
+        DrawPoint burner[4];
+        for (int i = 0; i < 4; i++) {
+            burner[i].x = (float)(burner_local[i][0] * cos_a - burner_local[i][1] * sin_a + game->ship_x);
+            burner[i].y = (float)(burner_local[i][0] * sin_a + burner_local[i][1] * cos_a + game->ship_y);
+            // Yellow -> orange -> red
+            burner[i].color = dl_color(1.0f, 0.7f * (1.0f - (float)i / 3.0f), 0.0f, effective_intensity * 0.7f);
+        }
+        drawlist_path(list, burner, 4, DL_FILL | DL_POINT_COLORS, 0.0f,
+                      dl_color(1.0f, 0.7f, 0.0f, effective_intensity * 0.7f));
+    }
+
+    // ========== SHIELD CIRCLE ==========
+    if (game->shield_health > 0) {
+        float shield_alpha = (float)game->shield_health / (float)game->max_shield_health;
+
+        // Cyan when healthy, orange when medium, red when critical
+        float r = 0.0f, g = 1.0f, b = 1.0f;
+        if (game->shield_health < 2) {
+            r = 1.0f; g = 0.8f; b = 0.0f;
+        }
+        DrawColor shield = dl_color(r, g, b, shield_alpha * 0.6f);
+        float ship_x = (float)game->ship_x;
+        float ship_y = (float)game->ship_y;
+        drawlist_circle(list, ship_x, ship_y, 28.0f, 0, 2.5f, shield);
+
+        // One pip per shield point, starting at the top
+        double segment_angle = (2.0 * M_PI) / game->max_shield_health;
+        for (int i = 0; i < game->shield_health; i++) {
+            double angle = (i * segment_angle) - (M_PI / 2.0);
+            drawlist_line(list, (float)(ship_x + 24.0 * cos(angle)), (float)(ship_y + 24.0 * sin(angle)),
+                          (float)(ship_x + 32.0 * cos(angle)), (float)(ship_y + 32.0 * sin(angle)), 1.5f, shield);
+        }
+
+        // Impact flash with an expanding ring
+        if (game->shield_impact_timer > 0) {
+            float flash_alpha = (float)(game->shield_impact_timer / 0.2);
+            if (flash_alpha > 1.0f) flash_alpha = 1.0f;
+
+            float impact_x = (float)(ship_x + 28.0 * cos(game->shield_impact_angle));
+            float impact_y = (float)(ship_y + 28.0 * sin(game->shield_impact_angle));
+            drawlist_circle(list, impact_x, impact_y, 5.0f, DL_FILL, 0.0f,
+                            dl_color(1.0f, 1.0f, 1.0f, flash_alpha * 0.8f));
+            drawlist_circle(list, impact_x, impact_y, 8.0f + (1.0f - flash_alpha) * 12.0f, 0, 1.0f,
+                            dl_color(1.0f, 1.0f, 1.0f, flash_alpha * 0.4f));
+        }
+    }
+}
+
+static void drawlist_emit_comets(DrawList *list, const CometBusterGame *game, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+        const Comet *c = &game->comets[i];
+        // Skip inactive (destroyed) comets - DO NOT RENDER THEM
+        if (!c->active) continue;
+        drawlist_comet(list, c);
+    }
+}
+
+// The pool swaps particles around as they die; vx is fixed at launch
+// (gravity only pulls on vy), so it names a particle for thinning
+static unsigned int drawlist_particle_key(const Particle *p) {
+    double vx = (double)p->vx;
+    unsigned long long bits;
+    memcpy(&bits, &vx, sizeof(bits));
+    return (unsigned int)(bits ^ (bits >> 32));
+}
+
+static void drawlist_emit_particles(DrawList *list, const CometBusterGame *game, int begin, int end) {
+    // One disc per particle, fading out over its life
+    for (int i = begin; i < end; i++) {
+        const Particle *p = &game->particles[i];
+        if (!p->active) continue;
+        if (!drawlist_keep_particle(drawlist_particle_key(p), list->particle_density)) continue;
+
+        float alpha = (float)(p->lifetime / p->max_lifetime);
+        drawlist_sprite(list, DL_SPRITE_DISC, (float)p->x, (float)p->y, (float)p->size, 0.0f, 0.0f,
+                        dl_color((float)p->color[0], (float)p->color[1], (float)p->color[2], alpha));
+    }
+}
+
+// Explosion debris, when the GPU simulates it (the spawns themselves are
+// copied once per build, see drawlist_copy_spawns)
+static void drawlist_emit_debris(DrawList *list, const CometBusterGame *game) {
+    (void)game;
+    if (comet_buster_gpu_particles_enabled()) {
+        drawlist_debris(list);
+    }
+}
+
+// ============================================================================
+// MISSILES AND BOMBS
+// ============================================================================
+
+// Rotate local (x, y) by (cos_a, sin_a) and move it to (ox, oy)
+static DrawPoint drawlist_point(float x, float y, float cos_a, float sin_a, float ox, float oy, DrawColor color) {
+    DrawPoint p = {x * cos_a - y * sin_a + ox, x * sin_a + y * cos_a + oy, color};
+    return p;
+}
+
+static void drawlist_emit_missiles(DrawList *list, const CometBusterGame *game) {
+    // Nose cone, body, and two small thruster fins, facing +x
+    static const float body[10][2] = {
+        {10.0f,  0.0f},     // Pointed nose
+        {6.0f,   2.0f},     // Upper body
+        {4.0f,   3.0f},     // Upper thruster start
+        {0.0f,   3.5f},     // Upper thruster wing
+        {-4.0f,  1.5f},     // Upper back
+        {-6.0f,  0.0f},     // Back center
+        {-4.0f, -1.5f},     // Lower back
+        {0.0f,  -3.5f},     // Lower thruster wing
+        {4.0f,  -3.0f},     // Lower thruster start
+        {6.0f,  -2.0f}      // Lower body
+    };
+    const float flame_length = 8.0f;
+    const float flame_width = 2.5f;
+    const float thruster_size = 1.5f;
+
+    for (int i = 0; i < game->missile_count; i++) {
+        const Missile *missile = &game->missiles[i];
+        if (!missile->active) continue;
+
+        // Fade over the last half second
+        float alpha = 1.0f;
+        if (missile->lifetime < 0.5) {
+            alpha = (float)(missile->lifetime / 0.5);
+        }
+
+        // Fill and outline by target: 0 cyan (furthest comet), 1 red (ships
+        // and boss), 2 green (closest comets), 3 magenta (~400px), 4 orange
+        // (200-600px); anything else yellow
+        DrawColor fill = dl_color(1.0f, 1.0f, 0.2f, alpha);
+        DrawColor stroke = dl_color(1.0f, 0.8f, 0.0f, alpha);
+        switch (missile->missile_type) {
+            case 0: fill = dl_color(0.2f, 1.0f, 1.0f, alpha); stroke = dl_color(0.0f, 0.8f, 1.0f, alpha); break;
+            case 1: fill = dl_color(1.0f, 0.2f, 0.2f, alpha); stroke = dl_color(1.0f, 0.0f, 0.0f, alpha); break;
+            case 2: fill = dl_color(0.2f, 1.0f, 0.2f, alpha); stroke = dl_color(0.0f, 0.8f, 0.0f, alpha); break;
+            case 3: fill = dl_color(1.0f, 0.2f, 1.0f, alpha); stroke = dl_color(0.8f, 0.0f, 0.8f, alpha); break;
+            case 4: fill = dl_color(1.0f, 0.6f, 0.0f, alpha); stroke = dl_color(1.0f, 0.4f, 0.0f, alpha); break;
+        }
+        DrawColor flame = dl_color(1.0f, 0.2f, 0.0f, alpha);
+
+        float cos_a = cosf((float)missile->angle);
+        float sin_a = sinf((float)missile->angle);
+        float mx = (float)missile->x;
+        float my = (float)missile->y;
+
+        // Exhaust flame behind the missile
+        DrawColor exhaust = dl_color(1.0f, 0.2f, 0.0f, alpha * 0.6f);
+        DrawPoint tail[3] = {
+            drawlist_point(-6.0f, -flame_width, cos_a, sin_a, mx, my, exhaust),
+            drawlist_point(-6.0f, flame_width, cos_a, sin_a, mx, my, exhaust),
+            drawlist_point(-6.0f - flame_length, 0.0f, cos_a, sin_a, mx, my, exhaust)
+        };
+        drawlist_path(list, tail, 3, DL_FILL, 0.0f, exhaust);
+
+        // Body, then its outline for definition
+        DrawPoint hull[10];
+        for (int j = 0; j < 10; j++) {
+            hull[j] = drawlist_point(body[j][0], body[j][1], cos_a, sin_a, mx, my, fill);
+        }
+        drawlist_path(list, hull, 10, DL_FILL, 0.0f, fill);
+        drawlist_path(list, hull, 10, DL_CLOSED, 1.5f, stroke);
+
+        // Thruster nozzles on the wings
+        DrawPoint upper[3] = {
+            drawlist_point(0.0f, 3.5f, cos_a, sin_a, mx, my, flame),
+            drawlist_point(thruster_size, 3.0f, cos_a, sin_a, mx, my, flame),
+            drawlist_point(-thruster_size, 3.0f, cos_a, sin_a, mx, my, flame)
+        };
+        drawlist_path(list, upper, 3, DL_FILL, 0.0f, flame);
+        DrawPoint lower[3] = {
+            drawlist_point(0.0f, -3.5f, cos_a, sin_a, mx, my, flame),
+            drawlist_point(-thruster_size, -3.0f, cos_a, sin_a, mx, my, flame),
+            drawlist_point(thruster_size, -3.0f, cos_a, sin_a, mx, my, flame)
+        };
+        drawlist_path(list, lower, 3, DL_FILL, 0.0f, flame);
+    }
+}
+
+static void drawlist_emit_bombs(DrawList *list, const CometBusterGame *game) {
+    for (int i = 0; i < game->bomb_count; i++) {
+        const Bomb *bomb = &game->bombs[i];
+        if (!bomb->active) continue;
+
+        float bx = (float)bomb->x;
+        float by = (float)bomb->y;
+
+        if (!bomb->detonated) {
+            // Orange body, brighter as the countdown runs
+            float pulse = (float)(1.0 - (bomb->lifetime / bomb->max_lifetime) * 0.3);
+            drawlist_circle(list, bx, by, 15.0f, DL_FILL, 0.0f, dl_color(pulse, 0.6f, 0.0f, 1.0f));
+            drawlist_circle(list, bx, by, 15.0f, 0, 2.0f, dl_color(1.0f, 0.8f, 0.0f, 1.0f));
+
+            // Fuse and spark, turning with the bomb
+            double rotation_rad = bomb->rotation * (M_PI / 180.0);
+            float fx = (float)sin(rotation_rad);
+            float fy = (float)-cos(rotation_rad);
+            drawlist_line(list, bx + fx * 15.0f, by + fy * 15.0f, bx + fx * 28.0f, by + fy * 28.0f,
+                          2.0f, dl_color(0.7f, 0.3f, 0.1f, 1.0f));
+            drawlist_circle(list, bx + fx * 28.0f, by + fy * 28.0f, 3.0f, DL_FILL, 0.0f,
+                            dl_color(1.0f, 1.0f, 0.2f, 1.0f));
+
+            // Countdown centred on the bomb
+            int countdown = (int)(bomb->lifetime + 1);
+            if (countdown < 1) countdown = 1;
+            char text[8];
+            snprintf(text, sizeof(text), "%d", countdown);
+            drawlist_text(list, text, bx, by + 4.0f, 12, DL_TEXT_CENTER, dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+        } else {
+            // Explosion wave: thinning and fading as it expands
+            double wave_progress = bomb->wave_radius / bomb->wave_max_radius;
+            float opacity = (float)(1.0 - wave_progress);
+            float radius = (float)bomb->wave_radius;
+
+            drawlist_circle(list, bx, by, radius, 0, (float)(3.0 * (1.0 - wave_progress)),
+                            dl_color(1.0f, 0.7f, 0.0f, opacity * 0.8f));
+
+            // Inner shock ring
+            if (bomb->wave_radius > 20) {
+                drawlist_circle(list, bx, by, radius - 20.0f, 0, 2.0f, dl_color(1.0f, 1.0f, 0.5f, opacity * 0.6f));
+            }
+
+            // Faint fill over the swept area
+            drawlist_circle(list, bx, by, radius, DL_FILL, 0.0f, dl_color(1.0f, 0.5f, 0.0f, opacity * 0.15f));
+        }
+    }
+}
+
+// ============================================================================
+// BOSSES
+// ============================================================================
+
+// Background, fill by 'ratio' and border
+static void drawlist_health_bar(DrawList *list, double x, double y, double w, double h, double ratio,
+                                DrawColor back, DrawColor fill, DrawColor border) {
+    drawlist_rect(list, (float)x, (float)y, (float)w, (float)h, DL_FILL, 0.0f, back);
+    drawlist_rect(list, (float)x, (float)y, (float)(w * ratio), (float)h, DL_FILL, 0.0f, fill);
+    drawlist_rect(list, (float)x, (float)y, (float)w, (float)h, 0, 1.0f, border);
+}
+
+// 'sides' corners at 'radius' around (cx, cy), the first at 'angle'
+static void drawlist_polygon_points(DrawPoint *points, int sides, double cx, double cy, double radius,
+                                    double angle, DrawColor color) {
+    for (int i = 0; i < sides; i++) {
+        double a = (i * 2.0 * M_PI / sides) + angle;
+        points[i].x = (float)(cx + cos(a) * radius);
+        points[i].y = (float)(cy + sin(a) * radius);
+        points[i].color = color;
+    }
+}
+
+// Ellipse with semi-axes (rx, ry) rotated by 'rotation' radians
+static void drawlist_ellipse_points(DrawPoint *points, int segments, double cx, double cy, double rx, double ry,
+                                    double rotation, DrawColor color) {
+    float cos_rot = (float)cos(rotation);
+    float sin_rot = (float)sin(rotation);
+    for (int i = 0; i < segments; i++) {
+        double angle = 2.0 * M_PI * i / segments;
+        float x = (float)cos(angle) * (float)rx;
+        float y = (float)sin(angle) * (float)ry;
+        points[i].x = (float)cx + x * cos_rot - y * sin_rot;
+        points[i].y = (float)cy + x * sin_rot + y * cos_rot;
+        points[i].color = color;
+    }
+}
+
+static void drawlist_emit_death_star(DrawList *list, const CometBusterGame *game, const BossShip *boss) {
+    float bx = (float)boss->x;
+    float by = (float)boss->y;
+    DrawColor white = dl_color(1.0f, 1.0f, 1.0f, 1.0f);
+
+    // Hull, the damage highlight, then the ring, spokes and core over it
+    drawlist_shape(list, DL_SHAPE_BOSS_BODY, bx, by, 0.0f, 1.0f, white);
+    if (boss->damage_flash_timer > 0) {
+        drawlist_circle(list, bx, by, 35.0f, DL_FILL, 0.0f, dl_color(1.0f, 0.5f, 0.5f, 0.7f));
+    }
+    drawlist_shape(list, DL_SHAPE_BOSS_DETAIL, bx, by, 0.0f, 1.0f, white);
+
+    drawlist_health_bar(list, boss->x - 40.0, boss->y - 50.0, 80.0, 6.0, (double)boss->health / boss->max_health,
+                        dl_color(0.3f, 0.3f, 0.3f, 1.0f), dl_color(1.0f, 0.2f, 0.2f, 1.0f), white);
+
+    if (boss->shield_active && boss->shield_health > 0) {
+        double shield_radius = 50.0;
+        double shield_ratio = (double)boss->shield_health / boss->max_shield_health;
+
+        // Pulsing glow, outline, and a tick per remaining segment
+        float pulse_alpha = 0.3f + 0.1f * (float)sin(boss->shield_impact_timer * 10.0);
+        drawlist_circle(list, bx, by, (float)shield_radius, DL_FILL, 0.0f, dl_color(0.0f, 0.8f, 1.0f, pulse_alpha));
+        drawlist_circle(list, bx, by, (float)shield_radius, 0, 2.0f, dl_color(0.0f, 1.0f, 1.0f, 0.8f));
+
+        int num_segments = 12;
+        for (int i = 0; i < (int)(num_segments * shield_ratio) && i < num_segments; i++) {
+            double angle = (i * 2.0 * M_PI / num_segments);
+            drawlist_line(list, (float)(boss->x + cos(angle) * (shield_radius - 3.0)),
+                          (float)(boss->y + sin(angle) * (shield_radius - 3.0)),
+                          (float)(boss->x + cos(angle) * (shield_radius + 3.0)),
+                          (float)(boss->y + sin(angle) * (shield_radius + 3.0)), 1.5f,
+                          dl_color(0.0f, 1.0f, 1.0f, 1.0f));
+        }
+    }
+
+    // Phase: yellow, cyan when shielded, red when enraged
+    const char *phase_text;
+    DrawColor phase_color;
+    if (boss->phase == 0) {
+        phase_text = phase_normal_text[game->current_language];
+        phase_color = dl_color(1.0f, 1.0f, 0.5f, 1.0f);
+    } else if (boss->phase == 1) {
+        phase_text = phase_shielded_text[game->current_language];
+        phase_color = dl_color(0.0f, 1.0f, 1.0f, 1.0f);
+    } else {
+        phase_text = phase_enraged_text[game->current_language];
+        phase_color = dl_color(1.0f, 0.2f, 0.2f, 1.0f);
+    }
+    drawlist_text(list, phase_text, (float)(int)(boss->x - 25), (float)(int)(boss->y - 25), 10, 0, phase_color);
+}
+
+static void drawlist_emit_spawn_queen(DrawList *list, const CometBusterGame *game, const SpawnQueenBoss *queen) {
+    const int segments = 32;
+    double major_axis = 70.0;
+    double minor_axis = 45.0;
+    double rotation = queen->rotation * M_PI / 180.0;
+    DrawPoint ellipse[32];
+
+    // Magenta body with a darker turning pattern to show the rotation,
+    // the cyan rim, and a faint glow around it all
+    drawlist_ellipse_points(ellipse, segments, queen->x, queen->y, major_axis, minor_axis, rotation,
+                            dl_color(0.7f, 0.3f, 0.8f, 1.0f));
+    drawlist_path(list, ellipse, segments, DL_FILL, 0.0f, dl_color(0.7f, 0.3f, 0.8f, 1.0f));
+    drawlist_ellipse_points(ellipse, segments, queen->x, queen->y, 50.0, 20.0, rotation,
+                            dl_color(0.4f, 0.1f, 0.5f, 0.6f));
+    drawlist_path(list, ellipse, segments, DL_FILL, 0.0f, dl_color(0.4f, 0.1f, 0.5f, 0.6f));
+    drawlist_ellipse_points(ellipse, segments, queen->x, queen->y, major_axis, minor_axis, rotation,
+                            dl_color(0.0f, 1.0f, 1.0f, 0.7f));
+    drawlist_path(list, ellipse, segments, DL_CLOSED, 2.5f, dl_color(0.0f, 1.0f, 1.0f, 0.7f));
+    drawlist_ellipse_points(ellipse, segments, queen->x, queen->y, major_axis + 10.0, minor_axis + 10.0, rotation,
+                            dl_color(0.0f, 0.8f, 1.0f, 0.2f));
+    drawlist_path(list, ellipse, segments, DL_FILL, 0.0f, dl_color(0.0f, 0.8f, 1.0f, 0.2f));
+
+    // Six spawn ports round the equator, red / magenta / purple by phase
+    float port_r, port_g, port_b;
+    if (queen->phase == 0) {
+        port_r = 1.0f; port_g = 0.2f; port_b = 0.2f;
+    } else if (queen->phase == 1) {
+        port_r = 1.0f; port_g = 0.5f; port_b = 0.8f;
+    } else {
+        port_r = 0.8f; port_g = 0.3f; port_b = 1.0f;
+    }
+    double glow_intensity = 0.5 + 0.5 * sin(queen->spawn_particle_timer * 5.0);
+    for (int i = 0; i < 6; i++) {
+        double angle = 2.0 * M_PI * i / 6.0;
+        float px = (float)(queen->x + cos(angle) * 50.0);
+        float py = (float)(queen->y + sin(angle) * 50.0 * 0.6);
+        drawlist_circle(list, px, py, 10.0f, DL_FILL, 0.0f, dl_color(port_r, port_g, port_b, (float)(glow_intensity * 0.5)));
+        drawlist_circle(list, px, py, 6.0f, DL_FILL, 0.0f, dl_color(port_r, port_g, port_b, 1.0f));
+    }
+
+    if (queen->damage_flash_timer > 0) {
+        drawlist_ellipse_points(ellipse, segments, queen->x, queen->y, major_axis, minor_axis, rotation,
+                                dl_color(1.0f, 0.5f, 0.5f, 0.4f));
+        drawlist_path(list, ellipse, segments, DL_FILL, 0.0f, dl_color(1.0f, 0.5f, 0.5f, 0.4f));
+    }
+
+    // Red pulsing core
+    double core_size = 12.0 + 3.0 * sin(queen->phase_timer * 3.0);
+    drawlist_circle(list, (float)queen->x, (float)queen->y, (float)core_size, DL_FILL, 0.0f,
+                    dl_color(1.0f, 0.2f, 0.2f, 1.0f));
+
+    // Health, and shield just below it
+    double bar_x = queen->x - 50.0;
+    double bar_y = queen->y - 70.0;
+    DrawColor back = dl_color(0.2f, 0.2f, 0.2f, 1.0f);
+    DrawColor white = dl_color(1.0f, 1.0f, 1.0f, 1.0f);
+    drawlist_health_bar(list, bar_x, bar_y, 100.0, 8.0, (double)queen->health / queen->max_health,
+                        back, dl_color(1.0f, 0.2f, 0.2f, 1.0f), white);
+    drawlist_health_bar(list, bar_x, bar_y + 10.0, 100.0, 8.0, (double)queen->shield_health / queen->max_shield_health,
+                        back, dl_color(0.0f, 1.0f, 1.0f, 1.0f), white);
+
+    // Phase: orange, yellow, red
+    const char *phase_text;
+    DrawColor phase_color;
+    if (queen->phase == 0) {
+        phase_text = queen_phase_recruiting_text[game->current_language];
+        phase_color = dl_color(1.0f, 0.5f, 0.0f, 1.0f);
+    } else if (queen->phase == 1) {
+        phase_text = queen_phase_aggressive_text[game->current_language];
+        phase_color = dl_color(1.0f, 1.0f, 0.0f, 1.0f);
+    } else {
+        phase_text = queen_phase_desperate_text[game->current_language];
+        phase_color = dl_color(1.0f, 0.0f, 0.0f, 1.0f);
+    }
+    drawlist_text(list, phase_text, (float)(int)(queen->x - 35), (float)(int)(queen->y + 75), 11, 0, phase_color);
+}
+
+static void drawlist_emit_void_nexus(DrawList *list, const BossShip *boss) {
+    float bx = (float)boss->x;
+    float by = (float)boss->y;
+
+    if (boss->fragment_count == 0) {
+        // Pulsing energy ring behind a crystalline octagon
+        double pulse = 0.5 + 0.3 * sin(boss->rotation * M_PI / 180.0 * 0.1);
+        drawlist_circle(list, bx, by, (float)(40.0 + pulse * 5.0), DL_FILL, 0.0f,
+                        dl_color(0.2f, 0.8f, 1.0f, (float)pulse));
+
+        DrawColor cyan = dl_color(0.3f, 0.7f, 1.0f, 1.0f);
+        DrawPoint octagon[8];
+        drawlist_polygon_points(octagon, 8, boss->x, boss->y, 30.0, boss->rotation * M_PI / 180.0, cyan);
+        drawlist_path(list, octagon, 8, DL_FILL, 0.0f, cyan);
+        drawlist_path(list, octagon, 8, DL_CLOSED, 2.0f, cyan);
+
+        // White nucleus
+        drawlist_circle(list, bx, by, 6.0f, DL_FILL, 0.0f, dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+
+        if (boss->damage_flash_timer > 0) {
+            drawlist_circle(list, bx, by, 35.0f, DL_FILL, 0.0f, dl_color(1.0f, 0.5f, 0.5f, 0.6f));
+        }
+    } else {
+        // Split into hexagonal fragments, each with its health in red
+        for (int i = 0; i < boss->fragment_count; i++) {
+            double frag_x = boss->fragment_positions[i][0];
+            double frag_y = boss->fragment_positions[i][1];
+            double frag_pulse = 0.3 + 0.2 * sin((boss->rotation + i * 45) * M_PI / 180.0 * 0.1);
+
+            drawlist_circle(list, (float)frag_x, (float)frag_y, (float)(25.0 + frag_pulse * 3.0), DL_FILL, 0.0f,
+                            dl_color(0.0f, 1.0f, 1.0f, (float)frag_pulse));
+
+            DrawColor crystal = dl_color(0.2f, 0.9f, 1.0f, 1.0f);
+            DrawPoint hexagon[6];
+            drawlist_polygon_points(hexagon, 6, frag_x, frag_y, 20.0, 0.0, crystal);
+            drawlist_path(list, hexagon, 6, DL_FILL, 0.0f, crystal);
+            drawlist_path(list, hexagon, 6, DL_CLOSED, 1.5f, crystal);
+
+            drawlist_circle(list, (float)frag_x, (float)frag_y, 4.0f, DL_FILL, 0.0f, dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+
+            if (boss->fragment_health[i] > 0) {
+                char health_text[8];
+                snprintf(health_text, sizeof(health_text), "%d", boss->fragment_health[i]);
+                drawlist_text(list, health_text, (float)((int)frag_x - 5), (float)((int)frag_y + 3), 8, 0,
+                              dl_color(1.0f, 0.0f, 0.0f, 1.0f));
+            }
+        }
+    }
+
+    double health_percent = (double)boss->health / boss->max_health;
+    if (health_percent < 0) health_percent = 0;
+    drawlist_health_bar(list, boss->x - 50.0, boss->y - 55.0, 100.0, 8.0, health_percent,
+                        dl_color(0.2f, 0.2f, 0.2f, 1.0f), dl_color(0.0f, 1.0f, 1.0f, 1.0f),
+                        dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
+static void drawlist_emit_harbinger(DrawList *list, const BossShip *boss) {
+    float bx = (float)boss->x;
+    float by = (float)boss->y;
+    double core_size = 35.0;
+
+    // Outer aura, brightest in the frenzy phase
+    double aura_pulse = 0.3 + 0.4 * sin(boss->rotation * M_PI / 180.0 * 0.05);
+    if (boss->phase == 2) {
+        aura_pulse = 0.7;
+    }
+    drawlist_circle(list, bx, by, (float)(core_size + 15), DL_FILL, 0.0f,
+                    dl_color((float)(0.4 + aura_pulse * 0.3), 0.0f, (float)(0.8 + aura_pulse * 0.2), 0.6f));
+
+    // Dark purple six-pointed core with a magenta rim and yellow centre
+    DrawPoint hexagon[6];
+    drawlist_polygon_points(hexagon, 6, boss->x, boss->y, core_size, boss->rotation * M_PI / 180.0,
+                            dl_color(0.3f, 0.0f, 0.7f, 1.0f));
+    drawlist_path(list, hexagon, 6, DL_FILL, 0.0f, dl_color(0.3f, 0.0f, 0.7f, 1.0f));
+    drawlist_path(list, hexagon, 6, DL_CLOSED, 2.0f, dl_color(1.0f, 0.3f, 1.0f, 1.0f));
+    drawlist_circle(list, bx, by, 8.0f, DL_FILL, 0.0f, dl_color(1.0f, 1.0f, 0.0f, 1.0f));
+
+    // Laser charging (phase 1): four spokes
+    if (boss->phase == 1) {
+        for (int i = 0; i < 4; i++) {
+            double laser_angle = boss->laser_angle * M_PI / 180.0 + (i * M_PI / 2.0);
+            drawlist_line(list, bx, by, (float)(boss->x + cos(laser_angle) * 40.0),
+                          (float)(boss->y + sin(laser_angle) * 40.0), 2.0f, dl_color(1.0f, 0.5f, 1.0f, 1.0f));
+        }
+    }
+
+    // Gravity well (phase 2): a breathing ripple
+    if (boss->phase == 2 && boss->gravity_well_strength > 0) {
+        double ripple_size = 20.0 + 10.0 * sin(boss->rotation * M_PI / 180.0 * 0.1);
+        drawlist_circle(list, bx, by, (float)ripple_size, 0, 1.5f, dl_color(0.0f, 1.0f, 0.8f, 0.3f));
+    }
+
+    if (boss->damage_flash_timer > 0) {
+        drawlist_circle(list, bx, by, (float)core_size, DL_FILL, 0.0f, dl_color(1.0f, 0.2f, 0.2f, 0.6f));
+    }
+
+    double health_percent = (double)boss->health / boss->max_health;
+    if (health_percent < 0) health_percent = 0;
+    drawlist_health_bar(list, boss->x - 50.0, boss->y - 55.0, 100.0, 8.0, health_percent,
+                        dl_color(0.2f, 0.2f, 0.2f, 1.0f), dl_color(1.0f, 0.0f, 1.0f, 1.0f),
+                        dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
+static void drawlist_emit_star_vortex(DrawList *list, const BossShip *boss) {
+    float bx = (float)boss->x;
+    float by = (float)boss->y;
+    const int num_points = 6;
+    double outer_radius = 50.0;
+    double inner_radius = 25.0;
+
+    // Orange, red in phase 1, yellow in phase 2
+    float r = 1.0f, g = 0.6f, b = 0.0f;
+    if (boss->phase == 1) {
+        r = 1.0f; g = 0.3f; b = 0.3f;
+    } else if (boss->phase == 2) {
+        r = 1.0f; g = 1.0f; b = 0.0f;
+    }
+
+    // Six-pointed star, alternating outer and inner corners, with a
+    // darker outline
+    DrawPoint star[12];
+    for (int i = 0; i < num_points * 2; i++) {
+        double angle = (i * M_PI / num_points) + (boss->rotation * M_PI / 180.0);
+        double radius = (i % 2 == 0) ? outer_radius : inner_radius;
+        star[i].x = (float)(boss->x + cos(angle) * radius);
+        star[i].y = (float)(boss->y + sin(angle) * radius);
+        star[i].color = dl_color(r, g, b, 1.0f);
+    }
+    drawlist_path(list, star, num_points * 2, DL_FILL, 0.0f, dl_color(r, g, b, 1.0f));
+    drawlist_path(list, star, num_points * 2, DL_CLOSED, 2.0f, dl_color(r * 0.5f, g * 0.5f, b * 0.5f, 1.0f));
+
+    if (boss->damage_flash_timer > 0) {
+        drawlist_circle(list, bx, by, (float)(outer_radius * 1.2), DL_FILL, 0.0f,
+                        dl_color(1.0f, 1.0f, 1.0f, (float)boss->damage_flash_timer));
+    }
+
+    if (boss->shield_active && boss->shield_health > 0) {
+        double shield_ratio = (double)boss->shield_health / boss->max_shield_health;
+        drawlist_circle(list, bx, by, (float)(outer_radius + 10.0), 0, 3.0f,
+                        dl_color(0.2f, 0.8f, 1.0f, (float)(shield_ratio * 0.6)));
+    }
+
+    drawlist_health_bar(list, boss->x - 30.0, boss->y - 50.0, 60.0, 8.0, (double)boss->health / boss->max_health,
+                        dl_color(0.2f, 0.2f, 0.2f, 0.8f), dl_color(0.0f, 1.0f, 0.0f, 1.0f),
+                        dl_color(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
+static void drawlist_emit_singularity(DrawList *list, const BossShip *boss) {
+    float bx = (float)boss->x;
+    float by = (float)boss->y;
+
+    // The black hole grows in the later phases
+    double core_radius = boss->phase >= 2 ? 80.0 : 60.0;
+    drawlist_circle(list, bx, by, (float)core_radius, DL_FILL, 0.0f, dl_color(0.1f, 0.05f, 0.15f, 1.0f));
+
+    // Pulsing event horizon, and three fainter rings inside it
+    double glow_intensity = 0.2 + 0.3 * sin(boss->rotation * M_PI / 180.0 * 0.1);
+    drawlist_circle(list, bx, by, (float)(core_radius + 15), 0, 3.0f,
+                    dl_color(0.2f, 0.8f, 1.0f, (float)glow_intensity));
+    for (int ring = 1; ring <= 3; ring++) {
+        drawlist_circle(list, bx, by, (float)(core_radius - ring * 8), 0, 1.5f,
+                        dl_color(0.2f, 0.8f, 1.0f, (float)(0.3 - ring * 0.08)));
+    }
+
+    if (boss->damage_flash_timer > 0) {
+        drawlist_circle(list, bx, by, (float)(core_radius + 20), DL_FILL, 0.0f,
+                        dl_color(1.0f, 0.5f, 0.5f, (float)boss->damage_flash_timer));
+    }
+
+    // Orbiting satellites - status only, they do not collide
+    for (int i = 0; i < boss->fragment_count; i++) {
+        double angle = (i * 360.0 / boss->fragment_count + boss->rotation) * M_PI / 180.0;
+        float sat_x = (float)(boss->x + cos(angle) * 120.0);
+        float sat_y = (float)(boss->y + sin(angle) * 120.0);
+        drawlist_circle(list, sat_x, sat_y, 12.0f, DL_FILL, 0.0f, dl_color(0.0f, 1.0f, 1.0f, 0.5f));
+        drawlist_circle(list, sat_x, sat_y, 8.0f, DL_FILL, 0.0f, dl_color(0.3f, 1.0f, 1.0f, 1.0f));
+    }
+
+    double health_percent = (double)boss->health / boss->max_health;
+    if (health_percent < 0) health_percent = 0;
+    drawlist_health_bar(list, boss->x - 70.0, boss->y - 80.0, 140.0, 12.0, health_percent,
+                        dl_color(0.1f, 0.05f, 0.1f, 1.0f), dl_color(0.0f, 1.0f, 1.0f, 1.0f),
+                        dl_color(0.5f, 0.5f, 1.0f, 1.0f));
+}
+
+// Whichever boss is on screen: the Spawn Queen, or one per wave % 30
+static void drawlist_emit_boss(DrawList *list, const CometBusterGame *game) {
+    if (!game->boss_active) return;
+    if (game->spawn_queen.active && game->spawn_queen.is_spawn_queen) {
+        drawlist_emit_spawn_queen(list, game, &game->spawn_queen);
+        return;
+    }
+    if (!game->boss.active) return;
+
+    switch (game->current_wave % 30) {
+        case 5:  drawlist_emit_death_star(list, game, &game->boss); break;
+        case 10: drawlist_emit_spawn_queen(list, game, &game->spawn_queen); break;
+        case 15: drawlist_emit_void_nexus(list, &game->boss); break;
+        case 20: drawlist_emit_harbinger(list, &game->boss); break;
+        case 25: drawlist_emit_star_vortex(list, &game->boss); break;
+        case 0:  drawlist_emit_singularity(list, &game->boss); break;
+    }
+}
+
+// The splash backdrop always shows the Death Star
+static void drawlist_emit_splash_boss(DrawList *list, const CometBusterGame *game) {
+    if (game->boss_active && game->boss.active) {
+        drawlist_emit_death_star(list, game, &game->boss);
+    }
+}
+
+static void drawlist_emit_boss_explosion(DrawList *list, const CometBusterGame *game) {
+    const BossExplosion *explosion = &game->boss_explosion_effect;
+    for (int i = 0; i < explosion->particle_count; i++) {
+        const BossExplosionParticle *p = &explosion->particles[i];
+        if (!p->active) continue;
+
+        float r = (float)p->color[0], g = (float)p->color[1], b = (float)p->color[2];
+        float alpha = (float)p->glow_intensity;
+
+        if (p->is_radial_line) {
+            // Wide faint stroke under a bright thin one
+            float end_x = (float)(p->x + cos(p->angle) * p->length);
+            float end_y = (float)(p->y + sin(p->angle) * p->length);
+            drawlist_line(list, (float)p->x, (float)p->y, end_x, end_y, (float)(p->width * 4.0),
+                          dl_color(r, g, b, alpha * 0.3f));
+            drawlist_line(list, (float)p->x, (float)p->y, end_x, end_y, (float)p->width, dl_color(r, g, b, alpha));
+        } else {
+            // Halo and a bright core
+            drawlist_sprite(list, DL_SPRITE_GLOW, (float)p->x, (float)p->y, 8.0f, 0.0f, 0.0f,
+                            dl_color(r, g, b, alpha * 0.5f));
+            drawlist_circle(list, (float)p->x, (float)p->y, 3.0f, DL_FILL, 0.0f, dl_color(r, g, b, alpha));
+        }
+    }
+}
+
+// ============================================================================
+// HUD
+// ============================================================================
+
+static void drawlist_emit_hud(DrawList *list, const CometBusterGame *game) {
+    int width = list->width;
+    int height = list->height;
+    int lang = game->current_language;
+    DrawColor white = dl_color(1.0f, 1.0f, 1.0f, 1.0f);
+    DrawColor gray = dl_color(0.2f, 0.2f, 0.2f, 1.0f);
+    char text[256];
+
+    // --- TOP LEFT: score (with multiplier), lives, shield ---
+    snprintf(text, sizeof(text), "%s %d (x%.1f)", score_label_text[lang], game->score, game->score_multiplier);
+    drawlist_text(list, text, 20, 30, 18, 0, white);
+    snprintf(text, sizeof(text), "%s %d", lives_label_text[lang], game->ship_lives);
+    drawlist_text(list, text, 20, 55, 18, 0, white);
+
+    // Shield: red when gone, orange when low, cyan when healthy
+    DrawColor shield = dl_color(0.0f, 1.0f, 1.0f, 1.0f);
+    if (game->shield_health <= 0) {
+        shield = dl_color(1.0f, 0.3f, 0.3f, 1.0f);
+    } else if (game->shield_health == 1) {
+        shield = dl_color(1.0f, 0.8f, 0.0f, 1.0f);
+    }
+    snprintf(text, sizeof(text), "%s %d/%d", shield_label_text[lang], game->shield_health, game->max_shield_health);
+    drawlist_text(list, text, 20, 105, 18, 0, shield);
+
+    // --- TOP RIGHT: wave ---
+    snprintf(text, sizeof(text), HUD_WAVE_LABEL[lang], game->current_wave);
+    drawlist_text(list, text, (float)(width - 180), 30, 18, 0, white);
+    drawlist_text(list, text, (float)(width - 280), 55, 18, 0, white);
+
+    // Countdown to the next wave, or progress through this one
+    if (game->wave_complete_timer > 0) {
+        snprintf(text, sizeof(text), "%s %.1fs", next_wave_in_text[lang], game->wave_complete_timer);
+        drawlist_text(list, text, (float)(width / 2 - 160), (float)(height / 2 - 50), 18, 0,
+                      dl_color(1.0f, 1.0f, 0.0f, 1.0f));
+    } else if (game->comet_count > 0) {
+        int expected_count = comet_buster_get_wave_comet_count(game->current_wave);
+        snprintf(text, sizeof(text), "%s %d/%d", destroyed_label_text[lang], expected_count - game->comet_count,
+                 expected_count);
+        drawlist_text(list, text, (float)(width - 280), 75, 12, 0, white);
+    }
+
+    // --- FLOATING TEXT POPUPS ---
+    for (int i = 0; i < game->floating_text_count; i++) {
+        const FloatingText *ft = &game->floating_texts[i];
+        if (!ft->active) continue;
+        float alpha = (float)(ft->lifetime / ft->max_lifetime);
+        drawlist_text(list, ft->text, (float)((int)ft->x - 30), (float)(int)ft->y, 16, 0,
+                      dl_color((float)ft->color[0], (float)ft->color[1], (float)ft->color[2], alpha));
+    }
+
+    // --- BOTTOM LEFT: energy, coloured by level, over its bar ---
+    DrawColor energy = dl_color(0.2f, 1.0f, 0.2f, 1.0f);
+    if (game->energy_amount < 20) {
+        energy = dl_color(1.0f, 0.2f, 0.2f, 1.0f);
+    } else if (game->energy_amount < 50) {
+        energy = dl_color(1.0f, 1.0f, 0.0f, 1.0f);
+    }
+    snprintf(text, sizeof(text), "%s %.0f%%", energy_label_text[lang], game->energy_amount);
+    drawlist_text(list, text, 20, (float)(height - 40), 14, 0, energy);
+
+    double fuel_percent = game->energy_amount / game->max_energy;
+    DrawColor fuel = dl_color(1.0f, 0.2f, 0.2f, 1.0f);
+    if (fuel_percent > 0.5) {
+        fuel = dl_color(0.2f, 1.0f, 0.2f, 1.0f);
+    } else if (fuel_percent > 0.2) {
+        fuel = dl_color(1.0f, 1.0f, 0.0f, 1.0f);
+    }
+    drawlist_health_bar(list, 20, height - 25, 150, 12, fuel_percent, gray, fuel, white);
+
+    // --- MISSILES (assume max 100 for the bar, each pickup adds 20) ---
+    if (game->missile_ammo > 0 || game->using_missiles) {
+        DrawColor amber = dl_color(1.0f, 0.8f, 0.0f, 1.0f);
+        snprintf(text, sizeof(text), "%s %d", missiles_label_text[lang], game->missile_ammo);
+        drawlist_text(list, text, 20, (float)(height - 110), 14, 0, amber);
+        double missile_percent = (game->missile_ammo > 100) ? 1.0 : (game->missile_ammo / 100.0);
+        drawlist_health_bar(list, 20, height - 95, 150, 12, missile_percent, gray, amber, white);
+    }
+
+    // --- BOMBS (bar full at 10) ---
+    if (game->bomb_ammo > 0 || game->bomb_count > 0) {
+        DrawColor orange = dl_color(1.0f, 0.6f, 0.0f, 1.0f);
+        snprintf(text, sizeof(text), "%s %d", bombs_label_text[lang], game->bomb_ammo);
+        drawlist_text(list, text, 20, (float)(height - 65), 14, 0, orange);
+
+        if (game->bomb_count > 0) {
+            snprintf(text, sizeof(text), "%s %d", armed_label_text[lang], game->bomb_count);
+            drawlist_text(list, text, 20, (float)(height - 50), 12, 0, dl_color(1.0f, 1.0f, 0.0f, 1.0f));
+        }
+
+        double bomb_percent = (game->bomb_ammo > 10) ? 1.0 : (game->bomb_ammo / 10.0);
+        double bomb_bar_y = game->bomb_count > 0 ? (height - 35) : (height - 50);
+        drawlist_health_bar(list, 20, bomb_bar_y, 150, 12, bomb_percent, gray, orange, white);
+    }
+}
+
+static void drawlist_emit_game_over(DrawList *list, const CometBusterGame *game) {
+    if (!game->game_over) return;
+    int width = list->width;
+    int height = list->height;
+    char text[256];
+
+    drawlist_rect(list, 0.0f, 0.0f, (float)width, (float)height, DL_FILL, 0.0f, dl_color(0.0f, 0.0f, 0.0f, 0.6f));
+    drawlist_text(list, "GAME OVER!", (float)(width / 2 - 150), (float)(height / 2 - 80), 48, 0,
+                  dl_color(1.0f, 0.3f, 0.3f, 1.0f));
+
+    DrawColor white = dl_color(1.0f, 1.0f, 1.0f, 1.0f);
+    snprintf(text, sizeof(text), "%s %d", final_score_label_text[game->current_language], game->score);
+    drawlist_text(list, text, (float)(width / 2 - 120), (float)(height / 2), 24, 0, white);
+    snprintf(text, sizeof(text), "%s %d", wave_reached_label_text[game->current_language], game->current_wave);
+    drawlist_text(list, text, (float)(width / 2 - 100), (float)(height / 2 + 40), 24, 0, white);
+
+    // Pulsing restart prompt
+    float pulse = (float)(sin(game->game_over_timer * 3) * 0.5 + 0.5);
+    drawlist_text(list, "RIGHT CLICK to restart", (float)(width / 2 - 100), (float)(height / 2 + 100), 18, 0,
+                  dl_color(0.0f, 1.0f, 0.5f, pulse));
+}
+
+// ============================================================================
+// PARALLEL BUILD
+// ============================================================================
+// A frame is a sequence of passes: whole emitters and slices of the big
+// pools (comets, bullets, particles). Passes run on the job system, each
+// into its own segment list (kept per building thread, so the storage is
+// reused frame to frame), and the segments are appended in pass order.
+// The merged list - and so every batch and upload the backends make from
+// it - is identical to a serial build whatever the number of workers.
+
+#define DRAWLIST_MAX_PASSES 48
+#define DRAWLIST_SLICE 128              // Entities per pass, at least
+#define DRAWLIST_MAX_SLICES 8           // Bigger pools get bigger slices
+#define DRAWLIST_PARALLEL_MIN 96        // Fewer entities than this: build inline
+
+typedef void (*DrawListEmitFunc)(DrawList *list, const CometBusterGame *game);
+typedef void (*DrawListRangeFunc)(DrawList *list, const CometBusterGame *game, int begin, int end);
+
+typedef struct {
+    DrawListEmitFunc emit;              // Whole emitter, or
+    DrawListRangeFunc range;            // [begin, end) of a pool
+    int begin, end;
+} DrawListPass;
+
+typedef struct {
+    DrawListPass passes[DRAWLIST_MAX_PASSES];
+    int count;
+    int entities;                       // Rough work estimate
+    int width, height;
+    float particle_density;             // Read once, so every pass agrees
+} DrawListPlan;
+
+typedef struct {
+    const DrawListPlan *plan;
+    const CometBusterGame *game;
+    DrawList *segments;
+} DrawListBuildContext;
+
+static void drawlist_plan_emit(DrawListPlan *plan, DrawListEmitFunc emit) {
+    if (plan->count >= DRAWLIST_MAX_PASSES) return;
+    DrawListPass *pass = &plan->passes[plan->count++];
+    memset(pass, 0, sizeof(*pass));
+    pass->emit = emit;
+}
+
+static void drawlist_plan_range(DrawListPlan *plan, DrawListRangeFunc range, int count) {
+    int slice = (count + DRAWLIST_MAX_SLICES - 1) / DRAWLIST_MAX_SLICES;
+    if (slice < DRAWLIST_SLICE) slice = DRAWLIST_SLICE;
+
+    for (int begin = 0; begin < count && plan->count < DRAWLIST_MAX_PASSES; begin += slice) {
+        DrawListPass *pass = &plan->passes[plan->count++];
+        memset(pass, 0, sizeof(*pass));
+        pass->range = range;
+        pass->begin = begin;
+        pass->end = begin + slice < count ? begin + slice : count;
+    }
+    plan->entities += count;
+}
+
+static void drawlist_run_passes(void *data, int begin, int end) {
+    DrawListBuildContext *ctx = (DrawListBuildContext *)data;
+    for (int i = begin; i < end; i++) {
+        const DrawListPass *pass = &ctx->plan->passes[i];
+        DrawList *segment = &ctx->segments[i];
+        drawlist_clear(segment, ctx->plan->width, ctx->plan->height);
+        segment->particle_density = ctx->plan->particle_density;
+        if (pass->emit) {
+            pass->emit(segment, ctx->game);
+        } else {
+            pass->range(segment, ctx->game, pass->begin, pass->end);
+        }
+    }
+}
+
+// Append 'segment', moving its point and text references past what
+// 'list' already holds
+static void drawlist_append(DrawList *list, const DrawList *segment) {
+    int point_base = (int)list->points.size();
+    int text_base = (int)list->text.size();
+    size_t first_cmd = list->cmds.size();
+
+    list->cmds.insert(list->cmds.end(), segment->cmds.begin(), segment->cmds.end());
+    list->points.insert(list->points.end(), segment->points.begin(), segment->points.end());
+    list->text.insert(list->text.end(), segment->text.begin(), segment->text.end());
+
+    for (size_t i = first_cmd; i < list->cmds.size(); i++) {
+        DrawCmd *cmd = &list->cmds[i];
+        if (cmd->type == DL_PATH) {
+            cmd->first += point_base;
+        } else if (cmd->type == DL_TEXT) {
+            cmd->first += text_base;
+        }
+    }
+}
+
+static void drawlist_run(DrawList *list, const DrawListPlan *plan, const CometBusterGame *game) {
+    static thread_local DrawList segments[DRAWLIST_MAX_PASSES];
+
+    DrawListBuildContext ctx = { plan, game, segments };
+    // A pass per job; small frames stay on this thread
+    int min_batch = plan->entities >= DRAWLIST_PARALLEL_MIN ? 1 : plan->count;
+    job_parallel_for(plan->count, min_batch, drawlist_run_passes, &ctx);
+    list->particle_density = plan->particle_density;
+
+    for (int i = 0; i < plan->count; i++) {
+        drawlist_append(list, &segments[i]);
+    }
+}
+
+// The spawns DL_DEBRIS needs: everything since this list was last built,
+// up to a whole ring
+static void drawlist_copy_spawns(DrawList *list, const CometBusterGame *game) {
+    list->spawns.clear();
+    if (!comet_buster_gpu_particles_enabled()) return;
+
+    if (game->particle_epoch != list->particle_epoch) {
+        // The ring restarted at 0 (comet_buster_clear_particles)
+        list->particle_epoch = game->particle_epoch;
+        list->spawn_seq = 0;
+    }
+
+    unsigned int seq = game->particle_spawn_seq;
+    unsigned int first = list->spawn_seq;
+    if (seq - first > MAX_PARTICLE_SPAWNS) first = seq - MAX_PARTICLE_SPAWNS;
+    for (unsigned int s = first; s != seq; s++) {
+        list->spawns.push_back(game->particle_spawns[s % MAX_PARTICLE_SPAWNS]);
+    }
+    list->spawn_seq = seq;
+    list->particle_clock = game->particle_clock;
+}
+
+static void drawlist_plan_init(DrawListPlan *plan, int width, int height) {
+    plan->count = 0;
+    plan->entities = 0;
+    plan->width = width;
+    plan->height = height;
+    plan->particle_density = quality_current()->particle_density;
+}
+
+static void drawlist_emit_background(DrawList *list, const CometBusterGame *game) {
+    (void)game;
+    drawlist_background(list);
+}
+
+void drawlist_build_game(DrawList *list, const CometBusterGame *game, int width, int height) {
+    drawlist_clear(list, width, height);
+    if (!game) return;
+
+    DrawListPlan plan;
+    drawlist_plan_init(&plan, width, height);
+    plan.entities = game->enemy_ship_count + game->ufo_count + game->missile_count;
+
+    drawlist_plan_emit(&plan, drawlist_emit_background);
+
+    drawlist_plan_range(&plan, drawlist_emit_comets, game->comet_count);
+    drawlist_plan_range(&plan, drawlist_emit_bullets, game->bullet_count);
+    drawlist_plan_emit(&plan, drawlist_emit_enemy_ships);
+    drawlist_plan_emit(&plan, drawlist_emit_ufos);
+    drawlist_plan_emit(&plan, drawlist_emit_boss);
+
+    drawlist_plan_range(&plan, drawlist_emit_enemy_bullets, game->enemy_bullet_count);
+    drawlist_plan_range(&plan, drawlist_emit_boss_bullets, game->boss_bullets.count);
+    drawlist_plan_emit(&plan, drawlist_emit_pickups);
+    drawlist_plan_emit(&plan, drawlist_emit_missiles);
+    drawlist_plan_emit(&plan, drawlist_emit_bombs);
+    drawlist_plan_emit(&plan, drawlist_emit_debris);
+    drawlist_plan_range(&plan, drawlist_emit_particles, game->particle_count);
+    drawlist_plan_emit(&plan, drawlist_emit_ship);
+
+    drawlist_plan_emit(&plan, drawlist_emit_boss_explosion);
+    drawlist_plan_emit(&plan, drawlist_emit_hud);
+    drawlist_plan_emit(&plan, drawlist_emit_game_over);
+
+    drawlist_run(list, &plan, game);
+    drawlist_copy_spawns(list, game);
+}
+
+void drawlist_build_splash(DrawList *list, const CometBusterGame *game, int width, int height) {
+    drawlist_clear(list, width, height);
+    if (!game) return;
+
+    DrawListPlan plan;
+    drawlist_plan_init(&plan, width, height);
+    plan.entities = game->enemy_ship_count;
+
+    drawlist_plan_emit(&plan, drawlist_emit_background);
+    drawlist_plan_range(&plan, drawlist_emit_comets, game->comet_count);
+    drawlist_plan_emit(&plan, drawlist_emit_enemy_ships);
+    drawlist_plan_range(&plan, drawlist_emit_enemy_bullets, game->enemy_bullet_count);
+    drawlist_plan_emit(&plan, drawlist_emit_debris);
+    drawlist_plan_range(&plan, drawlist_emit_particles, game->particle_count);
+    drawlist_plan_emit(&plan, drawlist_emit_splash_boss);
+
+    drawlist_run(list, &plan, game);
+    drawlist_copy_spawns(list, game);
+}
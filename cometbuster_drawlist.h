@@ -0,0 +1,175 @@
+#ifndef COMETBUSTER_DRAWLIST_H
+#define COMETBUSTER_DRAWLIST_H
+
+#include <vector>
+#include "cometbuster.h"
+
+// ============================================================
+// RETAINED DRAW LIST
+// ============================================================
+// One frame of the game described as a flat list of drawing commands
+// (lines, filled/stroked paths, circles, rects, sprites, text, baked
+// shapes with a transform, comet outlines). drawlist_build_game() walks
+// the game state once and fills it; the GL and Cairo renderers replay
+// it (drawlist_replay_gl, drawlist_replay_cairo), and the Qt front-end
+// draws through the Cairo one.
+//
+// A list can be replayed any number of times - both eyes of the
+// OpenXR view, or a preview and a recording - without walking the
+// game again, and replaying never looks at the game: everything a
+// backend draws is in the list. Building only reads the game and
+// writes the list, with no GL or Cairo calls, so it can run on any
+// thread that owns a stable copy of the state (a sim-thread snapshot).
+// Busy frames are built on the job system, a segment per pass, and
+// merged in pass order - the result does not depend on the thread
+// count.
+//
+// Coordinates are game units (the same space the renderers draw in).
+// Colours are straight RGBA8, like PackedColor in the GL renderer.
+// ============================================================
+
+typedef struct {
+    unsigned char r, g, b, a;
+} DrawColor;
+
+typedef struct {
+    float x, y;
+    DrawColor color;        // Used with DL_POINT_COLORS
+} DrawPoint;
+
+typedef enum {
+    DL_LINE = 0,            // (x, y) - (a, b), stroked at 'width'
+    DL_PATH,                // 'count' points from 'first'; DL_FILL fills a convex polygon
+    DL_CIRCLE,              // Centre (x, y), radius 'size'; DL_FILL or stroked at 'width'
+    DL_RECT,                // Corner (x, y), size (a, b); DL_FILL or stroked at 'width'
+    DL_SPRITE,              // DrawSpriteKind 'id' at (x, y), radius 'size', trail vector (a, b)
+    DL_TEXT,                // NUL-terminated text at 'first' in the text pool, baseline at
+                            // (x, y), font size 'id'; left-aligned unless DL_TEXT_CENTER
+    DL_SHAPE,               // DrawShapeId 'id' at (x, y), rotated by 'a', scaled by 'b',
+                            // colours multiplied by 'color'
+    DL_COMET,               // Outline of size class 'id' and shape seed 'first' ('count'
+                            // points), radius 'size', centre (x, y), tumbled by 'b' then
+                            // spun by 'a', stroked at 'width'
+    DL_BACKGROUND,          // Backdrop and grid over the list's width x height
+    DL_DEBRIS               // GPU explosion debris from the list's spawn window
+} DrawCmdType;
+
+// Command flags
+#define DL_FILL         0x01
+#define DL_CLOSED       0x02    // Stroked path: join the last point to the first
+#define DL_POINT_COLORS 0x04    // Path: colour per point instead of 'color'
+#define DL_TEXT_CENTER  0x08    // Text: centred on x
+
+typedef enum {
+    DL_SPRITE_DISC = 0,
+    DL_SPRITE_DIAMOND,      // With a faint trail behind it along -(a, b)
+    DL_SPRITE_GLOW          // Soft halo fading out to 'size'
+} DrawSpriteKind;
+
+// Fixed vector art, drawn in local coordinates (origin at the centre,
+// facing +x). The GL renderer draws these from its baked meshes, Cairo
+// strokes them directly.
+typedef enum {
+    DL_SHAPE_PLAYER_SHIP = 0,
+    DL_SHAPE_ENEMY_SHIP,                        // + ship_type (0-5)
+    DL_SHAPE_UFO = DL_SHAPE_ENEMY_SHIP + 6,     // White - tint with the hull colour
+    DL_SHAPE_CANISTER,
+    DL_SHAPE_MISSILE_PICKUP,
+    DL_SHAPE_BOMB_PICKUP,
+    DL_SHAPE_BOSS_BODY,                         // Death Star hull (its damage flash goes between)
+    DL_SHAPE_BOSS_DETAIL,                       // Death Star ring, spokes and core
+    DL_SHAPE_COUNT
+} DrawShapeId;
+
+typedef struct {
+    unsigned char type;     // DrawCmdType
+    unsigned char flags;    // DL_FILL, DL_CLOSED, DL_POINT_COLORS
+    unsigned short id;      // Sprite kind, shape, comet size class or font size
+    DrawColor color;
+    float x, y;
+    float a, b;             // Second point, size, trail or angle/scale - see DrawCmdType
+    float size;
+    float width;            // Stroke width
+    int first;              // First point (DL_PATH), text byte (DL_TEXT) or shape seed (DL_COMET)
+    int count;
+} DrawCmd;
+
+typedef struct DrawList {
+    std::vector<DrawCmd> cmds;
+    std::vector<DrawPoint> points;
+    std::vector<char> text;
+    int width;              // Play area the list was built for
+    int height;
+
+    // GPU debris for DL_DEBRIS: the spawns since this list was last
+    // built, ending at particle_spawn_seq 'spawn_seq'. drawlist_clear()
+    // keeps the cursor.
+    std::vector<ParticleSpawn> spawns;
+    unsigned int spawn_seq;
+    unsigned int particle_epoch;
+    double particle_clock;
+
+    float particle_density; // Share of the debris to draw (quality governor)
+} DrawList;
+
+static inline unsigned char dl_unit_to_byte(float v) {
+    if (v <= 0.0f) return 0;
+    if (v >= 1.0f) return 255;
+    return (unsigned char)(v * 255.0f + 0.5f);
+}
+
+static inline DrawColor dl_color(float r, float g, float b, float a) {
+    DrawColor c = {dl_unit_to_byte(r), dl_unit_to_byte(g), dl_unit_to_byte(b), dl_unit_to_byte(a)};
+    return c;
+}
+
+// The quality governor thins explosion debris when it is drawn, not when
+// it is spawned, so the simulation is the same at every level. True for
+// about 'density' of all keys, spread evenly over consecutive ones (a
+// burst's particles, spawn by spawn). A particle's key must stay the
+// same over its life or it would flicker.
+static inline bool drawlist_keep_particle(unsigned int key, float density) {
+    if (density >= 1.0f) return true;
+    return ((key * 2654435769u) >> 8) < (unsigned int)(density * 16777216.0f);
+}
+
+// Empty the list, keeping its storage
+void drawlist_clear(DrawList *list, int width, int height);
+
+// Emitters
+void drawlist_line(DrawList *list, float x1, float y1, float x2, float y2, float width, DrawColor color);
+void drawlist_path(DrawList *list, const DrawPoint *points, int count, int flags, float width, DrawColor color);
+void drawlist_circle(DrawList *list, float cx, float cy, float radius, int flags, float width, DrawColor color);
+void drawlist_rect(DrawList *list, float x, float y, float w, float h, int flags, float width, DrawColor color);
+void drawlist_sprite(DrawList *list, DrawSpriteKind kind, float x, float y, float size,
+                     float trail_x, float trail_y, DrawColor color);
+void drawlist_text(DrawList *list, const char *text, float x, float y, int font_size, int flags, DrawColor color);
+void drawlist_shape(DrawList *list, DrawShapeId shape, float x, float y, float angle, float scale, DrawColor tint);
+void drawlist_comet(DrawList *list, const Comet *comet);
+void drawlist_background(DrawList *list);
+void drawlist_debris(DrawList *list);
+
+// Art shared by the list and the renderers' baked copies of it (the GL
+// meshes and comet shape texture)
+#define DRAWLIST_COMET_MAX_POINTS 16
+
+double drawlist_enemy_ship_size(int ship_type);
+int drawlist_comet_seed(const Comet *comet);
+int drawlist_comet_points(int size, int shape_seed);     // 0 for sizes that are not drawn
+float drawlist_comet_width(int size);
+void drawlist_comet_outline(double points[][2], int num_points, double radius, int shape_seed);
+
+// The whole game screen, in the order draw_comet_buster_gl drew it
+// (splash screens are not included)
+void drawlist_build_game(DrawList *list, const CometBusterGame *game, int width, int height);
+
+// The moving backdrop behind the opening crawl
+void drawlist_build_splash(DrawList *list, const CometBusterGame *game, int width, int height);
+
+// Backends - see cometbuster_render_gl.cpp and cometbuster_render.cpp
+void drawlist_replay_gl(const DrawList *list);
+#ifdef CAIROBUILD
+void drawlist_replay_cairo(cairo_t *cr, const DrawList *list);
+#endif
+
+#endif // COMETBUSTER_DRAWLIST_H
@@ -0,0 +1,113 @@
+#include <stdlib.h>
+#include <math.h>
+#ifdef ANDROID
+#include <SDL.h>
+#else
+#include <SDL2/SDL.h>
+#endif
+#include "cometbuster_fastmath.h"
+#include "cometbuster_simd.h"
+
+// ============================================================================
+// BATCHES
+// ============================================================================
+// The vector code lives with the other ISA-specific kernels in
+// cometbuster_simd.cpp and is picked at runtime by simd_init().
+
+void fm_sincos_batch(const float *angles, float *s, float *c, int n) {
+    simd_kernels.sincos_batch(angles, s, c, n);
+}
+
+void fm_circle_points(float cx, float cy, float radius, int segments, float *xy) {
+    simd_kernels.circle_points(cx, cy, radius, segments, xy);
+}
+
+// ============================================================================
+// SELF CHECK
+// ============================================================================
+
+#define FM_CHECK_SAMPLES 4096
+#define FM_CHECK_ROUNDS 64
+
+bool fm_self_check(void) {
+    static float angles[FM_CHECK_SAMPLES];
+    static float out_s[FM_CHECK_SAMPLES];
+    static float out_c[FM_CHECK_SAMPLES];
+
+    // Angles across the range gameplay code passes in (a few turns either way)
+    for (int i = 0; i < FM_CHECK_SAMPLES; i++) {
+        angles[i] = (float)(-8.0 * FM_PI + 16.0 * FM_PI * i / (FM_CHECK_SAMPLES - 1));
+    }
+
+    double err_sincos = 0.0;
+    double err_batch = 0.0;
+    double err_atan2 = 0.0;
+
+    for (int i = 0; i < FM_CHECK_SAMPLES; i++) {
+        double a = angles[i];
+        double s, c;
+        fm_sincos(a, &s, &c);
+        err_sincos = fmax(err_sincos, fmax(fabs(s - sin(a)), fabs(c - cos(a))));
+    }
+
+    fm_sincos_batch(angles, out_s, out_c, FM_CHECK_SAMPLES);
+    for (int i = 0; i < FM_CHECK_SAMPLES; i++) {
+        double a = angles[i];
+        err_batch = fmax(err_batch, fmax(fabs(out_s[i] - sin(a)), fabs(out_c[i] - cos(a))));
+    }
+
+    for (int i = 0; i < FM_CHECK_SAMPLES; i++) {
+        double a = 2.0 * FM_PI * i / FM_CHECK_SAMPLES;
+        double r = 1.0 + (i % 7) * 250.0;
+        double y = sin(a) * r;
+        double x = cos(a) * r;
+        err_atan2 = fmax(err_atan2, fabs(fm_atan2(y, x) - atan2(y, x)));
+    }
+
+    // Throughput: same work through libm and through the fast paths.
+    // The sums keep the compiler from dropping the loops.
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    volatile double sink = 0.0;
+
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    for (int round = 0; round < FM_CHECK_ROUNDS; round++) {
+        for (int i = 0; i < FM_CHECK_SAMPLES; i++) {
+            out_s[i] = sinf(angles[i]);
+            out_c[i] = cosf(angles[i]);
+        }
+        sink += out_s[round] + out_c[round];
+    }
+    Uint64 t1 = SDL_GetPerformanceCounter();
+    for (int round = 0; round < FM_CHECK_ROUNDS; round++) {
+        fm_sincos_batch(angles, out_s, out_c, FM_CHECK_SAMPLES);
+        sink += out_s[round] + out_c[round];
+    }
+    Uint64 t2 = SDL_GetPerformanceCounter();
+    for (int round = 0; round < FM_CHECK_ROUNDS; round++) {
+        for (int i = 0; i < FM_CHECK_SAMPLES; i++) {
+            sink += atan2(angles[i], 1.5);
+        }
+    }
+    Uint64 t3 = SDL_GetPerformanceCounter();
+    for (int round = 0; round < FM_CHECK_ROUNDS; round++) {
+        for (int i = 0; i < FM_CHECK_SAMPLES; i++) {
+            sink += fm_atan2(angles[i], 1.5);
+        }
+    }
+    Uint64 t4 = SDL_GetPerformanceCounter();
+    (void)sink;
+
+    double calls = (double)FM_CHECK_SAMPLES * FM_CHECK_ROUNDS;
+    double ns = 1e9 / (double)freq / calls;
+
+    SDL_Log("[Comet Busters] [FASTMATH] max error: sincos %.2e, batch %.2e, atan2 %.2e\n",
+            err_sincos, err_batch, err_atan2);
+    SDL_Log("[Comet Busters] [FASTMATH] ns/call: libm sincos %.2f vs batch %.2f, libm atan2 %.2f vs %.2f\n",
+            (t1 - t0) * ns, (t2 - t1) * ns, (t3 - t2) * ns, (t4 - t3) * ns);
+
+    if (err_sincos > 1e-8 || err_batch > 2e-7 || err_atan2 > 2e-6) {
+        SDL_Log("[Comet Busters] [FASTMATH] FAIL: error above documented bound\n");
+        return false;
+    }
+    return true;
+}
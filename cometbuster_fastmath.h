@@ -0,0 +1,121 @@
+#ifndef COMETBUSTER_FASTMATH_H
+#define COMETBUSTER_FASTMATH_H
+
+#include <math.h>
+#include <stdbool.h>
+
+// ============================================================
+// FAST MATH FOR HOT LOOPS
+// ============================================================
+// Approximations for the trig calls in collision, targeting,
+// particle spawning and circle/asteroid vertex generation.
+// Error bounds (absolute, measured against libm over the ranges
+// the game uses - see fm_self_check()):
+//
+//   fm_sincos                     < 1e-8   (|angle| < 1e5 rad)
+//   fm_sincos_batch (float)       < 2e-7   (|angle| < 8*pi)
+//   fm_circle_points (float)      < 1e-6 * radius
+//   fm_atan2                      < 2e-6 rad
+//
+// That is far below a pixel on a 1920x1080 field. Don't use these
+// for anything that accumulates over long periods (orbits, timers).
+//
+// sqrt itself is a single hardware instruction, so there is no
+// approximation for it - instead compare squared distances with
+// fm_dist_sq()/fm_within() and only take the root when the actual
+// distance is needed.
+//
+// The batch functions go through the runtime-selected SIMD kernels
+// (cometbuster_simd.h): SSE2/AVX2 on x86-64, NEON on arm64.
+// ============================================================
+
+#define FM_PI       3.14159265358979323846
+#define FM_HALF_PI  1.57079632679489661923
+
+// ---------- Squared-distance helpers ----------
+
+static inline double fm_dist_sq(double dx, double dy) {
+    return dx * dx + dy * dy;
+}
+
+// Same result as sqrt(dx*dx + dy*dy) < radius for radius >= 0
+static inline bool fm_within(double dx, double dy, double radius) {
+    return dx * dx + dy * dy < radius * radius;
+}
+
+// ---------- sin/cos ----------
+
+// Polynomials on [-pi/4, pi/4] (Cephes sinf/cosf coefficients)
+static inline double fm_sin_poly(double r, double r2) {
+    return r + r * r2 * (-1.6666654611e-1 + r2 * (8.3321608736e-3 + r2 * -1.9515295891e-4));
+}
+
+static inline double fm_cos_poly(double r2) {
+    return 1.0 - 0.5 * r2 + r2 * r2 * (4.166664568298827e-2 + r2 * (-1.388731625493765e-3 + r2 * 2.443315711809948e-5));
+}
+
+static inline void fm_sincos(double angle, double *s, double *c) {
+    // Reduce to [-pi/4, pi/4] around the nearest multiple of pi/2
+    double scaled = angle * (2.0 / FM_PI);
+    long long quadrant = (long long)(scaled + (scaled >= 0 ? 0.5 : -0.5));
+    double k = (double)quadrant;
+    double r = (angle - k * 1.5707963267341256) - k * 6.077100506506192e-11;
+    double r2 = r * r;
+    double sr = fm_sin_poly(r, r2);
+    double cr = fm_cos_poly(r2);
+
+    int q = (int)(quadrant & 3);
+    switch (q) {
+        case 0: *s = sr;  *c = cr;  break;
+        case 1: *s = cr;  *c = -sr; break;
+        case 2: *s = -sr; *c = -cr; break;
+        default: *s = -cr; *c = sr; break;
+    }
+}
+
+static inline double fm_sin(double angle) {
+    double s, c;
+    fm_sincos(angle, &s, &c);
+    return s;
+}
+
+static inline double fm_cos(double angle) {
+    double s, c;
+    fm_sincos(angle, &s, &c);
+    return c;
+}
+
+// ---------- atan2 ----------
+
+static inline double fm_atan2(double y, double x) {
+    double ax = fabs(x);
+    double ay = fabs(y);
+    double hi = ax > ay ? ax : ay;
+    if (hi == 0.0) return 0.0;
+
+    double lo = ax > ay ? ay : ax;
+    double a = lo / hi;
+    double s = a * a;
+    double r = a * (0.99997726 + s * (-0.33262347 + s * (0.19354346 +
+               s * (-0.11643287 + s * (0.05265332 + s * -0.01172120)))));
+
+    if (ay > ax) r = FM_HALF_PI - r;
+    if (x < 0) r = FM_PI - r;
+    return y < 0 ? -r : r;
+}
+
+// ---------- Batches ----------
+
+// s[i], c[i] = sin/cos(angles[i]) for n angles
+void fm_sincos_batch(const float *angles, float *s, float *c, int n);
+
+// segments + 1 points around a circle, starting at angle 0 and ending back
+// on it (GL fans/strips close on the last point). xy holds x,y pairs.
+void fm_circle_points(float cx, float cy, float radius, int segments, float *xy);
+
+// Log accuracy and speed against libm. False if an error is above the
+// bounds documented above. Debug builds run it once at startup and
+// --math-test runs it (with simd_self_check) and exits.
+bool fm_self_check(void);
+
+#endif // COMETBUSTER_FASTMATH_H
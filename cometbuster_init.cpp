@@ -4,6 +4,7 @@
 #include <string.h>
 #include <time.h>
 #include "cometbuster.h"
+#include "cometbuster_simd.h"
 #include "visualization.h"
 #include "comet_lang.h"
 
@@ -150,7 +151,7 @@ void comet_buster_reset_game_with_splash(CometBusterGame *game, bool show_splash
     // IMPORTANT: Do this BEFORE splash screen spawning so we have a clean slate
     game->comet_count = 0;
     game->bullet_count = 0;
-    game->particle_count = 0;
+    comet_buster_clear_particles(game);
     game->floating_text_count = 0;
     game->canister_count = 0;
     game->missile_count = 0;
@@ -158,6 +159,9 @@ void comet_buster_reset_game_with_splash(CometBusterGame *game, bool show_splash
     // NOTE: high_score_count is NOT reset - high scores persist from disk load
     game->enemy_ship_count = 0;
     game->enemy_bullet_count = 0;
+    boss_bullet_pool_clear(&game->boss_bullets);
+    bullet_pattern_init_tables();  // Direction table for boss pattern fire
+    simd_init();                   // Pick vector kernels for this CPU
     game->ufo_count = 0;
     game->ufo_spawn_timer = 15.0;  // First UFO after 15 seconds
     game->ufo_spawn_rate = 25.0;   // Spawn a UFO every 25 seconds on average
@@ -0,0 +1,397 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "cometbuster_jobs.h"
+
+// ============================================================================
+// WORK-STEALING JOB SYSTEM
+// ============================================================================
+
+typedef struct {
+    JobFunc func;
+    JobRangeFunc range_func;
+    void *data;
+    int begin, end;             // Range for range_func
+    SDL_atomic_t *counter;      // Decremented when the job finishes (parallel-for)
+    JobGraph *graph;            // Owning graph for node jobs (NULL otherwise)
+    int node;
+} Job;
+
+// Deques 0..JOB_MAX_SUBMITTERS-1 belong to the threads outside the pool that
+// submit work (main, simulation, render), one each, claimed on first use.
+// The worker threads own the deques after them. Owner pushes/pops at the
+// bottom, thieves take from the top. A spinlock per deque keeps it simple -
+// contention is a handful of jobs per frame.
+typedef struct {
+    Job jobs[JOB_QUEUE_SIZE];
+    int top;
+    int bottom;
+    SDL_SpinLock lock;
+} JobDeque;
+
+#define JOB_MAX_SUBMITTERS 4
+#define JOB_NO_DEQUE -1             // Submitter that found every slot taken
+
+// job_state: not started, being started by one thread, ready
+#define JOB_STATE_OFF 0
+#define JOB_STATE_STARTING 1
+#define JOB_STATE_READY 2
+
+static JobDeque job_deques[JOB_MAX_SUBMITTERS + MAX_JOB_WORKERS];
+static SDL_Thread *job_threads[MAX_JOB_WORKERS];
+static int job_worker_total = 0;
+static SDL_atomic_t job_state;
+static SDL_atomic_t job_running;
+static SDL_atomic_t job_sleepers;
+static SDL_atomic_t job_submitters;          // Submitter deques handed out so far
+static SDL_sem *job_wake_sem = NULL;
+
+// Deque index of this thread, claimed lazily by submitters
+static thread_local int job_thread_index = JOB_NO_DEQUE;
+static thread_local bool job_thread_claimed = false;
+
+static bool job_ready(void) {
+    return SDL_AtomicGet(&job_state) == JOB_STATE_READY;
+}
+
+static int job_deque_total(void) {
+    return JOB_MAX_SUBMITTERS + job_worker_total;
+}
+
+// Give a submitting thread its own deque the first time it submits. Slots
+// are never returned: the threads that submit live as long as the game.
+static int job_self(void) {
+    if (!job_thread_claimed) {
+        int slot = SDL_AtomicAdd(&job_submitters, 1);
+        job_thread_index = slot < JOB_MAX_SUBMITTERS ? slot : JOB_NO_DEQUE;
+        job_thread_claimed = true;
+        if (job_thread_index == JOB_NO_DEQUE) {
+            SDL_Log("[Comet Busters] [JOBS] WARNING: More than %d submitting threads, extra ones run their jobs inline\n",
+                    JOB_MAX_SUBMITTERS);
+        }
+    }
+    return job_thread_index;
+}
+
+static bool job_push(int index, const Job *job) {
+    JobDeque *dq = &job_deques[index];
+    bool pushed = false;
+
+    SDL_AtomicLock(&dq->lock);
+    if (dq->bottom - dq->top < JOB_QUEUE_SIZE) {
+        dq->jobs[dq->bottom & (JOB_QUEUE_SIZE - 1)] = *job;
+        dq->bottom++;
+        pushed = true;
+    }
+    SDL_AtomicUnlock(&dq->lock);
+
+    // Wake a sleeping worker so it can steal the new job
+    if (pushed && job_wake_sem && SDL_AtomicGet(&job_sleepers) > 0) {
+        SDL_SemPost(job_wake_sem);
+    }
+    return pushed;
+}
+
+static bool job_pop(int index, Job *out) {
+    JobDeque *dq = &job_deques[index];
+    bool found = false;
+
+    SDL_AtomicLock(&dq->lock);
+    if (dq->bottom > dq->top) {
+        dq->bottom--;
+        *out = dq->jobs[dq->bottom & (JOB_QUEUE_SIZE - 1)];
+        found = true;
+    }
+    if (dq->bottom == dq->top) {
+        dq->bottom = dq->top = 0;  // Keep indices small
+    }
+    SDL_AtomicUnlock(&dq->lock);
+    return found;
+}
+
+static bool job_steal(int index, Job *out) {
+    JobDeque *dq = &job_deques[index];
+    bool found = false;
+
+    SDL_AtomicLock(&dq->lock);
+    if (dq->bottom > dq->top) {
+        *out = dq->jobs[dq->top & (JOB_QUEUE_SIZE - 1)];
+        dq->top++;
+        found = true;
+    }
+    if (dq->bottom == dq->top) {
+        dq->bottom = dq->top = 0;
+    }
+    SDL_AtomicUnlock(&dq->lock);
+    return found;
+}
+
+// Own deque first, then try to steal from everybody else
+static bool job_take(int self, Job *out) {
+    if (self != JOB_NO_DEQUE && job_pop(self, out)) return true;
+
+    int total = job_deque_total();
+    int start = self != JOB_NO_DEQUE ? self : 0;
+    for (int i = 0; i < total; i++) {
+        int victim = (start + i) % total;
+        if (victim == self) continue;
+        if (job_steal(victim, out)) return true;
+    }
+    return false;
+}
+
+static void job_graph_node_finished(JobGraph *graph, int node);
+
+static void job_execute(Job *job) {
+    if (job->range_func) {
+        job->range_func(job->data, job->begin, job->end);
+    } else if (job->func) {
+        job->func(job->data);
+    }
+
+    if (job->graph) {
+        job_graph_node_finished(job->graph, job->node);
+    }
+    if (job->counter) {
+        SDL_AtomicAdd(job->counter, -1);
+    }
+}
+
+// Push a job, or run it right here if our deque is full
+static void job_submit(const Job *job) {
+    int self = job_self();
+    if (self == JOB_NO_DEQUE || !job_push(self, job)) {
+        Job inline_job = *job;
+        job_execute(&inline_job);
+    }
+}
+
+// Help with queued work until the counter reaches zero
+static void job_wait(SDL_atomic_t *counter) {
+    int idle_spins = 0;
+    while (SDL_AtomicGet(counter) > 0) {
+        Job job;
+        if (job_take(job_self(), &job)) {
+            job_execute(&job);
+            idle_spins = 0;
+        } else if (++idle_spins > 64) {
+            SDL_Delay(0);  // Yield - remaining jobs are running on other cores
+        }
+    }
+}
+
+static int job_worker_main(void *arg) {
+    job_thread_index = (int)(intptr_t)arg;
+    job_thread_claimed = true;
+
+    while (SDL_AtomicGet(&job_running)) {
+        Job job;
+        if (job_take(job_thread_index, &job)) {
+            job_execute(&job);
+            continue;
+        }
+
+        // Announce we are going to sleep, then look once more so a push
+        // that raced with the announcement is not left waiting
+        SDL_AtomicIncRef(&job_sleepers);
+        if (job_take(job_thread_index, &job)) {
+            SDL_AtomicDecRef(&job_sleepers);
+            job_execute(&job);
+            continue;
+        }
+        SDL_SemWait(job_wake_sem);
+        SDL_AtomicDecRef(&job_sleepers);
+    }
+    return 0;
+}
+
+// The first caller starts the pool; anyone racing it waits until it is ready
+void job_system_init(int num_workers) {
+    if (!SDL_AtomicCAS(&job_state, JOB_STATE_OFF, JOB_STATE_STARTING)) {
+        while (SDL_AtomicGet(&job_state) != JOB_STATE_READY) SDL_Delay(0);
+        return;
+    }
+
+    if (num_workers == 0) {
+        num_workers = SDL_GetCPUCount() - 1;
+    }
+    if (num_workers < 0) num_workers = 0;
+    if (num_workers > MAX_JOB_WORKERS) num_workers = MAX_JOB_WORKERS;
+
+    memset(job_deques, 0, sizeof(job_deques));
+    SDL_AtomicSet(&job_running, 1);
+    SDL_AtomicSet(&job_sleepers, 0);
+    job_worker_total = 0;
+
+    if (num_workers > 0) {
+        job_wake_sem = SDL_CreateSemaphore(0);
+        if (!job_wake_sem) {
+            SDL_Log("[Comet Busters] [JOBS] WARNING: Could not create semaphore, running single-threaded\n");
+            num_workers = 0;
+        }
+    }
+
+    for (int i = 0; i < num_workers; i++) {
+        job_threads[i] = SDL_CreateThread(job_worker_main, "CometJobWorker",
+                                          (void *)(intptr_t)(JOB_MAX_SUBMITTERS + i));
+        if (!job_threads[i]) {
+            SDL_Log("[Comet Busters] [JOBS] WARNING: Failed to create worker %d: %s\n", i + 1, SDL_GetError());
+            break;
+        }
+        job_worker_total++;
+    }
+
+    SDL_Log("[Comet Busters] [JOBS] Job system started with %d worker thread(s)\n", job_worker_total);
+    SDL_AtomicSet(&job_state, JOB_STATE_READY);
+}
+
+void job_system_shutdown(void) {
+    if (!SDL_AtomicCAS(&job_state, JOB_STATE_READY, JOB_STATE_STARTING)) return;
+
+    SDL_AtomicSet(&job_running, 0);
+    for (int i = 0; i < job_worker_total; i++) {
+        SDL_SemPost(job_wake_sem);
+    }
+    for (int i = 0; i < job_worker_total; i++) {
+        SDL_WaitThread(job_threads[i], NULL);
+        job_threads[i] = NULL;
+    }
+    if (job_wake_sem) {
+        SDL_DestroySemaphore(job_wake_sem);
+        job_wake_sem = NULL;
+    }
+
+    job_worker_total = 0;
+    SDL_AtomicSet(&job_state, JOB_STATE_OFF);
+}
+
+int job_system_worker_count(void) {
+    if (!job_ready()) job_system_init(0);
+    return job_worker_total;
+}
+
+void job_parallel_for(int count, int min_batch, JobRangeFunc fn, void *data) {
+    if (count <= 0 || !fn) return;
+    if (!job_ready()) job_system_init(0);
+    if (min_batch < 1) min_batch = 1;
+
+    int ways = job_worker_total + 1;
+    if (ways <= 1 || count <= min_batch) {
+        fn(data, 0, count);
+        return;
+    }
+
+    int batch = (count + ways - 1) / ways;
+    if (batch < min_batch) batch = min_batch;
+
+    SDL_atomic_t pending;
+    SDL_AtomicSet(&pending, 0);
+
+    // Queue every range except the first, which this thread runs itself
+    for (int begin = batch; begin < count; begin += batch) {
+        Job job;
+        memset(&job, 0, sizeof(job));
+        job.range_func = fn;
+        job.data = data;
+        job.begin = begin;
+        job.end = (begin + batch < count) ? begin + batch : count;
+        job.counter = &pending;
+
+        SDL_AtomicIncRef(&pending);
+        job_submit(&job);
+    }
+
+    fn(data, 0, batch);
+    job_wait(&pending);
+}
+
+// ============================================================================
+// DEPENDENCY GRAPH
+// ============================================================================
+
+void job_graph_init(JobGraph *graph) {
+    if (!graph) return;
+    memset(graph, 0, sizeof(JobGraph));
+}
+
+int job_graph_add(JobGraph *graph, const char *name, JobFunc func, void *data) {
+    if (!graph || graph->node_count >= MAX_JOB_GRAPH_NODES) {
+        SDL_Log("[Comet Busters] [JOBS] ERROR: Job graph full, cannot add '%s'\n", name ? name : "?");
+        return -1;
+    }
+
+    int id = graph->node_count++;
+    JobGraphNode *node = &graph->nodes[id];
+    memset(node, 0, sizeof(JobGraphNode));
+    node->func = func;
+    node->data = data;
+    node->name = name;
+    return id;
+}
+
+// Prerequisites must be added before the nodes that depend on them. That keeps
+// the graph acyclic and makes insertion order a valid serial schedule.
+void job_graph_depend(JobGraph *graph, int node, int prerequisite) {
+    if (!graph || node < 0 || prerequisite < 0) return;
+    if (node >= graph->node_count || prerequisite >= node) {
+        SDL_Log("[Comet Busters] [JOBS] ERROR: Invalid dependency %d -> %d\n", prerequisite, node);
+        return;
+    }
+
+    JobGraphNode *pre = &graph->nodes[prerequisite];
+    if (pre->dependent_count >= MAX_JOB_DEPENDENTS) {
+        SDL_Log("[Comet Busters] [JOBS] ERROR: Too many dependents on '%s'\n", pre->name ? pre->name : "?");
+        return;
+    }
+    pre->dependents[pre->dependent_count++] = node;
+    graph->nodes[node].dependency_count++;
+}
+
+static void job_graph_submit_node(JobGraph *graph, int node) {
+    Job job;
+    memset(&job, 0, sizeof(job));
+    job.func = graph->nodes[node].func;
+    job.data = graph->nodes[node].data;
+    job.graph = graph;
+    job.node = node;
+    job_submit(&job);
+}
+
+static void job_graph_node_finished(JobGraph *graph, int node) {
+    JobGraphNode *n = &graph->nodes[node];
+
+    for (int i = 0; i < n->dependent_count; i++) {
+        int dep = n->dependents[i];
+        if (SDL_AtomicAdd(&graph->nodes[dep].unresolved, -1) == 1) {
+            job_graph_submit_node(graph, dep);
+        }
+    }
+    SDL_AtomicAdd(&graph->remaining, -1);
+}
+
+void job_graph_run(JobGraph *graph) {
+    if (!graph || graph->node_count == 0) return;
+    if (!job_ready()) job_system_init(0);
+
+    // No workers: run in insertion order, which is always a valid schedule
+    if (job_worker_total == 0) {
+        for (int i = 0; i < graph->node_count; i++) {
+            if (graph->nodes[i].func) graph->nodes[i].func(graph->nodes[i].data);
+        }
+        return;
+    }
+
+    SDL_AtomicSet(&graph->remaining, graph->node_count);
+    for (int i = 0; i < graph->node_count; i++) {
+        SDL_AtomicSet(&graph->nodes[i].unresolved, graph->nodes[i].dependency_count);
+    }
+
+    for (int i = 0; i < graph->node_count; i++) {
+        if (graph->nodes[i].dependency_count == 0) {
+            job_graph_submit_node(graph, i);
+        }
+    }
+
+    job_wait(&graph->remaining);
+}
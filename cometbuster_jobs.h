@@ -0,0 +1,78 @@
+#ifndef COMETBUSTER_JOBS_H
+#define COMETBUSTER_JOBS_H
+
+#ifdef ANDROID
+#include <SDL.h>
+#else
+#include <SDL2/SDL.h>
+#endif
+
+#include <stdbool.h>
+
+// ============================================================
+// WORK-STEALING JOB SYSTEM
+// ============================================================
+// A small fixed-size thread pool used by the simulation update.
+// Every worker owns a deque: it pushes and pops work at the bottom,
+// idle workers steal from the top of another worker's deque.
+// The thread that waits on a job graph or parallel-for helps execute
+// queued jobs instead of blocking, so a pool with zero workers (single
+// core machines) simply runs everything inline in submission order.
+//
+// Determinism: jobs only ever touch disjoint data (a range of an
+// entity array, or an update stage whose inputs are already final),
+// so results are bit-identical to the serial update order.
+// ============================================================
+
+#define MAX_JOB_WORKERS 16
+#define JOB_QUEUE_SIZE 256          // Per-worker deque capacity (power of two)
+#define MAX_JOB_GRAPH_NODES 32
+#define MAX_JOB_DEPENDENTS 8
+#define JOB_WORKERS_NONE -1         // job_system_init: no worker threads
+
+typedef void (*JobFunc)(void *data);
+typedef void (*JobRangeFunc)(void *data, int begin, int end);
+
+// One node (stage) in a dependency graph
+typedef struct {
+    JobFunc func;
+    void *data;
+    const char *name;                       // For debug logging only
+    int dependents[MAX_JOB_DEPENDENTS];     // Nodes released when this one finishes
+    int dependent_count;
+    int dependency_count;                   // Static number of prerequisites
+    SDL_atomic_t unresolved;                // Prerequisites still running this frame
+} JobGraphNode;
+
+// Dependency graph over update stages (built once, run every frame)
+typedef struct {
+    JobGraphNode nodes[MAX_JOB_GRAPH_NODES];
+    int node_count;
+    SDL_atomic_t remaining;                 // Nodes not yet finished in the current run
+} JobGraph;
+
+// Start the worker threads. num_workers == 0 picks (CPU count - 1),
+// JOB_WORKERS_NONE runs every job on the submitting thread.
+// Called lazily by the first parallel call; safe to call more than once
+// and from several threads at the same time.
+void job_system_init(int num_workers);
+
+// Stop and join all worker threads
+void job_system_shutdown(void);
+
+// Number of background workers (0 = everything runs on the calling thread)
+int job_system_worker_count(void);
+
+// Run fn over [0, count) split into ranges of at least min_batch elements.
+// Blocks until every range is done; the calling thread takes part.
+void job_parallel_for(int count, int min_batch, JobRangeFunc fn, void *data);
+
+// Graph construction
+void job_graph_init(JobGraph *graph);
+int job_graph_add(JobGraph *graph, const char *name, JobFunc func, void *data);
+void job_graph_depend(JobGraph *graph, int node, int prerequisite);
+
+// Run every node once, respecting dependencies. Blocks until done.
+void job_graph_run(JobGraph *graph);
+
+#endif // COMETBUSTER_JOBS_H
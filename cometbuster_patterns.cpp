@@ -0,0 +1,163 @@
+#include <math.h>
+#include <string.h>
+#include "cometbuster_patterns.h"
+#include "cometbuster_simd.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// ============================================================================
+// DIRECTION TABLE
+// ============================================================================
+
+#define PATTERN_DIR_MASK (PATTERN_DIR_TABLE_SIZE - 1)
+
+static double pattern_dir_cos[PATTERN_DIR_TABLE_SIZE];
+static double pattern_dir_sin[PATTERN_DIR_TABLE_SIZE];
+static bool pattern_tables_ready = false;
+
+void bullet_pattern_init_tables(void) {
+    if (pattern_tables_ready) return;
+
+    for (int i = 0; i < PATTERN_DIR_TABLE_SIZE; i++) {
+        double angle = 2.0 * M_PI * i / PATTERN_DIR_TABLE_SIZE;
+        pattern_dir_cos[i] = cos(angle);
+        pattern_dir_sin[i] = sin(angle);
+    }
+    pattern_tables_ready = true;
+}
+
+// ============================================================================
+// EMISSION
+// ============================================================================
+
+bool boss_bullet_spawn(BossBulletPool *pool, double x, double y, double vx, double vy, int owner_ship_id) {
+    if (!pool || pool->count >= MAX_BOSS_BULLETS) return false;
+
+    int slot = pool->count++;
+    pool->x[slot] = x;
+    pool->y[slot] = y;
+    pool->vx[slot] = vx;
+    pool->vy[slot] = vy;
+    pool->lifetime[slot] = BOSS_BULLET_LIFETIME;
+    pool->owner_ship_id[slot] = owner_ship_id;
+    return true;
+}
+
+int bullet_pattern_emit(BossBulletPool *pool, const BulletPattern *pattern,
+                        double x, double y, double base_angle, int owner_ship_id) {
+    if (!pool || !pattern || pattern->count <= 0) return 0;
+    bullet_pattern_init_tables();
+
+    int count = pattern->count;
+    if (count > MAX_BOSS_BULLETS - pool->count) {
+        count = MAX_BOSS_BULLETS - pool->count;
+    }
+    if (count <= 0) return 0;
+
+    // Work out the first direction and the spacing in table units, then
+    // fill the pool arrays in one pass
+    double first = base_angle;
+    double step = 0.0;
+
+    switch (pattern->type) {
+        case PATTERN_RING:
+            step = 2.0 * M_PI / pattern->count;
+            break;
+        case PATTERN_SWEEP:
+            step = pattern->step;
+            break;
+        case PATTERN_AIMED_FAN:
+            if (pattern->count > 1) {
+                first = base_angle - pattern->spread / 2.0;
+                step = pattern->spread / (pattern->count - 1);
+            }
+            break;
+    }
+
+    const double table_scale = PATTERN_DIR_TABLE_SIZE / (2.0 * M_PI);
+    double first_units = first * table_scale;
+    double step_units = step * table_scale;
+    double speed = pattern->speed;
+    double radius = pattern->spawn_radius;
+
+    int base = pool->count;
+    double *px = pool->x + base;
+    double *py = pool->y + base;
+    double *pvx = pool->vx + base;
+    double *pvy = pool->vy + base;
+
+    for (int i = 0; i < count; i++) {
+        int d = (int)lrint(first_units + step_units * i) & PATTERN_DIR_MASK;
+        double dx = pattern_dir_cos[d];
+        double dy = pattern_dir_sin[d];
+        px[i] = x + dx * radius;
+        py[i] = y + dy * radius;
+        pvx[i] = dx * speed;
+        pvy[i] = dy * speed;
+    }
+    for (int i = 0; i < count; i++) {
+        pool->lifetime[base + i] = BOSS_BULLET_LIFETIME;
+        pool->owner_ship_id[base + i] = owner_ship_id;
+    }
+
+    pool->count += count;
+    return count;
+}
+
+// ============================================================================
+// POOL UPDATE
+// ============================================================================
+
+void boss_bullet_pool_integrate(BossBulletPool *pool, double dt) {
+    if (!pool) return;
+
+    // Straight-line loops over separate arrays - widest vector kernel the CPU has
+    simd_kernels.soa_integrate(pool->x, pool->y, pool->vx, pool->vy, pool->lifetime, pool->count, dt);
+}
+
+static inline void boss_bullet_pool_move(BossBulletPool *pool, int dst, int src) {
+    pool->x[dst] = pool->x[src];
+    pool->y[dst] = pool->y[src];
+    pool->vx[dst] = pool->vx[src];
+    pool->vy[dst] = pool->vy[src];
+    pool->lifetime[dst] = pool->lifetime[src];
+    pool->owner_ship_id[dst] = pool->owner_ship_id[src];
+}
+
+void boss_bullet_pool_cull(BossBulletPool *pool, double min_x, double min_y, double max_x, double max_y) {
+    if (!pool) return;
+
+    for (int i = 0; i < pool->count; i++) {
+        if (pool->lifetime[i] > 0 &&
+            pool->x[i] >= min_x && pool->x[i] <= max_x &&
+            pool->y[i] >= min_y && pool->y[i] <= max_y) {
+            continue;
+        }
+
+        // Swap with last
+        pool->count--;
+        if (i != pool->count) {
+            boss_bullet_pool_move(pool, i, pool->count);
+        }
+        i--;
+    }
+}
+
+int boss_bullet_pool_first_hit(const BossBulletPool *pool, double cx, double cy, double radius, int start) {
+    if (!pool) return -1;
+
+    return simd_kernels.soa_first_within(pool->x, pool->y, pool->lifetime, pool->count,
+                                         cx, cy, radius * radius, start);
+}
+
+void boss_bullet_pool_kill(BossBulletPool *pool, int index) {
+    if (!pool || index < 0 || index >= pool->count) return;
+    pool->lifetime[index] = 0;
+}
+
+void boss_bullet_pool_clear(BossBulletPool *pool) {
+    if (!pool) return;
+    pool->count = 0;
+}
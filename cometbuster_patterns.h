@@ -0,0 +1,75 @@
+#ifndef COMETBUSTER_PATTERNS_H
+#define COMETBUSTER_PATTERNS_H
+
+#include <stdbool.h>
+
+// ============================================================
+// BULLET PATTERN EMITTERS
+// ============================================================
+// Boss fire is described declaratively (ring, sweep, aimed fan) and
+// spawned in one batch into a structure-of-arrays pool. Spirals are
+// rings whose base angle the boss advances between volleys.
+// Directions come from a precomputed unit-vector table instead of a
+// cos/sin pair per bullet, and the pool update is a flat loop over
+// plain double arrays that the compiler can vectorise.
+//
+// Regular enemy ship and UFO fire still uses game->enemy_bullets.
+// ============================================================
+
+#define MAX_BOSS_BULLETS 4096         // Room for bullet-hell phases; ~176 KB of SimState
+#define PATTERN_DIR_TABLE_SIZE 1024     // Direction table resolution (power of two)
+#define BOSS_BULLET_LIFETIME 10.0       // Same as regular enemy bullets
+
+// Structure-of-arrays pool for boss pattern bullets
+typedef struct {
+    double x[MAX_BOSS_BULLETS];
+    double y[MAX_BOSS_BULLETS];
+    double vx[MAX_BOSS_BULLETS];
+    double vy[MAX_BOSS_BULLETS];
+    double lifetime[MAX_BOSS_BULLETS];  // <= 0 means dead, removed by the next cull
+    int owner_ship_id[MAX_BOSS_BULLETS];
+    int count;
+} BossBulletPool;
+
+typedef enum {
+    PATTERN_RING,       // count bullets evenly around 360 degrees
+    PATTERN_SWEEP,      // count bullets 'step' radians apart, starting at the base angle
+    PATTERN_AIMED_FAN   // count bullets spread across 'spread' radians, centred on the base angle
+} BulletPatternType;
+
+typedef struct {
+    BulletPatternType type;
+    int count;
+    double speed;               // Pixels per second
+    double spread;              // Fan width (radians) for PATTERN_AIMED_FAN
+    double step;                // Angle between bullets (radians) for PATTERN_SWEEP
+    double spawn_radius;        // Bullets start this far out from the emitter centre
+} BulletPattern;
+
+// Build the direction table. Called lazily by the emit functions.
+void bullet_pattern_init_tables(void);
+
+// Spawn one volley of 'pattern' at (x, y) around base_angle.
+// Returns the number of bullets actually spawned (pool may be full).
+int bullet_pattern_emit(BossBulletPool *pool, const BulletPattern *pattern,
+                        double x, double y, double base_angle, int owner_ship_id);
+
+// Single bullet along an arbitrary direction (aimed shots)
+bool boss_bullet_spawn(BossBulletPool *pool, double x, double y, double vx, double vy, int owner_ship_id);
+
+// Move every bullet and age it by dt
+void boss_bullet_pool_integrate(BossBulletPool *pool, double dt);
+
+// Remove dead bullets and bullets outside the given bounds (swap-with-last)
+void boss_bullet_pool_cull(BossBulletPool *pool, double min_x, double min_y, double max_x, double max_y);
+
+// Index of the first live bullet at or after 'start' within radius of (cx, cy), or -1
+int boss_bullet_pool_first_hit(const BossBulletPool *pool, double cx, double cy, double radius, int start);
+
+// Mark a bullet dead (it stays in the arrays until the next cull)
+void boss_bullet_pool_kill(BossBulletPool *pool, int index);
+
+// Drop every bullet (new game, wave skips, bomb-free resets)
+void boss_bullet_pool_clear(BossBulletPool *pool);
+
+#endif // COMETBUSTER_PATTERNS_H
@@ -4,8 +4,11 @@
 #include <string.h>
 #include <time.h>
 #include "cometbuster.h"
+#include "cometbuster_fastmath.h"
+#include "cometbuster_simd.h"
 #include "visualization.h"
 #include "comet_lang.h"
+#include "cometbuster_jobs.h"
 
 #ifdef ANDROID
 #include <SDL.h>
@@ -227,10 +230,21 @@ void comet_buster_update_ship(CometBusterGame *game, double dt, int mouse_x, int
     comet_buster_wrap_position(&game->ship_x, &game->ship_y, width, height);
 }
 
-void comet_buster_update_comets(CometBusterGame *game, double dt, int width, int height) {
-    if (!game) return;
+// Per-comet integration is independent (gravity only reads the boss), so it
+// runs as a parallel-for. Comet-comet collisions stay serial because each
+// impulse depends on the ones applied before it.
+typedef struct {
+    CometBusterGame *game;
+    double dt;
+    int width, height;
+} CometIntegrateJob;
+
+static void comet_buster_integrate_comet_range(void *data, int begin, int end) {
+    CometIntegrateJob *job = (CometIntegrateJob *)data;
+    CometBusterGame *game = job->game;
+    double dt = job->dt;
     
-    for (int i = 0; i < game->comet_count; i++) {
+    for (int i = begin; i < end; i++) {
         Comet *c = &game->comets[i];
         
         // ========== GRAVITY WELL EFFECT ==========
@@ -261,19 +275,25 @@ void comet_buster_update_comets(CometBusterGame *game, double dt, int width, int
                 c->vy += dir_y * gravity_accel * dt;
             }
         }
-        
-        // Update position
-        c->x += c->vx * dt;
-        c->y += c->vy * dt;
-        
-        // Update rotation
-        c->rotation += c->rotation_speed * dt;
-        while (c->rotation > 360) c->rotation -= 360;
-        
-        // Wrap
-        comet_buster_wrap_position(&c->x, &c->y, width, height);
     }
     
+    // Update position and rotation (vector kernel - gravity above only reads
+    // each comet's own state, so splitting the passes changes nothing)
+    simd_kernels.comets_advance(&game->comets[begin], end - begin, dt);
+    
+    // Wrap
+    for (int i = begin; i < end; i++) {
+        Comet *c = &game->comets[i];
+        comet_buster_wrap_position(&c->x, &c->y, job->width, job->height);
+    }
+}
+
+void comet_buster_update_comets(CometBusterGame *game, double dt, int width, int height) {
+    if (!game) return;
+    
+    CometIntegrateJob integrate = {game, dt, width, height};
+    job_parallel_for(game->comet_count, 32, comet_buster_integrate_comet_range, &integrate);
+    
     // Check comet-comet collisions
     for (int i = 0; i < game->comet_count; i++) {
         for (int j = i + 1; j < game->comet_count; j++) {
@@ -285,12 +305,13 @@ void comet_buster_update_comets(CometBusterGame *game, double dt, int width, int
             // Check collision distance
             double dx = c2->x - c1->x;
             double dy = c2->y - c1->y;
-            double dist = sqrt(dx*dx + dy*dy);
+            double dist_sq = fm_dist_sq(dx, dy);
             double min_dist = c1->radius + c2->radius;
             
-            if (dist < min_dist) {
+            // Squared test first - the root is only needed for actual hits
+            if (dist_sq < min_dist * min_dist) {
                 // Collision detected - perform elastic collision physics
-                comet_buster_handle_comet_collision(c1, c2, dx, dy, dist, min_dist);
+                comet_buster_handle_comet_collision(c1, c2, dx, dy, sqrt(dist_sq), min_dist);
             }
         }
     }
@@ -356,30 +377,43 @@ void comet_buster_update_bullets(CometBusterGame *game, double dt, int width, in
     }
 }
 
+// Particles are integrated in parallel, then dead ones are removed serially.
+// The removal pass swaps the last particle into each dead slot exactly like the
+// old single loop did, so the array order stays identical to the serial update.
+typedef struct {
+    CometBusterGame *game;
+    double dt;
+} ParticleIntegrateJob;
+
+static void comet_buster_integrate_particle_range(void *data, int begin, int end) {
+    ParticleIntegrateJob *job = (ParticleIntegrateJob *)data;
+    
+    // Lifetime, then position with gravity (100 px/s^2) for live particles
+    simd_kernels.particles_integrate(&job->game->particles[begin], end - begin, job->dt, 100.0);
+}
+
 void comet_buster_update_particles(CometBusterGame *game, double dt) {
     if (!game) return;
     
-    for (int i = 0; i < game->particle_count; i++) {
-        Particle *p = &game->particles[i];
-        
-        // Update lifetime
-        p->lifetime -= dt;
-        if (p->lifetime <= 0) {
-            p->active = false;
+    // GPU particles advance by the same simulated time
+    game->particle_clock += dt;
+    
+    ParticleIntegrateJob integrate = {game, dt};
+    job_parallel_for(game->particle_count, 256, comet_buster_integrate_particle_range, &integrate);
+    
+    int i = 0;
+    while (i < game->particle_count) {
+        if (game->particles[i].lifetime <= 0) {
+            game->particles[i].active = false;
             
             // Swap with last
             if (i != game->particle_count - 1) {
                 game->particles[i] = game->particles[game->particle_count - 1];
             }
             game->particle_count--;
-            i--;
             continue;
         }
-        
-        // Update position with gravity
-        p->x += p->vx * dt;
-        p->y += p->vy * dt;
-        p->vy += 100.0 * dt;
+        i++;
     }
 }
 
@@ -912,11 +946,12 @@ void comet_buster_update_enemy_ships(CometBusterGame *game, double dt, int width
             
             double dx = ship->x - comet->x;
             double dy = ship->y - comet->y;
-            double dist = sqrt(dx*dx + dy*dy);
             
             double collision_radius = 50.0;  // Only emergency dodge when very close
+            if (!fm_within(dx, dy, collision_radius)) continue;
             
-            if (dist < collision_radius && dist > 0.1) {
+            double dist = sqrt(dx*dx + dy*dy);
+            if (dist > 0.1) {
                 double strength = (1.0 - (dist / collision_radius)) * 0.3;
                 double norm_x = dx / dist;
                 double norm_y = dy / dist;
@@ -1037,9 +1072,10 @@ void comet_buster_update_enemy_ships(CometBusterGame *game, double dt, int width
                 
                 double dx = target_ship->x - ship->x;
                 double dy = target_ship->y - ship->y;
+                if (!fm_within(dx, dy, provoke_range)) continue;
                 double dist = sqrt(dx*dx + dy*dy);
                 
-                if (dist < provoke_range && dist < nearest_blue_dist) {
+                if (dist < nearest_blue_dist) {
                     nearest_blue_dist = dist;
                     nearest_blue_idx = j;
                     found_blue_ship = true;
@@ -1104,24 +1140,22 @@ void comet_buster_update_enemy_ships(CometBusterGame *game, double dt, int width
                 if (ship->shoot_cooldown <= 0) {
                     // Find nearest comet
                     int nearest_comet_idx = -1;
-                    double nearest_dist = 1e9;
+                    double nearest_dist_sq = 1e18;
                     
                     for (int j = 0; j < game->comet_count; j++) {
                         Comet *comet = &game->comets[j];
                         if (!comet->active) continue;
                         
-                        double dx = comet->x - ship->x;
-                        double dy = comet->y - ship->y;
-                        double dist = sqrt(dx*dx + dy*dy);
+                        double dist_sq = fm_dist_sq(comet->x - ship->x, comet->y - ship->y);
                         
-                        if (dist < nearest_dist) {
-                            nearest_dist = dist;
+                        if (dist_sq < nearest_dist_sq) {
+                            nearest_dist_sq = dist_sq;
                             nearest_comet_idx = j;
                         }
                     }
                     
                     // Shoot at nearest comet if in range
-                    if (nearest_comet_idx >= 0 && nearest_dist < 600.0) {
+                    if (nearest_comet_idx >= 0 && nearest_dist_sq < 600.0 * 600.0) {
                         Comet *target = &game->comets[nearest_comet_idx];
                         double dx = target->x - ship->x;
                         double dy = target->y - ship->y;
@@ -1165,9 +1199,10 @@ void comet_buster_update_enemy_ships(CometBusterGame *game, double dt, int width
                 
                 double dx = target_ship->x - ship->x;
                 double dy = target_ship->y - ship->y;
+                if (!fm_within(dx, dy, provoke_range)) continue;
                 double dist = sqrt(dx*dx + dy*dy);
                 
-                if (dist < provoke_range && dist < nearest_blue_dist) {
+                if (dist < nearest_blue_dist) {
                     nearest_blue_dist = dist;
                     nearest_blue_idx = j;
                     found_blue_ship = true;
@@ -1208,24 +1243,22 @@ void comet_buster_update_enemy_ships(CometBusterGame *game, double dt, int width
                 if (ship->shoot_cooldown <= 0) {
                     // Find nearest comet
                     int nearest_comet_idx = -1;
-                    double nearest_dist = 1e9;
+                    double nearest_dist_sq = 1e18;
                     
                     for (int j = 0; j < game->comet_count; j++) {
                         Comet *comet = &game->comets[j];
                         if (!comet->active) continue;
                         
-                        double dx = comet->x - ship->x;
-                        double dy = comet->y - ship->y;
-                        double dist = sqrt(dx*dx + dy*dy);
+                        double dist_sq = fm_dist_sq(comet->x - ship->x, comet->y - ship->y);
                         
-                        if (dist < nearest_dist) {
-                            nearest_dist = dist;
+                        if (dist_sq < nearest_dist_sq) {
+                            nearest_dist_sq = dist_sq;
                             nearest_comet_idx = j;
                         }
                     }
                     
                     // Shoot at nearest comet if in range
-                    if (nearest_comet_idx >= 0 && nearest_dist < 600.0) {
+                    if (nearest_comet_idx >= 0 && nearest_dist_sq < 600.0 * 600.0) {
                         Comet *target = &game->comets[nearest_comet_idx];
                         double dx = target->x - ship->x;
                         double dy = target->y - ship->y;
@@ -1519,6 +1552,57 @@ void comet_buster_update_enemy_bullets(CometBusterGame *game, double dt, int wid
     }
 }
 
+void comet_buster_update_boss_bullets(CometBusterGame *game, double dt, int width, int height, void *vis) {
+    if (!game) return;
+    
+    BossBulletPool *pool = &game->boss_bullets;
+    if (pool->count == 0) return;
+    
+    boss_bullet_pool_integrate(pool, dt);
+    
+    // Boss pattern fire breaks asteroids. Enemy ships and UFOs are hit in
+    // comet_buster_update_collisions(), like regular enemy bullets.
+    for (int j = 0; j < game->comet_count; j++) {
+        Comet *c = &game->comets[j];
+        if (!c->active) continue;
+        
+        int hit = boss_bullet_pool_first_hit(pool, c->x, c->y, c->radius + 2.0, 0);
+        if (hit >= 0) {
+            boss_bullet_pool_kill(pool, hit);
+            comet_buster_destroy_comet(game, j, width, height, vis);
+        }
+    }
+    
+    // Bullets from other sources hit the boss and are destroyed, but the
+    // boss takes no damage. Its own fire (-3) passes through.
+    if (game->boss.active) {
+        BossShip *boss = &game->boss;
+        double radius = boss->void_radius > 0 ? boss->void_radius * 0.5 : 35.0;
+        for (int hit = boss_bullet_pool_first_hit(pool, boss->x, boss->y, radius, 0);
+             hit >= 0;
+             hit = boss_bullet_pool_first_hit(pool, boss->x, boss->y, radius, hit + 1)) {
+            if (pool->owner_ship_id[hit] == -3) continue;
+            comet_buster_spawn_explosion(game, pool->x[hit], pool->y[hit], 0, 3);  // Small impact
+            boss_bullet_pool_kill(pool, hit);
+        }
+    }
+    
+    // Same for the spawn queen, which ignores her own fire (-4)
+    if (game->spawn_queen.active && game->spawn_queen.is_spawn_queen) {
+        SpawnQueenBoss *queen = &game->spawn_queen;
+        for (int hit = boss_bullet_pool_first_hit(pool, queen->x, queen->y, 50.0, 0);
+             hit >= 0;
+             hit = boss_bullet_pool_first_hit(pool, queen->x, queen->y, 50.0, hit + 1)) {
+            if (pool->owner_ship_id[hit] == -4) continue;
+            comet_buster_spawn_explosion(game, pool->x[hit], pool->y[hit], 0, 3);  // Small impact
+            boss_bullet_pool_kill(pool, hit);
+        }
+    }
+    
+    // Drop expired, used and off-screen bullets
+    boss_bullet_pool_cull(pool, -50, -50, width + 50, height + 50);
+}
+
 void comet_buster_update_shooting(CometBusterGame *game, double dt, void *vis) {
     if (!game || game->game_over) return;
     
@@ -1898,6 +1982,125 @@ void comet_buster_update_fuel(CometBusterGame *game, double dt, void *vis) {
     }
 }
 
+// ============================================================================
+// UPDATE STAGE GRAPH
+// ============================================================================
+// These stages used to run strictly one after another. The edges below follow
+// what each stage reads and writes (entity arrays, spawn order and rand()
+// calls), so whatever order the job system picks gives exactly the same state
+// as the old serial sequence:
+//
+//   comets -> shooting -> bullets -+-> particles -> missiles -> fuel
+//                                  +-> floating text
+//                                  +-> canisters
+//                                  +-> missile pickups
+//   burner effects (only reads ship velocities, independent of the rest)
+//
+// Stages that play sounds or call rand() all sit on the single chain.
+
+typedef struct {
+    CometBusterGame *game;
+    Visualizer *visualizer;
+    double dt;
+    int width, height;
+} UpdateStageContext;
+
+static UpdateStageContext update_stage_ctx;
+static JobGraph update_stage_graph;
+static bool update_stage_graph_built = false;
+
+static void update_stage_comets(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_comets(ctx->game, ctx->dt, ctx->width, ctx->height);
+}
+
+static void update_stage_shooting(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_shooting(ctx->game, ctx->dt, ctx->visualizer);  // Uses mouse_left_pressed state
+}
+
+static void update_stage_bullets(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_bullets(ctx->game, ctx->dt, ctx->width, ctx->height, ctx->visualizer);
+}
+
+static void update_stage_particles(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_particles(ctx->game, ctx->dt);
+}
+
+static void update_stage_floating_text(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_floating_text(ctx->game, ctx->dt);  // Update floating text popups
+}
+
+static void update_stage_canisters(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_canisters(ctx->game, ctx->dt);  // Update shield canisters
+}
+
+static void update_stage_missile_pickups(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_missile_pickups(ctx->game, ctx->dt);  // Update missile pickups
+}
+
+static void update_stage_missiles(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_missiles(ctx->game, ctx->dt, ctx->width, ctx->height);  // Spawns smoke particles
+}
+
+static void update_stage_fuel(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_fuel(ctx->game, ctx->dt, ctx->visualizer);  // Update fuel system
+}
+
+static void update_stage_burner_effects(void *data) {
+    UpdateStageContext *ctx = (UpdateStageContext *)data;
+    comet_buster_update_burner_effects(ctx->game, ctx->dt);  // Update thruster/burner effects
+}
+
+static void comet_buster_build_update_graph(void) {
+    JobGraph *g = &update_stage_graph;
+    UpdateStageContext *ctx = &update_stage_ctx;
+    
+    job_graph_init(g);
+    int comets    = job_graph_add(g, "comets", update_stage_comets, ctx);
+    int shooting  = job_graph_add(g, "shooting", update_stage_shooting, ctx);
+    int bullets   = job_graph_add(g, "bullets", update_stage_bullets, ctx);
+    int particles = job_graph_add(g, "particles", update_stage_particles, ctx);
+    int texts     = job_graph_add(g, "floating_text", update_stage_floating_text, ctx);
+    int canisters = job_graph_add(g, "canisters", update_stage_canisters, ctx);
+    int pickups   = job_graph_add(g, "missile_pickups", update_stage_missile_pickups, ctx);
+    int missiles  = job_graph_add(g, "missiles", update_stage_missiles, ctx);
+    int fuel      = job_graph_add(g, "fuel", update_stage_fuel, ctx);
+    job_graph_add(g, "burner_effects", update_stage_burner_effects, ctx);
+    
+    job_graph_depend(g, shooting, comets);      // Missile targeting reads comet positions
+    job_graph_depend(g, bullets, shooting);     // New bullets move this frame
+    job_graph_depend(g, particles, bullets);    // Comet explosions spawn particles
+    job_graph_depend(g, texts, bullets);        // Score popups and weapon-change text
+    job_graph_depend(g, canisters, bullets);    // Destroyed comets drop canisters
+    job_graph_depend(g, pickups, bullets);      // ...and missile pickups
+    job_graph_depend(g, missiles, particles);   // Smoke trails append to the particle array
+    job_graph_depend(g, fuel, missiles);        // Keeps ammo/energy updates in serial order
+    
+    update_stage_graph_built = true;
+}
+
+static void comet_buster_run_update_stages(CometBusterGame *game, Visualizer *visualizer, double dt, int width, int height) {
+    if (!update_stage_graph_built) {
+        comet_buster_build_update_graph();
+    }
+    
+    update_stage_ctx.game = game;
+    update_stage_ctx.visualizer = visualizer;
+    update_stage_ctx.dt = dt;
+    update_stage_ctx.width = width;
+    update_stage_ctx.height = height;
+    
+    job_graph_run(&update_stage_graph);
+}
+
 void update_comet_buster(Visualizer *visualizer, double dt) {
     if (!visualizer) return;
     
@@ -2027,16 +2230,9 @@ void update_comet_buster(Visualizer *visualizer, double dt) {
     comet_buster_update_ship(game, dt, mouse_x, mouse_y, width, height, true);
 #endif
 
-    comet_buster_update_comets(game, dt, width, height);
-    comet_buster_update_shooting(game, dt, visualizer);  // Uses mouse_left_pressed state
-    comet_buster_update_bullets(game, dt, width, height, visualizer);
-    comet_buster_update_particles(game, dt);
-    comet_buster_update_floating_text(game, dt);  // Update floating text popups
-    comet_buster_update_canisters(game, dt);  // Update shield canisters
-    comet_buster_update_missile_pickups(game, dt);  // Update missile pickups
-    comet_buster_update_missiles(game, dt, width, height);  // Update missiles
-    comet_buster_update_fuel(game, dt, visualizer);  // Update fuel system
-    comet_buster_update_burner_effects(game, dt);  // Update thruster/burner effects
+    // Comets, shooting, bullets, particles, pickups, missiles, fuel and burners
+    // (runs independent stages in parallel, see comet_buster_run_update_stages)
+    comet_buster_run_update_stages(game, visualizer, dt, width, height);
     
     // Update shield regeneration
     if (game->shield_health < game->max_shield_health) {
@@ -2058,6 +2254,7 @@ void update_comet_buster(Visualizer *visualizer, double dt) {
     
     comet_buster_update_enemy_ships(game, dt, width, height, visualizer);  // Update enemy ships
     comet_buster_update_enemy_bullets(game, dt, width, height, visualizer);  // Update enemy bullets
+    comet_buster_update_boss_bullets(game, dt, width, height, visualizer);  // Update boss pattern bullets
     comet_buster_update_ufos(game, dt, width, height, visualizer);  // Update UFO flying saucers
 
     // Check missiles hitting enemy ships
@@ -2492,6 +2689,36 @@ void update_comet_buster(Visualizer *visualizer, double dt) {
         }
     }
     
+    // Boss pattern bullets hit enemy ships the same way. Their owner ids
+    // are negative, so no ship is ever skipped as the shooter.
+    for (int i = 0; i < game->enemy_ship_count; i++) {
+        EnemyShip *target_ship = &game->enemy_ships[i];
+        if (!target_ship->active) continue;
+        
+        int hit = boss_bullet_pool_first_hit(&game->boss_bullets, target_ship->x, target_ship->y, 15.0, 0);
+        if (hit < 0) continue;
+        
+        double hit_x = game->boss_bullets.x[hit];
+        double hit_y = game->boss_bullets.y[hit];
+        boss_bullet_pool_kill(&game->boss_bullets, hit);
+        
+        // Blue ships are provoked instead of damaged
+        if (comet_buster_hit_enemy_ship_provoke(game, i)) continue;
+        
+        if (target_ship->shield_health > 0) {
+            target_ship->shield_health--;
+            target_ship->shield_impact_angle = atan2(target_ship->y - hit_y, target_ship->x - hit_x);
+            target_ship->shield_impact_timer = 0.2;
+        } else {
+            comet_buster_destroy_enemy_ship(game, i, width, height, visualizer);
+            
+            // Award player points for friendly fire destruction
+            if (!game->game_over) {
+                game->score += (int)(150 * game->score_multiplier);
+            }
+        }
+    }
+    
     // Check enemy bullet-ship collisions
     for (int i = 0; i < game->enemy_bullet_count; i++) {
         if (comet_buster_check_enemy_bullet_ship(game, &game->enemy_bullets[i])) {
@@ -2509,6 +2736,15 @@ void update_comet_buster(Visualizer *visualizer, double dt) {
         }
     }
     
+    // Check boss bullet-ship collisions
+    for (int hit = boss_bullet_pool_first_hit(&game->boss_bullets, game->ship_x, game->ship_y, 15.0, 0);
+         hit >= 0;
+         hit = boss_bullet_pool_first_hit(&game->boss_bullets, game->ship_x, game->ship_y, 15.0, hit + 1)) {
+        comet_buster_on_ship_hit(game, visualizer);
+        // Bullet disappears on impact, the next update culls it
+        boss_bullet_pool_kill(&game->boss_bullets, hit);
+    }
+    
     // Check enemy bullet-UFO collisions (enemy ships can damage UFOs!)
     for (int i = 0; i < game->ufo_count; i++) {
         for (int j = 0; j < game->enemy_bullet_count; j++) {
@@ -2533,6 +2769,19 @@ void update_comet_buster(Visualizer *visualizer, double dt) {
                 break;
             }
         }
+        
+        // Boss pattern bullets damage UFOs too (one per UFO per frame)
+        UFO *ufo = &game->ufos[i];
+        if (!ufo->active) continue;
+        int hit = boss_bullet_pool_first_hit(&game->boss_bullets, ufo->x, ufo->y, 25.0, 0);
+        if (hit >= 0) {
+            boss_bullet_pool_kill(&game->boss_bullets, hit);
+            ufo->health--;
+            ufo->damage_flash_timer = 0.1;
+            if (ufo->health <= 0) {
+                comet_buster_destroy_ufo(game, i, width, height, visualizer);
+            }
+        }
     }
     
     // Check enemy missiles hitting player
@@ -3174,7 +3423,7 @@ MissileTarget comet_buster_find_best_missile_target(CometBusterGame *game, doubl
     // Returns value between 0 (dead ahead) and 1 (to the side)
     auto get_angle_penalty = [](double ship_angle, double target_dx, double target_dy) -> double {
         // Calculate angle to target
-        double target_angle = atan2(target_dy, target_dx);
+        double target_angle = fm_atan2(target_dy, target_dx);
         
         // Calculate difference between ship angle and target angle
         double angle_diff = target_angle - ship_angle;
@@ -3279,7 +3528,7 @@ MissileTarget comet_buster_find_best_anti_asteroid_target(CometBusterGame *game,
     double ship_angle = game->ship_angle;
     
     auto get_angle_penalty = [](double ship_angle, double target_dx, double target_dy) -> double {
-        double target_angle = atan2(target_dy, target_dx);
+        double target_angle = fm_atan2(target_dy, target_dx);
         double angle_diff = target_angle - ship_angle;
         
         while (angle_diff > M_PI) angle_diff -= 2.0 * M_PI;
@@ -3381,10 +3630,11 @@ MissileTarget comet_buster_find_furthest_comet_in_range(CometBusterGame *game, d
         
         double dx = comet->x - x;
         double dy = comet->y - y;
-        double dist = sqrt(dx*dx + dy*dy);
+        double dist_sq = fm_dist_sq(dx, dy);
         
         // Only consider comets within max range
-        if (dist > max_range) continue;
+        if (dist_sq > max_range * max_range) continue;
+        double dist = sqrt(dist_sq);
         
         // Update if this is further than our current best (or it's the first one)
         if (dist > best.score) {
@@ -3402,10 +3652,11 @@ MissileTarget comet_buster_find_furthest_comet_in_range(CometBusterGame *game, d
             
             double dx = ufo->x - x;
             double dy = ufo->y - y;
-            double dist = sqrt(dx*dx + dy*dy);
+            double dist_sq = fm_dist_sq(dx, dy);
             
             // Only consider UFOs within max range
-            if (dist > max_range) continue;
+            if (dist_sq > max_range * max_range) continue;
+            double dist = sqrt(dist_sq);
             
             // Update if this is further than our current best (or it's the first one)
             if (dist > best.score) {
@@ -3437,10 +3688,11 @@ MissileTarget comet_buster_find_comet_at_preferred_distance(CometBusterGame *gam
         
         double dx = comet->x - x;
         double dy = comet->y - y;
-        double dist = sqrt(dx*dx + dy*dy);
+        double dist_sq = fm_dist_sq(dx, dy);
         
         // Only consider comets in preferred range
-        if (dist < min_range || dist > max_range) continue;
+        if (dist_sq < min_range * min_range || dist_sq > max_range * max_range) continue;
+        double dist = sqrt(dist_sq);
         
         // Distance from preferred distance (lower is better)
         double distance_error = fabs(dist - preferred_dist);
@@ -3460,10 +3712,11 @@ MissileTarget comet_buster_find_comet_at_preferred_distance(CometBusterGame *gam
             
             double dx = ufo->x - x;
             double dy = ufo->y - y;
-            double dist = sqrt(dx*dx + dy*dy);
+            double dist_sq = fm_dist_sq(dx, dy);
             
             // Only consider UFOs in preferred range
-            if (dist < min_range || dist > max_range) continue;
+            if (dist_sq < min_range * min_range || dist_sq > max_range * max_range) continue;
+            double dist = sqrt(dist_sq);
             
             // Distance from preferred distance (lower is better)
             double distance_error = fabs(dist - preferred_dist);
@@ -3533,10 +3786,11 @@ MissileTarget comet_buster_find_comet_in_distance_range(CometBusterGame *game, d
         
         double dx = comet->x - x;
         double dy = comet->y - y;
-        double dist = sqrt(dx*dx + dy*dy);
+        double dist_sq = fm_dist_sq(dx, dy);
         
         // Only consider comets in range
-        if (dist < min_range || dist > max_range) continue;
+        if (dist_sq < min_range * min_range || dist_sq > max_range * max_range) continue;
+        double dist = sqrt(dist_sq);
         
         if (dist < best.score) {
             best.score = dist;
@@ -3553,10 +3807,11 @@ MissileTarget comet_buster_find_comet_in_distance_range(CometBusterGame *game, d
             
             double dx = ufo->x - x;
             double dy = ufo->y - y;
-            double dist = sqrt(dx*dx + dy*dy);
+            double dist_sq = fm_dist_sq(dx, dy);
             
             // Only consider UFOs in range
-            if (dist < min_range || dist > max_range) continue;
+            if (dist_sq < min_range * min_range || dist_sq > max_range * max_range) continue;
+            double dist = sqrt(dist_sq);
             
             if (dist < best.score) {
                 best.score = dist;
@@ -3825,8 +4080,10 @@ void comet_buster_update_missiles(CometBusterGame *game, double dt, int width, i
             }
         }
         
-        missile->vx = cos(missile->angle) * missile->speed;  // missile->angle is in radians!
-        missile->vy = sin(missile->angle) * missile->speed;
+        double dir_s, dir_c;
+        fm_sincos(missile->angle, &dir_s, &dir_c);
+        missile->vx = dir_c * missile->speed;  // missile->angle is in radians!
+        missile->vy = dir_s * missile->speed;
         
         missile->x += missile->vx * dt;
         missile->y += missile->vy * dt;
@@ -3837,8 +4094,8 @@ void comet_buster_update_missiles(CometBusterGame *game, double dt, int width, i
             
             // Spawn behind the missile (opposite direction of travel)
             double backward_dist = 4.0;
-            smoke->x = missile->x - cos(missile->angle) * backward_dist;
-            smoke->y = missile->y - sin(missile->angle) * backward_dist;
+            smoke->x = missile->x - dir_c * backward_dist;
+            smoke->y = missile->y - dir_s * backward_dist;
             
             // Smoke color (dark gray, looks like actual smoke)
             smoke->color[0] = 0.25f;
@@ -3846,14 +4103,14 @@ void comet_buster_update_missiles(CometBusterGame *game, double dt, int width, i
             smoke->color[2] = 0.25f;
             
             // Small particle size (looks more like smoke cloud)
-            smoke->size = 1.0f + (rand() % 8) / 20.0f;  // 1.0 to 1.4
+            smoke->size = 1.0f + (comet_buster_cosmetic_rand(game) % 8) / 20.0f;  // 1.0 to 1.4
             
             // Velocity - mostly upward (against gravity) with slight spread
-            smoke->vx = (rand() % 100 - 50) / 100.0 * 10.0;  // -5 to +5 horizontal spread
-            smoke->vy = -80.0 - (rand() % 40);  // -80 to -120 upward velocity
+            smoke->vx = (comet_buster_cosmetic_rand(game) % 100 - 50) / 100.0 * 10.0;  // -5 to +5 horizontal spread
+            smoke->vy = -80.0 - (comet_buster_cosmetic_rand(game) % 40);  // -80 to -120 upward velocity
             
             // Short lifetime - evaporates quickly
-            smoke->lifetime = 0.3 + (rand() % 100) / 1000.0;  // 0.3 to 0.4 seconds
+            smoke->lifetime = 0.3 + (comet_buster_cosmetic_rand(game) % 100) / 1000.0;  // 0.3 to 0.4 seconds
             smoke->max_lifetime = smoke->lifetime;
             
             smoke->active = true;
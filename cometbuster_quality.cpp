@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <string.h>
+#include "cometbuster_quality.h"
+
+// ============================================================================
+// QUALITY LEVELS
+// ============================================================================
+// Cheapest visual losses first: fewer debris particles and shorter trails,
+// then glow halos (large soft quads - fill rate on llvmpipe and Pi GPUs),
+// then the stroke fringe, which triples the fill of a one-pixel line.
+
+static const QualityLevel quality_levels[QUALITY_LEVEL_COUNT] = {
+    // name      particles glows  trails  antialias
+    { "lowest",  0.25f,    false, 0.25f,  false },
+    { "low",     0.5f,     false, 0.5f,   true  },
+    { "medium",  0.75f,    true,  0.75f,  true  },
+    { "high",    1.0f,     true,  1.0f,   true  },
+};
+
+// ============================================================================
+// GOVERNOR
+// ============================================================================
+
+#define QUALITY_WINDOW 30               // Frames in the rolling average
+#define QUALITY_SLOW_FACTOR 1.15        // Average interval above this x target: step down
+#define QUALITY_FAST_FACTOR 0.6         // Average work below this x target: headroom
+#define QUALITY_DOWN_HOLD 0.5           // Seconds of slow frames before stepping down
+#define QUALITY_UP_HOLD 3.0             // Seconds of headroom before stepping up
+#define QUALITY_UP_HOLD_MAX 60.0
+#define QUALITY_UNDO_WINDOW 5.0         // A step down this soon after a step up undoes it
+#define QUALITY_MAX_INTERVAL 0.25       // Longer frames are stalls (loading, window moves)
+
+static SDL_atomic_t quality_current_level = { QUALITY_LEVEL_COUNT - 1 };
+
+static struct {
+    bool enabled;
+    double target;                      // Seconds per frame
+    Uint64 frame_start;
+    Uint64 work_done;
+
+    double intervals[QUALITY_WINDOW];
+    double work[QUALITY_WINDOW];
+    int samples;
+    int next;
+    double interval_sum;
+    double work_sum;
+
+    double slow_time;                   // How long the average has been slow
+    double fast_time;                   // ...or showing headroom
+    double since_step_up;
+    double up_hold;
+} quality_gov = {
+    true, 1.0 / QUALITY_DEFAULT_TARGET_FPS, 0, 0,
+    {0}, {0}, 0, 0, 0.0, 0.0,
+    0.0, 0.0, 1e9, QUALITY_UP_HOLD
+};
+
+static double quality_seconds(Uint64 from, Uint64 to) {
+    return (double)(to - from) / (double)SDL_GetPerformanceFrequency();
+}
+
+static void quality_reset_window(void) {
+    quality_gov.samples = 0;
+    quality_gov.next = 0;
+    quality_gov.interval_sum = 0.0;
+    quality_gov.work_sum = 0.0;
+    quality_gov.slow_time = 0.0;
+    quality_gov.fast_time = 0.0;
+}
+
+static void quality_set_level(int level, const char *reason) {
+    SDL_AtomicSet(&quality_current_level, level);
+    quality_reset_window();
+    SDL_Log("[Comet Busters] [QUALITY] %s -> %s\n", reason, quality_levels[level].name);
+}
+
+static void quality_governor_sample(double interval, double work) {
+    // Stalls say nothing about rendering cost
+    if (interval > QUALITY_MAX_INTERVAL) return;
+
+    if (quality_gov.samples == QUALITY_WINDOW) {
+        quality_gov.interval_sum -= quality_gov.intervals[quality_gov.next];
+        quality_gov.work_sum -= quality_gov.work[quality_gov.next];
+    } else {
+        quality_gov.samples++;
+    }
+    quality_gov.intervals[quality_gov.next] = interval;
+    quality_gov.work[quality_gov.next] = work;
+    quality_gov.interval_sum += interval;
+    quality_gov.work_sum += work;
+    quality_gov.next = (quality_gov.next + 1) % QUALITY_WINDOW;
+    quality_gov.since_step_up += interval;
+
+    if (quality_gov.samples < QUALITY_WINDOW) return;
+
+    double avg_interval = quality_gov.interval_sum / QUALITY_WINDOW;
+    double avg_work = quality_gov.work_sum / QUALITY_WINDOW;
+    int level = SDL_AtomicGet(&quality_current_level);
+
+    if (avg_interval > quality_gov.target * QUALITY_SLOW_FACTOR) {
+        quality_gov.slow_time += interval;
+        quality_gov.fast_time = 0.0;
+    } else if (avg_work < quality_gov.target * QUALITY_FAST_FACTOR) {
+        quality_gov.fast_time += interval;
+        quality_gov.slow_time = 0.0;
+    } else {
+        quality_gov.slow_time = 0.0;
+        quality_gov.fast_time = 0.0;
+    }
+
+    if (quality_gov.slow_time >= QUALITY_DOWN_HOLD && level > 0) {
+        // Undoing a recent step up: wait longer before trying again
+        if (quality_gov.since_step_up < QUALITY_UNDO_WINDOW) {
+            quality_gov.up_hold *= 2.0;
+            if (quality_gov.up_hold > QUALITY_UP_HOLD_MAX) quality_gov.up_hold = QUALITY_UP_HOLD_MAX;
+        }
+        quality_set_level(level - 1, "Frames over budget");
+    } else if (quality_gov.fast_time >= quality_gov.up_hold && level < QUALITY_LEVEL_COUNT - 1) {
+        quality_gov.since_step_up = 0.0;
+        quality_set_level(level + 1, "Headroom");
+    } else if (quality_gov.since_step_up > QUALITY_UP_HOLD_MAX) {
+        // Settled for a long while - forget old flapping
+        quality_gov.up_hold = QUALITY_UP_HOLD;
+    }
+}
+
+void quality_governor_init(int target_fps, int refresh_hz) {
+    if (refresh_hz > 0 && (target_fps <= 0 || target_fps > refresh_hz)) {
+        target_fps = refresh_hz;
+    }
+    if (target_fps <= 0) target_fps = QUALITY_DEFAULT_TARGET_FPS;
+    quality_gov.target = 1.0 / target_fps;
+    quality_gov.frame_start = 0;
+    quality_gov.work_done = 0;
+    quality_gov.since_step_up = 1e9;
+    quality_gov.up_hold = QUALITY_UP_HOLD;
+    quality_reset_window();
+    SDL_AtomicSet(&quality_current_level, QUALITY_LEVEL_COUNT - 1);
+    SDL_Log("[Comet Busters] [QUALITY] Frame budget %.2f ms (%d fps)\n", quality_gov.target * 1000.0, target_fps);
+}
+
+void quality_governor_set_enabled(bool enabled) {
+    quality_gov.enabled = enabled;
+    if (!enabled) {
+        SDL_AtomicSet(&quality_current_level, QUALITY_LEVEL_COUNT - 1);
+    }
+    quality_reset_window();
+}
+
+bool quality_governor_enabled(void) {
+    return quality_gov.enabled;
+}
+
+void quality_frame_begin(void) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (quality_gov.enabled && quality_gov.frame_start && quality_gov.work_done >= quality_gov.frame_start) {
+        quality_governor_sample(quality_seconds(quality_gov.frame_start, now),
+                                quality_seconds(quality_gov.frame_start, quality_gov.work_done));
+    }
+    quality_gov.frame_start = now;
+}
+
+void quality_frame_work_done(void) {
+    quality_gov.work_done = SDL_GetPerformanceCounter();
+}
+
+int quality_level(void) {
+    return SDL_AtomicGet(&quality_current_level);
+}
+
+const QualityLevel *quality_current(void) {
+    return &quality_levels[quality_level()];
+}
+
+void quality_governor_describe(char *text, size_t size) {
+    const QualityLevel *q = quality_current();
+    int samples = quality_gov.samples;
+    double interval = 0.0, work = 0.0;
+    if (samples > 0) {
+        // Window sums cover the newest 'samples' frames
+        interval = quality_gov.interval_sum / samples;
+        work = quality_gov.work_sum / samples;
+    }
+    snprintf(text, size,
+             "%.1f FPS  %.1f ms (work %.1f ms)  quality %s%s: particles %d%%  glow %s  trails %d%%  AA %s",
+             interval > 0.0 ? 1.0 / interval : 0.0, interval * 1000.0, work * 1000.0,
+             q->name, quality_gov.enabled ? "" : " (fixed)",
+             (int)(q->particle_density * 100.0f + 0.5f),
+             q->glows ? "on" : "off", (int)(q->trail_scale * 100.0f + 0.5f),
+             q->antialias ? "on" : "off");
+}
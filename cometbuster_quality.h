@@ -0,0 +1,71 @@
+#ifndef COMETBUSTER_QUALITY_H
+#define COMETBUSTER_QUALITY_H
+
+#ifdef ANDROID
+#include <SDL.h>
+#else
+#include <SDL2/SDL.h>
+#endif
+
+#include <stddef.h>
+#include <stdbool.h>
+
+// ============================================================
+// ADAPTIVE QUALITY GOVERNOR
+// ============================================================
+// Watches how long frames take against the target frame time and
+// steps a quality level up or down. Each level is a fixed set of
+// knobs: explosion particle density, glow halos, trail length and
+// stroke anti-aliasing. Circles and arcs are drawn by the sprite
+// shaders at any size, so there is no tessellation to thin.
+//
+// Stepping down is quick (a missed-frame average held for half a
+// second), stepping up is slow (clear headroom for several seconds)
+// and gets slower every time a step up is undone soon after, so the
+// level does not flap between two settings.
+//
+// The front-end calls quality_frame_begin() at the top of each frame
+// and quality_frame_work_done() once everything is submitted, before
+// the buffer swap, so the governor sees both the frame interval and
+// the time spent producing the frame. The level is read from any
+// thread (the draw list build runs on the job system).
+//
+// Only the renderers look at the level - explosion debris is thinned
+// where it is drawn - so the simulation and replays are the same at
+// every level. The render benchmark pins the top level so its frame
+// hashes compare.
+// ============================================================
+
+#define QUALITY_LEVEL_COUNT 4
+#define QUALITY_DEFAULT_TARGET_FPS 60
+
+typedef struct {
+    const char *name;
+    float particle_density;     // Share of explosion debris drawn
+    bool glows;                 // Soft glow halos under bright sprites
+    float trail_scale;          // Scale on sprite trail length
+    bool antialias;             // One-pixel fringe on strokes
+} QualityLevel;
+
+// Target frame rate (defaults to QUALITY_DEFAULT_TARGET_FPS).
+// refresh_hz is the display rate when swaps wait for vblank, else 0:
+// frames cannot come faster than the display, so a 60 fps target on a
+// 50 Hz display is judged against 50.
+void quality_governor_init(int target_fps, int refresh_hz);
+
+// false pins the top level and ignores frame timings
+void quality_governor_set_enabled(bool enabled);
+bool quality_governor_enabled(void);
+
+void quality_frame_begin(void);
+void quality_frame_work_done(void);
+
+// Current level, 0 (lowest) to QUALITY_LEVEL_COUNT - 1
+int quality_level(void);
+const QualityLevel *quality_current(void);
+
+// One line for the debug overlay: frame rate, frame and work time,
+// level and knobs
+void quality_governor_describe(char *text, size_t size);
+
+#endif // COMETBUSTER_QUALITY_H
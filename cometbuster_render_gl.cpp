@@ -11,6 +11,11 @@
 #include "cometbuster_splashscreen.h"
 #include "comet_lang.h"
 #include "cometbuster_render_gl.h"
+#include "cometbuster_drawlist.h"
+#include "cometbuster_fastmath.h"
+#include "cometbuster_simd.h"
+#include "cometbuster_quality.h"
+#include "cometbuster_jobs.h"
 
 
 #ifdef ANDROID
@@ -53,64 +58,405 @@ static Mat4 mat4_ortho(float left, float right, float bottom, float top, float n
     return m;
 }
 
-// ✅ ANDROID OPTIMIZATION: Cache line width to avoid redundant state changes
-static float g_current_line_width = 1.0f;
+// ============================================================================
+// FRAME BATCHING
+// ============================================================================
+// draw_vertices() no longer draws. Every submission is appended to one
+// frame-wide stream of PackedVertex and turned into indexed triangles or
+// points, so strips, fans and loops can share a draw with plain lists.
+// Callers that already share vertices can pass their own indices with
+// draw_packed_indexed().
+// Lines never reach GL as lines: gl_stroke_path() expands them into
+// triangles with mitred joins and an edge distance per vertex, and the
+// fragment shader turns that into a one-pixel anti-aliased edge. Core
+// profiles clamp glLineWidth to 1 and LINE_SMOOTH/MULTISAMPLE are slow or
+// broken on the small GPUs, so this looks the same everywhere, and the
+// width travels with the vertices instead of splitting batches.
+// Consecutive submissions with the same primitive class and blend mode
+// extend the same batch. gl_flush_batches() uploads the stream once and
+// issues one glDrawElements per batch, in submission order, so
+// overlapping shapes still paint in the order they were drawn.
+//
+// Blend mode is part of the batch key, so it must be set through
+// gl_set_blend_mode() - a direct glBlendFunc() would apply to whatever
+// batch happens to be drawn next.
+//
+// Sprites (gl_draw_sprite) ride in the same batch list: consecutive
+// sprites become one instanced draw with the sprite shader, in order
+// with the geometry around them.
+
+static_assert(sizeof(PackedVertex) == 16, "PackedVertex must stay 16 bytes");
+
+typedef enum {
+    BATCH_GEOMETRY = 0,
+    BATCH_SPRITES,
+    BATCH_GLYPHS,
+    BATCH_MESHES
+} GLBatchKind;
+
+typedef struct {
+    GLBatchKind kind;
+    GLenum mode;            // GL_TRIANGLES or GL_POINTS
+    GLBlendMode blend;
+    int first_index;        // Sprites/glyphs/meshes: first instance
+    int index_count;        // Sprites/glyphs/meshes: instance count
+    GLuint texture;         // Glyphs: coverage texture
+    int mesh;               // Meshes: GLMeshId
+} GLBatch;
+
+// Sprite instance (36 bytes). The quad, the shape edge, the trail and the
+// fade are all generated by the sprite shaders.
+typedef struct {
+    float x, y;
+    float trail_x, trail_y; // Head minus tail of the trail; 0,0 = no trail
+                            // Arcs: start angle and sweep instead
+    float size;             // Radius in pixels
+    float age;              // 0 = new, 1 = expired; alpha fades with it
+    float shape;            // SpriteShape
+    float thickness;        // Rings and arcs: stroke width in pixels
+    PackedColor color;
+} SpriteInstance;
+
+// Mesh instance (20 bytes) - see GLMeshId
+typedef struct {
+    float x, y;
+    float angle;            // Radians
+    float scale;
+    PackedColor tint;
+} MeshInstance;
+
+// A baked mesh: a triangle list range in the static mesh buffer
+typedef struct {
+    int first;
+    int count;
+} GLMesh;
+
+static std::vector<PackedVertex> g_frame_verts;
+static std::vector<GLuint> g_frame_indices;
+static std::vector<SpriteInstance> g_frame_sprites;
+static std::vector<GlyphInstance> g_frame_glyphs;
+static std::vector<MeshInstance> g_frame_meshes;
+static std::vector<GLBatch> g_batches;
+
+// Geometry tessellated away from the frame stream - a slice of a draw
+// list replayed on a worker (see drawlist_replay_gl). Holds the
+// submissions gl_batch_append() would have made, each submission's
+// indices relative to its own first vertex.
+typedef struct {
+    GLenum prim;
+    int vertex_count;
+    int index_count;
+    int cmd;                // Draw list command that made it
+} GLTessSubmission;
+
+typedef struct {
+    std::vector<PackedVertex> verts;
+    std::vector<GLuint> indices;
+    std::vector<GLTessSubmission> submissions;
+    int cmd;                // Command being tessellated
+} GLTessSegment;
+
+static thread_local GLTessSegment *g_tess_segment;     // Set while this thread fills one
+
+static struct {
+    GLuint program;
+    GLuint vao;
+    GLint proj_loc;
+    GLStreamBuffer instances;
+    bool ready;
+} g_sprite_gl;
+
+static struct {
+    GLuint program;
+    GLuint vao;
+    GLint proj_loc;
+    GLint atlas_loc;
+    GLStreamBuffer instances;
+    bool ready;
+} g_glyph_gl;
+
+static struct {
+    GLuint program;
+    GLuint vao;
+    GLuint buffer;          // Every baked mesh, PackedVertex triangle lists
+    GLint proj_loc;
+    GLStreamBuffer instances;
+    GLMesh meshes[MESH_COUNT];
+    std::vector<PackedVertex> vertices;     // CPU copy for the fallback
+    bool capturing;         // Baking - draws are recorded, not queued
+    bool ready;
+} g_mesh_gl;
+
+static float g_line_width = 1.0f;
+static GLBlendMode g_blend_mode = BLEND_ALPHA;
+
+static GLFrameStats g_frame_stats;
+static GLFrameStats g_last_frame_stats;
+
+void gl_set_line_width(float width) {
+    g_line_width = width;
+}
+
+void gl_set_blend_mode(GLBlendMode mode) {
+    g_blend_mode = mode;
+}
+
+// Instance attributes live at locations 2-4 for every instanced shader.
+// Without VAOs (Android) attribute state is global, so they are switched
+// off again after each instanced draw.
+static void gl_instance_arrays(bool enable) {
+    for (int i = 2; i <= 4; i++) {
+        if (enable) {
+            glEnableVertexAttribArray(i);
+            glVertexAttribDivisor(i, 1);
+        } else {
+            glVertexAttribDivisor(i, 0);
+            glDisableVertexAttribArray(i);
+        }
+    }
+}
+
+// Point locations 0, 1 and 5 at PackedVertex data starting at 'offset'
+// in 'buffer'
+static void gl_packed_vertex_arrays(GLuint buffer, GLintptr offset) {
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(PackedVertex),
+                          (void*)(offset + offsetof(PackedVertex, x)));
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(PackedVertex),
+                          (void*)(offset + offsetof(PackedVertex, color)));
+    glVertexAttribPointer(5, 2, GL_SHORT, GL_FALSE, sizeof(PackedVertex),
+                          (void*)(offset + offsetof(PackedVertex, edge)));
+}
 
-static void gl_set_line_width_cached(float width) {
-    if (width != g_current_line_width) {
-        glLineWidth(width);
-        g_current_line_width = width;
+static void gl_apply_blend_mode(GLBlendMode mode) {
+    glEnable(GL_BLEND);
+    if (mode == BLEND_ADDITIVE) {
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+    } else {
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     }
 }
 
 // Shader sources
+// Colour arrives as normalised RGBA8 from PackedVertex, so the shaders
+// still see a vec4 in 0..1. The edge attribute sits at location 5, clear
+// of the instance attributes (2-4), because without VAOs (Android) it
+// stays enabled across instanced draws.
 #ifndef ANDROID
 // Desktop OpenGL 3.3+
 static const char *vertex_shader = 
     "#version 330 core\n"
     "layout(location = 0) in vec2 position;\n"
     "layout(location = 1) in vec4 color;\n"
+    "layout(location = 5) in vec2 edge;\n"
     "uniform mat4 projection;\n"
     "out vec4 vertexColor;\n"
+    "out vec2 vertexEdge;\n"
     "void main() {\n"
-    "    gl_Position = projection * vec4(position, 0.0, 1.0);\n"
+    "    gl_Position = VIEW_TRANSFORM(projection * vec4(position, 0.0, 1.0));\n"
     "    vertexColor = color;\n"
+    "    vertexEdge = edge * (1.0 / 16.0);\n"
     "}\n";
 
+// vertexEdge.y is the stroke's half width, negative for a hard edge
+// (anti-aliasing off); fills leave it at 0. Anti-aliased strokes fade
+// over their last pixel, hard ones cut off at the half width.
 static const char *fragment_shader =
     "#version 330 core\n"
     "in vec4 vertexColor;\n"
+    "in vec2 vertexEdge;\n"
     "out vec4 FragColor;\n"
     "void main() {\n"
-    "    FragColor = vertexColor;\n"
+    "    float half_width = abs(vertexEdge.y);\n"
+    "    float coverage = vertexEdge.y > 0.0 ? clamp(half_width + 0.5 - abs(vertexEdge.x), 0.0, 1.0)\n"
+    "                   : vertexEdge.y < 0.0 ? step(abs(vertexEdge.x), half_width) : 1.0;\n"
+    "    FragColor = vec4(vertexColor.rgb, vertexColor.a * coverage);\n"
     "}\n";
 
 #else
 // OpenGL ES 3.0+ (Android)
 static const char *vertex_shader = 
     "#version 300 es\n"
-    "precision mediump float;\n"
+    "precision highp float;\n"
     "layout(location = 0) in vec2 position;\n"
-    "layout(location = 1) in vec4 color;\n"
+    "layout(location = 1) in lowp vec4 color;\n"
+    "layout(location = 5) in vec2 edge;\n"
     "uniform mat4 projection;\n"
-    "out vec4 vertexColor;\n"
+    "out lowp vec4 vertexColor;\n"
+    "out vec2 vertexEdge;\n"
     "void main() {\n"
     "    vertexColor = color;\n"
-    "    gl_Position = projection * vec4(position, 0.0, 1.0);\n"
+    "    vertexEdge = edge * (1.0 / 16.0);\n"
+    "    gl_Position = VIEW_TRANSFORM(projection * vec4(position, 0.0, 1.0));\n"
     "}\n";
 
 static const char *fragment_shader =
     "#version 300 es\n"
     "precision mediump float;\n"
+    "in lowp vec4 vertexColor;\n"
+    "in vec2 vertexEdge;\n"
+    "out lowp vec4 FragColor;\n"
+    "void main() {\n"
+    "    float half_width = abs(vertexEdge.y);\n"
+    "    float coverage = vertexEdge.y > 0.0 ? clamp(half_width + 0.5 - abs(vertexEdge.x), 0.0, 1.0)\n"
+    "                   : vertexEdge.y < 0.0 ? step(abs(vertexEdge.x), half_width) : 1.0;\n"
+    "    FragColor = vec4(vertexColor.rgb, vertexColor.a * coverage);\n"
+    "}\n";
+#endif
+
+// Sprite shaders: one instance = a quad around the sprite (vertices 0-5)
+// plus a quad for its trail (vertices 6-11). The fragment shader cuts the
+// shape out of the quad from its distance function with a one-pixel soft
+// edge: disc, diamond, ring, glow (quadratic falloff) or arc (a ring masked
+// by angle, with the ends softened the same way).
+#ifndef ANDROID
+#define SPRITE_SHADER_VERSION "#version 330 core\n"
+#else
+#define SPRITE_SHADER_VERSION "#version 300 es\n" "precision highp float;\n"
+#endif
+
+static const char *sprite_vertex_shader =
+    SPRITE_SHADER_VERSION
+    "layout(location = 2) in vec4 motion;\n"      // x, y, trail x, trail y
+    "layout(location = 3) in vec4 params;\n"      // size, age, shape, thickness
+    "layout(location = 4) in vec4 color;\n"
+    "uniform mat4 projection;\n"
+    "out vec2 localPos;\n"
+    "out vec4 vertexColor;\n"
+    "flat out float spriteSize;\n"
+    "flat out int spriteKind;\n"
+    "flat out vec3 shapeParams;\n"               // thickness, arc start, arc sweep
+    "const vec2 corners[6] = vec2[6](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0),\n"
+    "                                vec2(-1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0));\n"
+    "void main() {\n"
+    "    vec2 corner = corners[gl_VertexID % 6];\n"
+    "    float size = params.x;\n"
+    "    int kind = int(params.z + 0.5);\n"
+    "    vertexColor = vec4(color.rgb, color.a * clamp(1.0 - params.y, 0.0, 1.0));\n"
+    "    spriteSize = size;\n"
+    "    shapeParams = vec3(params.w, motion.zw);\n"
+    "    vec2 pos;\n"
+    "    if (gl_VertexID < 6) {\n"
+    "        spriteKind = kind;\n"
+    "        float extent = size + 1.0;\n"
+    "        if (kind == 3 || kind == 5) extent += params.w * 0.5;\n"
+    "        localPos = corner * extent;\n"
+    "        pos = motion.xy + localPos;\n"
+    "    } else {\n"
+    "        spriteKind = 2;\n"
+    "        localPos = corner;\n"
+    "        float len = length(motion.zw);\n"
+    "        if (len < 0.001 || kind > 2) {\n"
+    "            gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n"   // No trail - clipped
+    "            return;\n"
+    "        }\n"
+    "        vec2 dir = motion.zw / len;\n"
+    "        vec2 side = vec2(-dir.y, dir.x);\n"
+    "        pos = motion.xy - dir * (corner.x + 1.0) * 0.5 * len + side * corner.y * 0.5;\n"
+    "        vertexColor.a *= 0.3;\n"
+    "    }\n"
+    "    gl_Position = VIEW_TRANSFORM(projection * vec4(pos, 0.0, 1.0));\n"
+    "}\n";
+
+static const char *sprite_fragment_shader =
+    SPRITE_SHADER_VERSION
+    "in vec2 localPos;\n"
     "in vec4 vertexColor;\n"
+    "flat in float spriteSize;\n"
+    "flat in int spriteKind;\n"
+    "flat in vec3 shapeParams;\n"
     "out vec4 FragColor;\n"
     "void main() {\n"
-    "    FragColor = vertexColor;\n"
+    "    float coverage = 1.0;\n"
+    "    float dist = length(localPos);\n"
+    "    if (spriteKind == 0) {\n"
+    "        coverage = clamp(spriteSize - dist + 0.5, 0.0, 1.0);\n"
+    "    } else if (spriteKind == 1) {\n"
+    "        float d = abs(localPos.x) + abs(localPos.y);\n"
+    "        coverage = clamp((spriteSize - d) * 0.7071 + 0.5, 0.0, 1.0);\n"
+    "    } else if (spriteKind == 3 || spriteKind == 5) {\n"
+    "        coverage = clamp(shapeParams.x * 0.5 - abs(dist - spriteSize) + 0.5, 0.0, 1.0);\n"
+    "        if (spriteKind == 5 && shapeParams.z < 6.2831853) {\n"
+    // Angle past the start, then pixels inside (+) or outside (-) the
+    // nearer end of the arc at this radius
+    "            float rel = mod(atan(localPos.y, localPos.x) - shapeParams.y, 6.2831853);\n"
+    "            float inside = rel <= shapeParams.z ? min(rel, shapeParams.z - rel)\n"
+    "                                                 : -min(rel - shapeParams.z, 6.2831853 - rel);\n"
+    "            coverage *= clamp(inside * dist + 0.5, 0.0, 1.0);\n"
+    "        }\n"
+    "    } else if (spriteKind == 4) {\n"
+    "        float falloff = clamp(1.0 - dist / spriteSize, 0.0, 1.0);\n"
+    "        coverage = falloff * falloff;\n"
+    "    }\n"
+    "    if (coverage <= 0.0) discard;\n"
+    "    FragColor = vec4(vertexColor.rgb, vertexColor.a * coverage);\n"
+    "}\n";
+
+// Glyph shaders: one instance = one quad textured from the glyph atlas,
+// which holds coverage in the red channel
+static const char *glyph_vertex_shader =
+    SPRITE_SHADER_VERSION
+    "layout(location = 2) in vec4 rect;\n"        // x, y, width, height
+    "layout(location = 3) in vec4 uvRect;\n"      // u0, v0, u1, v1
+    "layout(location = 4) in vec4 color;\n"
+    "uniform mat4 projection;\n"
+    "out vec2 uv;\n"
+    "out vec4 vertexColor;\n"
+    "const vec2 corners[6] = vec2[6](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0),\n"
+    "                                vec2(0.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));\n"
+    "void main() {\n"
+    "    vec2 corner = corners[gl_VertexID];\n"
+    "    uv = mix(uvRect.xy, uvRect.zw, corner);\n"
+    "    vertexColor = color;\n"
+    "    gl_Position = VIEW_TRANSFORM(projection * vec4(rect.xy + rect.zw * corner, 0.0, 1.0));\n"
+    "}\n";
+
+static const char *glyph_fragment_shader =
+    SPRITE_SHADER_VERSION
+    "in vec2 uv;\n"
+    "in vec4 vertexColor;\n"
+    "uniform sampler2D atlas;\n"
+    "out vec4 FragColor;\n"
+    "void main() {\n"
+    "    float coverage = texture(atlas, uv).r;\n"
+    "    FragColor = vec4(vertexColor.rgb, vertexColor.a * coverage);\n"
+    "}\n";
+
+// Mesh shader: the baked vertex (PackedVertex, same locations as the
+// batch stream) placed by its instance; drawn with fragment_shader
+static const char *mesh_vertex_shader =
+    SPRITE_SHADER_VERSION
+    "layout(location = 0) in vec2 position;\n"
+    "layout(location = 1) in vec4 color;\n"
+    "layout(location = 5) in vec2 edge;\n"
+    "layout(location = 2) in vec2 origin;\n"
+    "layout(location = 3) in vec2 placement;\n"  // angle, scale
+    "layout(location = 4) in vec4 tint;\n"
+    "uniform mat4 projection;\n"
+    "out vec4 vertexColor;\n"
+    "out vec2 vertexEdge;\n"
+    "void main() {\n"
+    "    float c = cos(placement.x) * placement.y;\n"
+    "    float s = sin(placement.x) * placement.y;\n"
+    "    vec2 p = vec2(position.x * c - position.y * s, position.x * s + position.y * c);\n"
+    "    vertexColor = color * tint;\n"
+    "    vertexEdge = edge * (placement.y / 16.0);\n"
+    "    gl_Position = VIEW_TRANSFORM(projection * vec4(origin + p, 0.0, 1.0));\n"
     "}\n";
-#endif
 
+// Vertex shaders write gl_Position through VIEW_TRANSFORM(). The prelude
+// goes in after the #version line: an identity for ordinary programs,
+// the per-view transform for the two-view twins (see MULTIVIEW below).
+static const char *single_view_prelude =
+    "#define VIEW_TRANSFORM(p) (p)\n";
 
-static GLuint compile_shader(const char *src, GLenum type) {
+static const char *multiview_prelude =
+    "#extension GL_OVR_multiview2 : require\n"
+    "layout(num_views = 2) in;\n"
+    "uniform mat4 viewTransform[2];\n"
+    "#define VIEW_TRANSFORM(p) (viewTransform[gl_ViewID_OVR] * (p))\n";
+
+static GLuint compile_shader(const char *src, GLenum type, int views) {
     const char *type_str = (type == GL_VERTEX_SHADER) ? "VERTEX" : "FRAGMENT";
     GLuint shader = glCreateShader(type);
     
@@ -119,7 +465,15 @@ static GLuint compile_shader(const char *src, GLenum type) {
         return 0;
     }
     
-    glShaderSource(shader, 1, &src, NULL);
+    if (type == GL_VERTEX_SHADER) {
+        const char *body = strchr(src, '\n');
+        body = body ? body + 1 : src;
+        const char *parts[3] = { src, views > 1 ? multiview_prelude : single_view_prelude, body };
+        GLint lengths[3] = { (GLint)(body - src), -1, -1 };
+        glShaderSource(shader, 3, parts, lengths);
+    } else {
+        glShaderSource(shader, 1, &src, NULL);
+    }
     glCompileShader(shader);
     
     int success;
@@ -135,9 +489,12 @@ static GLuint compile_shader(const char *src, GLenum type) {
     return shader;
 }
 
-static GLuint create_program(const char *vs_src, const char *fs_src) {
-    GLuint vs = compile_shader(vs_src, GL_VERTEX_SHADER);
-    GLuint fs = compile_shader(fs_src, GL_FRAGMENT_SHADER);
+// 'feedback' names the vertex shader outputs captured by transform
+// feedback (interleaved); NULL for ordinary programs
+static GLuint link_program(const char *vs_src, const char *fs_src,
+                           const char **feedback, int feedback_count, int views) {
+    GLuint vs = compile_shader(vs_src, GL_VERTEX_SHADER, views);
+    GLuint fs = compile_shader(fs_src, GL_FRAGMENT_SHADER, views);
     
     if (!vs || !fs) {
         SDL_Log("[Comet Busters] [GL] CRITICAL: Shader compilation failed\n");
@@ -156,6 +513,9 @@ static GLuint create_program(const char *vs_src, const char *fs_src) {
     
     glAttachShader(prog, vs);
     glAttachShader(prog, fs);
+    if (feedback) {
+        glTransformFeedbackVaryings(prog, feedback_count, feedback, GL_INTERLEAVED_ATTRIBS);
+    }
     glLinkProgram(prog);
     
     int success;
@@ -175,6 +535,235 @@ static GLuint create_program(const char *vs_src, const char *fs_src) {
     return prog;
 }
 
+// ============================================================================
+// MULTIVIEW (SINGLE-PASS STEREO)
+// ============================================================================
+// With OVR_multiview2 both eyes are layers of one texture array and each
+// draw writes both: the vertex shader runs once per view and picks that
+// view's transform by gl_ViewID_OVR, so the frame is walked, batched and
+// uploaded once instead of once per eye.
+//
+// A program declaring num_views = 2 may only draw into a two-view
+// framebuffer, so every drawing program keeps its single-view version for
+// the flat screen and offscreen passes (text panels, particle feedback)
+// and gets a two-view twin from the same sources, built the first time a
+// multiview target is bound. gl_use_draw_program() picks the right one.
+//
+// View transforms apply after the 2D projection (clip space of the flat
+// screen -> clip space of each eye). Single-view programs fold view 0
+// into the projection, so rendering the eyes one at a time gives the same
+// pictures as one multiview pass.
+
+#define GL_MULTIVIEW_PROGRAMS 8
+#define GL_MULTIVIEW_UNIFORMS 8
+
+typedef struct {
+    GLuint program;             // Single-view program
+    const char *vs_src;
+    const char *fs_src;
+    GLuint twin;                // Two-view version, 0 until built
+    GLint twin_proj_loc;
+    GLint twin_view_loc;
+    int uniform_count;          // Other uniforms: single-view -> twin location
+    GLint uniforms[GL_MULTIVIEW_UNIFORMS][2];
+} GLMultiviewProgram;
+
+static struct {
+    GLMultiviewProgram programs[GL_MULTIVIEW_PROGRAMS];
+    int program_count;
+    bool twins_built;
+    bool twins_failed;
+    bool active;                // Drawing into a two-view framebuffer
+    GLuint fbo;
+    int view_count;             // View transforms set (0 = flat screen)
+    Mat4 views[2];
+    const GLMultiviewProgram *bound;
+} g_multiview;
+
+static Mat4 mat4_multiply(const Mat4 *a, const Mat4 *b) {
+    Mat4 r;
+    for (int col = 0; col < 4; col++) {
+        for (int row = 0; row < 4; row++) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; k++) {
+                sum += a->m[k * 4 + row] * b->m[col * 4 + k];
+            }
+            r.m[col * 4 + row] = sum;
+        }
+    }
+    return r;
+}
+
+static GLuint create_program(const char *vs_src, const char *fs_src) {
+    GLuint program = link_program(vs_src, fs_src, NULL, 0, 1);
+    if (program && g_multiview.program_count < GL_MULTIVIEW_PROGRAMS) {
+        GLMultiviewProgram *entry = &g_multiview.programs[g_multiview.program_count++];
+        memset(entry, 0, sizeof(*entry));
+        entry->program = program;
+        entry->vs_src = vs_src;
+        entry->fs_src = fs_src;
+    }
+    return program;
+}
+
+static bool gl_multiview_build_twin(GLMultiviewProgram *entry) {
+    entry->twin = link_program(entry->vs_src, entry->fs_src, NULL, 0, 2);
+    if (!entry->twin) return false;
+
+    entry->twin_proj_loc = glGetUniformLocation(entry->twin, "projection");
+    entry->twin_view_loc = glGetUniformLocation(entry->twin, "viewTransform");
+
+    // Callers cache locations from the single-view program - map the rest
+    // (samplers, outline width) onto the twin
+    GLint active = 0;
+    glGetProgramiv(entry->program, GL_ACTIVE_UNIFORMS, &active);
+    for (GLint i = 0; i < active && entry->uniform_count < GL_MULTIVIEW_UNIFORMS; i++) {
+        char name[64];
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(entry->program, (GLuint)i, sizeof(name), NULL, &size, &type, name);
+        if (strcmp(name, "projection") == 0) continue;
+        GLint single_loc = glGetUniformLocation(entry->program, name);
+        if (single_loc < 0) continue;
+        entry->uniforms[entry->uniform_count][0] = single_loc;
+        entry->uniforms[entry->uniform_count][1] = glGetUniformLocation(entry->twin, name);
+        entry->uniform_count++;
+    }
+    return true;
+}
+
+static bool gl_multiview_build_twins(void) {
+    if (g_multiview.twins_built) return true;
+    if (g_multiview.twins_failed) return false;
+
+    for (int i = 0; i < g_multiview.program_count; i++) {
+        if (!gl_multiview_build_twin(&g_multiview.programs[i])) {
+            SDL_Log("[Comet Busters] [GL] Multiview shaders failed, rendering eyes one at a time\n");
+            for (int j = 0; j <= i; j++) {
+                if (g_multiview.programs[j].twin) glDeleteProgram(g_multiview.programs[j].twin);
+                g_multiview.programs[j].twin = 0;
+                g_multiview.programs[j].uniform_count = 0;
+            }
+            g_multiview.twins_failed = true;
+            return false;
+        }
+    }
+    g_multiview.twins_built = true;
+    SDL_Log("[Comet Busters] [GL] Multiview: %d two-view programs built\n", g_multiview.program_count);
+    return true;
+}
+
+// Bind 'program' (or its twin inside a multiview pass) with the current
+// projection and view transforms
+static void gl_use_draw_program(GLuint program, GLint proj_loc) {
+    g_multiview.bound = NULL;
+
+    if (g_multiview.active) {
+        for (int i = 0; i < g_multiview.program_count; i++) {
+            const GLMultiviewProgram *entry = &g_multiview.programs[i];
+            if (entry->program != program) continue;
+            glUseProgram(entry->twin);
+            glUniformMatrix4fv(entry->twin_proj_loc, 1, GL_FALSE, gl_state.projection.m);
+            glUniformMatrix4fv(entry->twin_view_loc, 2, GL_FALSE, g_multiview.views[0].m);
+            g_multiview.bound = entry;
+            return;
+        }
+    }
+
+    glUseProgram(program);
+    if (g_multiview.view_count > 0 && !g_multiview.active) {
+        Mat4 projection = mat4_multiply(&g_multiview.views[0], &gl_state.projection);
+        glUniformMatrix4fv(proj_loc, 1, GL_FALSE, projection.m);
+    } else {
+        glUniformMatrix4fv(proj_loc, 1, GL_FALSE, gl_state.projection.m);
+    }
+}
+
+// Location of a uniform of the program last bound by gl_use_draw_program(),
+// given its location in the single-view program
+static GLint gl_draw_uniform(GLint loc) {
+    const GLMultiviewProgram *entry = g_multiview.bound;
+    if (!entry || loc < 0) return loc;
+    for (int i = 0; i < entry->uniform_count; i++) {
+        if (entry->uniforms[i][0] == loc) return entry->uniforms[i][1];
+    }
+    return -1;
+}
+
+bool gl_multiview_supported(void) {
+#ifdef ANDROID
+    // The OpenXR front-end is desktop-only
+    return false;
+#else
+    return GLEW_OVR_multiview2 != 0;
+#endif
+}
+
+void gl_set_view_transforms(const float *views, int count) {
+    gl_flush_batches();
+    if (!views || count <= 0) {
+        g_multiview.view_count = 0;
+        g_multiview.views[0] = g_multiview.views[1] = mat4_identity();
+        return;
+    }
+    if (count > 2) count = 2;
+    memcpy(g_multiview.views, views, count * sizeof(Mat4));
+    if (count == 1) g_multiview.views[1] = g_multiview.views[0];
+    g_multiview.view_count = count;
+}
+
+bool gl_begin_multiview(GLuint fbo) {
+    if (!gl_multiview_supported() || !gl_state.program) return false;
+
+    gl_flush_batches();
+    if (!gl_multiview_build_twins()) return false;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    g_multiview.fbo = fbo;
+    g_multiview.active = true;
+    return true;
+}
+
+void gl_end_multiview(void) {
+    if (!g_multiview.active) return;
+    gl_flush_batches();
+    g_multiview.active = false;
+    g_multiview.bound = NULL;
+}
+
+static void gl_comets_init(void);
+static void gl_gpu_particles_init(void);
+static void gl_meshes_init(void);
+
+static void gl_sprites_init(void) {
+    memset(&g_sprite_gl, 0, sizeof(g_sprite_gl));
+
+    g_sprite_gl.program = create_program(sprite_vertex_shader, sprite_fragment_shader);
+    if (!g_sprite_gl.program) {
+        SDL_Log("[Comet Busters] [GL] Sprite shader failed, drawing sprites as geometry\n");
+        return;
+    }
+    g_sprite_gl.proj_loc = glGetUniformLocation(g_sprite_gl.program, "projection");
+    gl_stream_init(&g_sprite_gl.instances, GL_ARRAY_BUFFER, 64 * 1024, "Sprite instance");
+    glGenVertexArrays(1, &g_sprite_gl.vao);
+    g_sprite_gl.ready = true;
+}
+
+static void gl_glyphs_init(void) {
+    memset(&g_glyph_gl, 0, sizeof(g_glyph_gl));
+
+    g_glyph_gl.program = create_program(glyph_vertex_shader, glyph_fragment_shader);
+    if (!g_glyph_gl.program) {
+        SDL_Log("[Comet Busters] [GL] Glyph shader failed, drawing text as pixel quads\n");
+        return;
+    }
+    g_glyph_gl.proj_loc = glGetUniformLocation(g_glyph_gl.program, "projection");
+    g_glyph_gl.atlas_loc = glGetUniformLocation(g_glyph_gl.program, "atlas");
+    gl_stream_init(&g_glyph_gl.instances, GL_ARRAY_BUFFER, 32 * 1024, "Glyph instance");
+    glGenVertexArrays(1, &g_glyph_gl.vao);
+    g_glyph_gl.ready = true;
+}
+
 void gl_init(void) {
     if (gl_state.program) return;
     
@@ -191,21 +780,19 @@ void gl_init(void) {
     
     
     glGenVertexArrays(1, &gl_state.vao);
-    glGenBuffers(1, &gl_state.vbo);
-    
     glBindVertexArray(gl_state.vao);
-    glBindBuffer(GL_ARRAY_BUFFER, gl_state.vbo);
-    glBufferData(GL_ARRAY_BUFFER, MAX_VERTS * sizeof(Vertex), NULL, GL_DYNAMIC_DRAW);
     
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, x));
+    // Attribute pointers are set per flush - they carry the stream offset
     glEnableVertexAttribArray(0);
-    
-    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, r));
     glEnableVertexAttribArray(1);
-    
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glEnableVertexAttribArray(5);
     glBindVertexArray(0);
     
+    // Start at roughly one menu screen; the streams grow to fit the
+    // busiest frame instead of reserving MAX_VERTS up front
+    gl_stream_init(&gl_state.vertices, GL_ARRAY_BUFFER, 256 * 1024, "Vertex");
+    gl_stream_init(&gl_state.indices, GL_ELEMENT_ARRAY_BUFFER, 128 * 1024, "Index");
+    
     gl_state.color[0] = 1.0f;
     gl_state.color[1] = 1.0f;
     gl_state.color[2] = 1.0f;
@@ -218,33 +805,554 @@ void gl_init(void) {
     glUseProgram(0);
     SDL_Log("[Comet Busters] [GL] Cached projection uniform location: %d\n", gl_state.proj_loc);
     
+    gl_comets_init();
+    gl_sprites_init();
+    gl_glyphs_init();
+    gl_meshes_init();
+    gl_gpu_particles_init();
+    
     // Initialize FreeType font system with base64-encoded TTF
     ft_init();
     
     SDL_Log("[Comet Busters] [GL] GL renderer initialized\n");
 }
 
+// Primitive class and index count for 'count' vertices drawn as 'mode'
+static GLenum gl_batch_prim(GLenum mode, int count, int *index_count) {
+    switch (mode) {
+        case GL_TRIANGLES:
+            *index_count = count - count % 3;
+            return GL_TRIANGLES;
+        case GL_TRIANGLE_STRIP:
+        case GL_TRIANGLE_FAN:
+            *index_count = count >= 3 ? (count - 2) * 3 : 0;
+            return GL_TRIANGLES;
+        default:
+            *index_count = count;
+            return GL_POINTS;
+    }
+}
+
+// List indices for 'count' vertices starting at 'base' drawn as 'mode'
+static void gl_batch_mode_indices(GLuint *idx, GLuint base, int count, int index_count, GLenum mode) {
+    switch (mode) {
+        case GL_TRIANGLE_STRIP:
+            for (int i = 0; i + 2 < count; i++) {
+                *idx++ = base + i;
+                *idx++ = base + i + 1;
+                *idx++ = base + i + 2;
+            }
+            break;
+        case GL_TRIANGLE_FAN:
+            for (int i = 1; i + 1 < count; i++) {
+                *idx++ = base;
+                *idx++ = base + i;
+                *idx++ = base + i + 1;
+            }
+            break;
+        default:
+            for (int i = 0; i < index_count; i++) {
+                *idx++ = base + i;
+            }
+            break;
+    }
+}
+
+// Make room for one submission in the frame stream and add it to the
+// current batch (or start a new one). Returns where the vertices go;
+// *indices receives where its index_count indices go and *base the
+// stream index of its first vertex. NULL if it can never fit.
+// While this thread fills a GLTessSegment the submission goes there
+// instead, with *base 0.
+static PackedVertex *gl_batch_append(GLenum prim, int vertex_count, int index_count,
+                                     GLuint **indices, GLuint *base) {
+    if (vertex_count <= 0 || index_count <= 0 ||
+        vertex_count > MAX_VERTS || index_count > MAX_INDICES) {
+        return NULL;
+    }
+
+    if (g_tess_segment) {
+        GLTessSegment *segment = g_tess_segment;
+        size_t first_vertex = segment->verts.size();
+        size_t first_index = segment->indices.size();
+        segment->verts.resize(first_vertex + vertex_count);
+        segment->indices.resize(first_index + index_count);
+        GLTessSubmission submission = { prim, vertex_count, index_count, segment->cmd };
+        segment->submissions.push_back(submission);
+        *indices = &segment->indices[first_index];
+        *base = 0;
+        return &segment->verts[first_vertex];
+    }
+
+    // Stream full - submit what we have and start again
+    if ((int)g_frame_verts.size() + vertex_count > MAX_VERTS ||
+        (int)g_frame_indices.size() + index_count > MAX_INDICES) {
+        gl_flush_batches();
+    }
+
+    int first_vertex = (int)g_frame_verts.size();
+    int first_index = (int)g_frame_indices.size();
+    g_frame_verts.resize(first_vertex + vertex_count);
+    g_frame_indices.resize(first_index + index_count);
+    *indices = &g_frame_indices[first_index];
+    *base = (GLuint)first_vertex;
+
+    g_frame_stats.submissions++;
+
+    bool merged = false;
+    if (!g_batches.empty()) {
+        GLBatch &last = g_batches.back();
+        if (last.kind == BATCH_GEOMETRY && last.mode == prim &&
+            last.blend == g_blend_mode) {
+            last.index_count += index_count;
+            merged = true;
+        }
+    }
+    if (!merged) {
+        GLBatch batch;
+        batch.kind = BATCH_GEOMETRY;
+        batch.mode = prim;
+        batch.blend = g_blend_mode;
+        batch.first_index = first_index;
+        batch.index_count = index_count;
+        batch.texture = 0;
+        batch.mesh = 0;
+        g_batches.push_back(batch);
+    }
+
+    return &g_frame_verts[first_vertex];
+}
+
+// ============================================================================
+// STROKES
+// ============================================================================
+// A stroke is two rows of vertices either side of the path, pushed out by
+// half the width plus GL_STROKE_FRINGE pixels for the edge to fade over.
+// Every vertex carries its distance from the centre line (+reach on one
+// side, -reach on the other) and the half width; the fragment shader
+// fades coverage over the last pixel. When the quality governor turns
+// anti-aliasing off there is no fringe and the half width goes in
+// negated, which tells the shader to cut the edge hard. Joins are mitred, clamped to
+// GL_STROKE_MITER_LIMIT half widths so hairpins do not spike; open ends
+// are butt ends.
+
+#define GL_STROKE_FRINGE 1.0f
+#define GL_STROKE_MITER_LIMIT 4.0f
+#define GL_STROKE_MAX_HALF_WIDTH 2000.0f    // Keeps the reach in a GLshort
+
+static thread_local std::vector<PackedVertex> g_stroke_path;    // Replay tessellates on workers
+static std::vector<PackedVertex> g_stroke_packed;
+
+static bool gl_is_line_mode(GLenum mode) {
+    return mode == GL_LINES || mode == GL_LINE_STRIP || mode == GL_LINE_LOOP;
+}
+
+static bool gl_same_point(const PackedVertex &a, const PackedVertex &b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+// Stroke g_stroke_path and empty it. A path whose last point repeats the
+// first is closed.
+static void gl_stroke_path(bool closed, float width) {
+    std::vector<PackedVertex> &path = g_stroke_path;
+
+    // Repeated points have no direction
+    size_t kept = 0;
+    for (size_t i = 0; i < path.size(); i++) {
+        if (kept == 0 || !gl_same_point(path[i], path[kept - 1])) path[kept++] = path[i];
+    }
+    path.resize(kept);
+    if (path.size() > 2 && gl_same_point(path.front(), path.back())) {
+        path.pop_back();
+        closed = true;
+    }
+
+    int n = (int)path.size();
+    if (n < 2) {
+        path.clear();
+        return;
+    }
+    if (n == 2) closed = false;
+
+    bool antialias = quality_current()->antialias;
+    float half = fminf(fmaxf(width, 0.0f) * 0.5f, GL_STROKE_MAX_HALF_WIDTH);
+    float reach = half + (antialias ? GL_STROKE_FRINGE : 0.0f);
+    GLshort edge_reach = (GLshort)(reach * 16.0f + 0.5f);
+    GLshort edge_half = (GLshort)fmaxf(half * 16.0f + 0.5f, 1.0f);  // 0 would mean "fill"
+    if (!antialias) edge_half = (GLshort)-edge_half;
+
+    int segments = closed ? n : n - 1;
+    GLuint *idx, base;
+    PackedVertex *out = gl_batch_append(GL_TRIANGLES, n * 2, segments * 6, &idx, &base);
+    if (!out) {
+        path.clear();
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        const PackedVertex &p = path[i];
+        const PackedVertex &prev = path[(i + n - 1) % n];
+        const PackedVertex &next = path[(i + 1) % n];
+
+        // Unit directions of the segments either side of this point; an
+        // open end borrows the one it has
+        float in_x = p.x - prev.x, in_y = p.y - prev.y;
+        float out_x = next.x - p.x, out_y = next.y - p.y;
+        if (!closed && i == 0) { in_x = out_x; in_y = out_y; }
+        if (!closed && i == n - 1) { out_x = in_x; out_y = in_y; }
+        float in_len = sqrtf(in_x * in_x + in_y * in_y);
+        float out_len = sqrtf(out_x * out_x + out_y * out_y);
+        in_x /= in_len; in_y /= in_len;
+        out_x /= out_len; out_y /= out_len;
+
+        // Mitre: the average of the two normals, lengthened so the
+        // stroke keeps its width through the corner
+        float nx = -in_y - out_y, ny = in_x + out_x;
+        float n_len = sqrtf(nx * nx + ny * ny);
+        float scale = reach;
+        if (n_len < 1e-4f) {
+            // Full reversal - square across the tip
+            nx = -in_y;
+            ny = in_x;
+        } else {
+            nx /= n_len;
+            ny /= n_len;
+            float cosine = nx * -in_y + ny * in_x;
+            scale = reach / fmaxf(cosine, 1.0f / GL_STROKE_MITER_LIMIT);
+        }
+
+        PackedVertex &left = out[i * 2];
+        PackedVertex &right = out[i * 2 + 1];
+        left.x = p.x + nx * scale;
+        left.y = p.y + ny * scale;
+        left.color = p.color;
+        left.edge[0] = edge_reach;
+        left.edge[1] = edge_half;
+        right.x = p.x - nx * scale;
+        right.y = p.y - ny * scale;
+        right.color = p.color;
+        right.edge[0] = (GLshort)-edge_reach;
+        right.edge[1] = edge_half;
+    }
+
+    for (int s = 0; s < segments; s++) {
+        GLuint a = base + s * 2;
+        GLuint b = base + ((s + 1) % n) * 2;
+        *idx++ = a;
+        *idx++ = a + 1;
+        *idx++ = b;
+        *idx++ = b;
+        *idx++ = a + 1;
+        *idx++ = b + 1;
+    }
+    path.clear();
+}
+
+// Stroke a line-mode submission 'width' pixels wide. Strips and loops are
+// one path each. GL_LINES pairs keep extending one path while
+// each segment starts where the last one ended, so outlines drawn segment
+// by segment still get proper joins. 'indices' may be NULL.
+static void gl_stroke_lines(const PackedVertex *verts, const GLushort *indices, int count, GLenum mode,
+                            float width) {
+    std::vector<PackedVertex> &path = g_stroke_path;
+    path.clear();
+
+    if (mode != GL_LINES) {
+        for (int i = 0; i < count; i++) {
+            path.push_back(verts[indices ? indices[i] : i]);
+        }
+        gl_stroke_path(mode == GL_LINE_LOOP, width);
+        return;
+    }
+
+    for (int i = 0; i + 1 < count; i += 2) {
+        const PackedVertex &a = verts[indices ? indices[i] : i];
+        const PackedVertex &b = verts[indices ? indices[i + 1] : i + 1];
+        if (!path.empty() && !gl_same_point(path.back(), a)) {
+            gl_stroke_path(false, width);
+        }
+        if (path.empty()) path.push_back(a);
+        path.push_back(b);
+    }
+    gl_stroke_path(false, width);
+}
+
 void draw_vertices(Vertex *verts, int count, GLenum mode) {
-    // ✅ PERF FIX #1: Use cached uniform location instead of glGetUniformLocation()
-    // This function is called 300-500 times per frame!
-    // glGetUniformLocation() is an expensive lookup operation
-    glUseProgram(gl_state.program);
-    glUniformMatrix4fv(gl_state.proj_loc, 1, GL_FALSE, gl_state.projection.m);  // Use CACHED location
-    
-    glBindBuffer(GL_ARRAY_BUFFER, gl_state.vbo);
-    
-    // ✅ PERF FIX #2 (Android): Buffer orphaning to avoid GPU stalls
-    // On Android ES, glBufferSubData is expensive. Orphaning tells GPU
-    // we're done with old data and allocate fresh memory instead of waiting.
-    // Desktop GL ignores this redundant call, so no performance regression.
-    #ifdef ANDROID
-    glBufferData(GL_ARRAY_BUFFER, 1000000 * sizeof(Vertex), NULL, GL_DYNAMIC_DRAW);
-    #endif
-    
-    glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(Vertex), verts);
-    
-    glBindVertexArray(gl_state.vao);
-    glDrawArrays(mode, 0, count);
+    if (!verts || count <= 0) return;
+
+    if (gl_is_line_mode(mode)) {
+        g_stroke_packed.resize(count);
+        for (int i = 0; i < count; i++) {
+            PackedVertex &v = g_stroke_packed[i];
+            v.x = verts[i].x;
+            v.y = verts[i].y;
+            v.color = gl_pack_color(verts[i].r, verts[i].g, verts[i].b, verts[i].a);
+            v.edge[0] = v.edge[1] = 0;
+        }
+        gl_stroke_lines(g_stroke_packed.data(), NULL, count, mode, g_line_width);
+        return;
+    }
+
+    int index_count;
+    GLenum prim = gl_batch_prim(mode, count, &index_count);
+    GLuint *idx, base;
+    PackedVertex *out = gl_batch_append(prim, count, index_count, &idx, &base);
+    if (!out) return;
+
+    for (int i = 0; i < count; i++) {
+        out[i].x = verts[i].x;
+        out[i].y = verts[i].y;
+        out[i].color = gl_pack_color(verts[i].r, verts[i].g, verts[i].b, verts[i].a);
+        out[i].edge[0] = out[i].edge[1] = 0;
+    }
+    gl_batch_mode_indices(idx, base, count, index_count, mode);
+}
+
+void draw_packed_vertices(const PackedVertex *verts, int count, GLenum mode) {
+    if (!verts || count <= 0) return;
+
+    if (gl_is_line_mode(mode)) {
+        gl_stroke_lines(verts, NULL, count, mode, g_line_width);
+        return;
+    }
+
+    int index_count;
+    GLenum prim = gl_batch_prim(mode, count, &index_count);
+    GLuint *idx, base;
+    PackedVertex *out = gl_batch_append(prim, count, index_count, &idx, &base);
+    if (!out) return;
+
+    memcpy(out, verts, count * sizeof(PackedVertex));
+    gl_batch_mode_indices(idx, base, count, index_count, mode);
+}
+
+void draw_packed_indexed(const PackedVertex *verts, int count,
+                         const GLushort *indices, int index_count, GLenum mode) {
+    if (!verts || !indices || count <= 0 || index_count <= 0) return;
+
+    if (mode == GL_LINES) {
+        gl_stroke_lines(verts, indices, index_count, mode, g_line_width);
+        return;
+    }
+
+    GLuint *idx, base;
+    PackedVertex *out = gl_batch_append(GL_TRIANGLES, count, index_count, &idx, &base);
+    if (!out) return;
+
+    memcpy(out, verts, count * sizeof(PackedVertex));
+    for (int i = 0; i < index_count; i++) {
+        idx[i] = base + indices[i];
+    }
+}
+
+void gl_flush_batches(void) {
+    if (g_batches.empty()) return;
+
+    // One upload per stream; see GLStreamBuffer for how this avoids stalls
+    GLintptr vertex_offset = 0;
+    GLintptr index_offset = 0;
+    if (!g_frame_verts.empty()) {
+        glBindVertexArray(gl_state.vao);
+        vertex_offset = gl_stream_upload(&gl_state.vertices, g_frame_verts.data(),
+                                         g_frame_verts.size() * sizeof(PackedVertex));
+        gl_packed_vertex_arrays(gl_state.vertices.buffer, vertex_offset);
+
+        // Element buffer binding is VAO state - the upload binds it every
+        // flush so it is right whichever VAO the front-end left bound
+        index_offset = gl_stream_upload(&gl_state.indices, g_frame_indices.data(),
+                                        g_frame_indices.size() * sizeof(GLuint));
+    }
+
+    GLintptr sprite_offset = 0;
+    if (!g_frame_sprites.empty()) {
+        sprite_offset = gl_stream_upload(&g_sprite_gl.instances, g_frame_sprites.data(),
+                                         g_frame_sprites.size() * sizeof(SpriteInstance));
+    }
+
+    GLintptr glyph_offset = 0;
+    if (!g_frame_glyphs.empty()) {
+        glyph_offset = gl_stream_upload(&g_glyph_gl.instances, g_frame_glyphs.data(),
+                                        g_frame_glyphs.size() * sizeof(GlyphInstance));
+    }
+
+    GLintptr mesh_offset = 0;
+    if (!g_frame_meshes.empty()) {
+        mesh_offset = gl_stream_upload(&g_mesh_gl.instances, g_frame_meshes.data(),
+                                       g_frame_meshes.size() * sizeof(MeshInstance));
+    }
+
+    // Front-ends may touch blending between flushes, so start from
+    // unknown state each time
+    int applied_blend = -1;
+    int bound_kind = -1;
+    GLint bound_texture = -1;
+
+    for (size_t i = 0; i < g_batches.size(); i++) {
+        const GLBatch &batch = g_batches[i];
+
+        if ((int)batch.kind != bound_kind) {
+            if (bound_kind == BATCH_SPRITES || bound_kind == BATCH_GLYPHS ||
+                bound_kind == BATCH_MESHES) {
+                gl_instance_arrays(false);
+            }
+            if (batch.kind == BATCH_SPRITES) {
+                gl_use_draw_program(g_sprite_gl.program, g_sprite_gl.proj_loc);
+                glBindVertexArray(g_sprite_gl.vao);
+                gl_instance_arrays(true);
+            } else if (batch.kind == BATCH_GLYPHS) {
+                gl_use_draw_program(g_glyph_gl.program, g_glyph_gl.proj_loc);
+                glUniform1i(gl_draw_uniform(g_glyph_gl.atlas_loc), 0);
+                glActiveTexture(GL_TEXTURE0);
+                bound_texture = -1;
+                glBindVertexArray(g_glyph_gl.vao);
+                gl_instance_arrays(true);
+            } else if (batch.kind == BATCH_MESHES) {
+                gl_use_draw_program(g_mesh_gl.program, g_mesh_gl.proj_loc);
+                glBindVertexArray(g_mesh_gl.vao);
+                gl_packed_vertex_arrays(g_mesh_gl.buffer, 0);
+                gl_instance_arrays(true);
+            } else {
+                // ✅ PERF FIX #1: Use cached uniform location instead of glGetUniformLocation()
+                gl_use_draw_program(gl_state.program, gl_state.proj_loc);
+                glBindVertexArray(gl_state.vao);
+#ifdef ANDROID
+                // No VAOs - a mesh batch may have moved the pointers
+                if (bound_kind == BATCH_MESHES) {
+                    gl_packed_vertex_arrays(gl_state.vertices.buffer, vertex_offset);
+                }
+#endif
+            }
+            bound_kind = (int)batch.kind;
+        }
+
+        if ((int)batch.blend != applied_blend) {
+            gl_apply_blend_mode(batch.blend);
+            applied_blend = (int)batch.blend;
+        }
+
+        if (batch.kind == BATCH_SPRITES) {
+            // No base-instance draws in GLES 3.0 - point the attributes at
+            // the batch's first instance instead
+            GLintptr offset = sprite_offset + batch.first_index * sizeof(SpriteInstance);
+            glBindBuffer(GL_ARRAY_BUFFER, g_sprite_gl.instances.buffer);
+            glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+                                  (void*)(offset + offsetof(SpriteInstance, x)));
+            glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance),
+                                  (void*)(offset + offsetof(SpriteInstance, size)));
+            glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteInstance),
+                                  (void*)(offset + offsetof(SpriteInstance, color)));
+            glDrawArraysInstanced(GL_TRIANGLES, 0, 12, batch.index_count);
+            continue;
+        }
+
+        if (batch.kind == BATCH_MESHES) {
+            const GLMesh &mesh = g_mesh_gl.meshes[batch.mesh];
+            GLintptr offset = mesh_offset + batch.first_index * sizeof(MeshInstance);
+            glBindBuffer(GL_ARRAY_BUFFER, g_mesh_gl.instances.buffer);
+            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(MeshInstance),
+                                  (void*)(offset + offsetof(MeshInstance, x)));
+            glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(MeshInstance),
+                                  (void*)(offset + offsetof(MeshInstance, angle)));
+            glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(MeshInstance),
+                                  (void*)(offset + offsetof(MeshInstance, tint)));
+            glDrawArraysInstanced(GL_TRIANGLES, mesh.first, mesh.count, batch.index_count);
+            continue;
+        }
+
+        if (batch.kind == BATCH_GLYPHS) {
+            if ((GLint)batch.texture != bound_texture) {
+                glBindTexture(GL_TEXTURE_2D, batch.texture);
+                bound_texture = (GLint)batch.texture;
+            }
+            GLintptr offset = glyph_offset + batch.first_index * sizeof(GlyphInstance);
+            glBindBuffer(GL_ARRAY_BUFFER, g_glyph_gl.instances.buffer);
+            glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(GlyphInstance),
+                                  (void*)(offset + offsetof(GlyphInstance, x)));
+            glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(GlyphInstance),
+                                  (void*)(offset + offsetof(GlyphInstance, u0)));
+            glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(GlyphInstance),
+                                  (void*)(offset + offsetof(GlyphInstance, color)));
+            glDrawArraysInstanced(GL_TRIANGLES, 0, 6, batch.index_count);
+            continue;
+        }
+
+        glDrawElements(batch.mode, batch.index_count, GL_UNSIGNED_INT,
+                       (void*)(index_offset + batch.first_index * sizeof(GLuint)));
+    }
+    if (bound_kind == BATCH_SPRITES || bound_kind == BATCH_GLYPHS || bound_kind == BATCH_MESHES) {
+        gl_instance_arrays(false);
+    }
+    if (!g_frame_glyphs.empty()) glBindTexture(GL_TEXTURE_2D, 0);
+
+    g_frame_stats.uploads++;
+    g_frame_stats.draw_calls += (int)g_batches.size();
+    g_frame_stats.vertices += (int)g_frame_verts.size();
+    g_frame_stats.indices += (int)g_frame_indices.size();
+    g_frame_stats.sprites += (int)g_frame_sprites.size();
+    g_frame_stats.glyphs += (int)g_frame_glyphs.size();
+    g_frame_stats.meshes += (int)g_frame_meshes.size();
+
+    g_frame_verts.clear();
+    g_frame_indices.clear();
+    g_frame_sprites.clear();
+    g_frame_glyphs.clear();
+    g_frame_meshes.clear();
+    g_batches.clear();
+}
+
+void gl_end_frame(void) {
+    gl_flush_batches();
+
+    g_frame_stats.upload_bytes += (int)(gl_state.vertices.frame_bytes + gl_state.indices.frame_bytes +
+                                        g_sprite_gl.instances.frame_bytes + g_glyph_gl.instances.frame_bytes +
+                                        g_mesh_gl.instances.frame_bytes);
+    g_frame_stats.stream_waits = gl_state.vertices.waits + gl_state.indices.waits +
+                                 g_sprite_gl.instances.waits + g_glyph_gl.instances.waits +
+                                 g_mesh_gl.instances.waits;
+    gl_state.vertices.waits = 0;
+    gl_state.indices.waits = 0;
+    g_sprite_gl.instances.waits = 0;
+    g_glyph_gl.instances.waits = 0;
+    g_mesh_gl.instances.waits = 0;
+    gl_stream_end_frame(&gl_state.vertices);
+    gl_stream_end_frame(&gl_state.indices);
+    gl_stream_end_frame(&g_sprite_gl.instances);
+    gl_stream_end_frame(&g_glyph_gl.instances);
+    gl_stream_end_frame(&g_mesh_gl.instances);
+
+    g_last_frame_stats = g_frame_stats;
+    memset(&g_frame_stats, 0, sizeof(g_frame_stats));
+
+#ifdef DEBUG
+    // Averages over a few seconds of frames
+    static GLFrameStats totals;
+    static int frames = 0;
+    totals.submissions += g_last_frame_stats.submissions;
+    totals.draw_calls += g_last_frame_stats.draw_calls;
+    totals.uploads += g_last_frame_stats.uploads;
+    totals.upload_bytes += g_last_frame_stats.upload_bytes;
+    totals.vertices += g_last_frame_stats.vertices;
+    totals.indices += g_last_frame_stats.indices;
+    totals.stream_waits += g_last_frame_stats.stream_waits;
+    totals.sprites += g_last_frame_stats.sprites;
+    totals.glyphs += g_last_frame_stats.glyphs;
+    totals.meshes += g_last_frame_stats.meshes;
+    if (++frames >= 300) {
+        SDL_Log("[Comet Busters] [PERF] Per frame: %.1f draw calls, %.1f uploads of %.1f KB (%.0f submissions, %.0f verts, %.0f indices, %.0f sprites, %.0f glyphs, %.0f meshes), %d stream waits\n",
+                totals.draw_calls / (float)frames, totals.uploads / (float)frames,
+                totals.upload_bytes / 1024.0f / frames,
+                totals.submissions / (float)frames, totals.vertices / (float)frames,
+                totals.indices / (float)frames, totals.sprites / (float)frames,
+                totals.glyphs / (float)frames, totals.meshes / (float)frames,
+                totals.stream_waits);
+        memset(&totals, 0, sizeof(totals));
+        frames = 0;
+    }
+#endif
+}
+
+void gl_get_frame_stats(GLFrameStats *stats) {
+    if (stats) *stats = g_last_frame_stats;
 }
 
 // ============================================================================
@@ -269,7 +1377,13 @@ void gl_setup_2d_projection(int width, int height) {
         height = viewport[3] > 0 ? viewport[3] : 1280;
     }
 #endif
-    gl_state.projection = mat4_ortho(0, width, height, 0, -1, 1);
+    Mat4 projection = mat4_ortho(0, width, height, 0, -1, 1);
+    
+    // Batched geometry is drawn with the projection current at flush time
+    if (memcmp(&projection, &gl_state.projection, sizeof(Mat4)) != 0) {
+        gl_flush_batches();
+    }
+    gl_state.projection = projection;
 }
 
 void gl_restore_projection(void) {
@@ -291,7 +1405,7 @@ void gl_set_color_alpha(float r, float g, float b, float a) {
 }
 
 void gl_draw_line(float x1, float y1, float x2, float y2, float width) {
-    glLineWidth(width);
+    gl_set_line_width(width);
     Vertex verts[2] = {
         {x1, y1, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
         {x2, y2, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]}
@@ -300,57 +1414,86 @@ void gl_draw_line(float x1, float y1, float x2, float y2, float width) {
 }
 
 void gl_draw_rect_filled(float x, float y, float width, float height) {
-    Vertex verts[6] = {
-        {x, y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x + width, y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x + width, y + height, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x, y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x + width, y + height, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x, y + height, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]}
+    static const GLushort indices[6] = {0, 1, 2, 0, 2, 3};
+    PackedColor color = gl_current_color_packed();
+    PackedVertex verts[4] = {
+        {x, y, color},
+        {x + width, y, color},
+        {x + width, y + height, color},
+        {x, y + height, color}
     };
-    draw_vertices(verts, 6, GL_TRIANGLES);
+    draw_packed_indexed(verts, 4, indices, 6, GL_TRIANGLES);
 }
 
 void gl_draw_rect_outline(float x, float y, float width, float height, float line_width) {
-    glLineWidth(line_width);
-    Vertex verts[5] = {
-        {x, y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x + width, y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x + width, y + height, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x, y + height, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]},
-        {x, y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]}
+    gl_set_line_width(line_width);
+    PackedColor color = gl_current_color_packed();
+    PackedVertex verts[4] = {
+        {x, y, color},
+        {x + width, y, color},
+        {x + width, y + height, color},
+        {x, y + height, color}
     };
-    draw_vertices(verts, 5, GL_LINE_STRIP);
+    draw_packed_vertices(verts, 4, GL_LINE_LOOP);
 }
 
+// Circles up to this many segments build their rim on the stack
+#define GL_CIRCLE_STACK_SEGMENTS 128
+
+// Rim points for a circle: segments + 1 x,y pairs, closed on the first point.
+// Returns 'stack_xy' when it is big enough, otherwise a malloc'd buffer.
+static float *gl_circle_rim(float cx, float cy, float radius, int segments, float *stack_xy) {
+    float *xy = segments <= GL_CIRCLE_STACK_SEGMENTS ? stack_xy
+                                                     : (float *)malloc((segments + 1) * 2 * sizeof(float));
+    fm_circle_points(cx, cy, radius, segments, xy);
+    return xy;
+}
+
+// 'segments' only matters for the tessellated fallback when the sprite
+// shader is unavailable
 void gl_draw_circle(float cx, float cy, float radius, int segments) {
-    Vertex *verts = (Vertex *)malloc((segments + 2) * sizeof(Vertex));
-    verts[0] = (Vertex){cx, cy, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]};
+    if (segments <= 0) return;
+    if (g_sprite_gl.ready && !g_mesh_gl.capturing) {
+        gl_draw_disc(cx, cy, radius);
+        return;
+    }
+    float stack_xy[(GL_CIRCLE_STACK_SEGMENTS + 1) * 2];
+    float *xy = gl_circle_rim(cx, cy, radius, segments, stack_xy);
+
+    PackedColor color = gl_current_color_packed();
+    PackedVertex *verts = (PackedVertex *)malloc((segments + 2) * sizeof(PackedVertex));
+    verts[0] = (PackedVertex){cx, cy, color};
     
     for (int i = 0; i <= segments; i++) {
-        float angle = 2.0f * M_PI * i / segments;
-        float x = cx + radius * cosf(angle);
-        float y = cy + radius * sinf(angle);
-        verts[i+1] = (Vertex){x, y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]};
+        verts[i+1] = (PackedVertex){xy[i*2], xy[i*2+1], color};
     }
     
-    draw_vertices(verts, segments + 2, GL_TRIANGLE_FAN);
+    draw_packed_vertices(verts, segments + 2, GL_TRIANGLE_FAN);
     free(verts);
+    if (xy != stack_xy) free(xy);
 }
 
 void gl_draw_circle_outline(float cx, float cy, float radius, float line_width, int segments) {
-    glLineWidth(line_width);
-    Vertex *verts = (Vertex *)malloc((segments + 1) * sizeof(Vertex));
+    if (segments <= 0) return;
+    if (g_sprite_gl.ready && !g_mesh_gl.capturing) {
+        gl_draw_ring(cx, cy, radius, line_width);
+        return;
+    }
+    gl_set_line_width(line_width);
+    float stack_xy[(GL_CIRCLE_STACK_SEGMENTS + 1) * 2];
+    float *xy = gl_circle_rim(cx, cy, radius, segments, stack_xy);
+
+    // The rim's closing point repeats the first one - a loop closes itself
+    PackedColor color = gl_current_color_packed();
+    PackedVertex *verts = (PackedVertex *)malloc(segments * sizeof(PackedVertex));
     
-    for (int i = 0; i <= segments; i++) {
-        float angle = 2.0f * M_PI * i / segments;
-        float x = cx + radius * cosf(angle);
-        float y = cy + radius * sinf(angle);
-        verts[i] = (Vertex){x, y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]};
+    for (int i = 0; i < segments; i++) {
+        verts[i] = (PackedVertex){xy[i*2], xy[i*2+1], color};
     }
     
-    draw_vertices(verts, segments + 1, GL_LINE_STRIP);
+    draw_packed_vertices(verts, segments, GL_LINE_LOOP);
     free(verts);
+    if (xy != stack_xy) free(xy);
 }
 
 void gl_draw_polygon(float *points, int num_points, int filled) {
@@ -363,7 +1506,7 @@ void gl_draw_polygon(float *points, int num_points, int filled) {
 }
 
 void gl_draw_polyline(float *points, int num_points, float line_width) {
-    glLineWidth(line_width);
+    gl_set_line_width(line_width);
     Vertex *verts = (Vertex *)malloc(num_points * sizeof(Vertex));
     for (int i = 0; i < num_points; i++) {
         verts[i] = (Vertex){points[i*2], points[i*2+1], gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]};
@@ -372,2170 +1515,2002 @@ void gl_draw_polyline(float *points, int num_points, float line_width) {
     free(verts);
 }
 
-// Generate seed-based pseudo-random value for deterministic asteroid shapes
-static float comet_random_jagged(int seed, int index) {
-    int x = seed * 73856093 ^ (index * 19349663);
-    return (float)((x * 2654435761U) % 1000) / 1000.0f;
+// Fallback tessellation for the SDF shapes: about one segment per two
+// pixels of radius
+static int gl_sdf_segments(float radius) {
+    int segments = (int)(radius * 0.5f);
+    return segments < 12 ? 12 : (segments > 64 ? 64 : segments);
 }
 
-// Generate random jagged asteroid points for more variation
-static void generate_jagged_asteroid_points(double points[][2], int num_points, double radius, int seed) {
-    for (int i = 0; i < num_points; i++) {
-        double angle = 2.0 * M_PI * i / num_points;
-        
-        // Base radius with random jagger (use seed for determinism)
-        float jagged = 0.6f + 0.4f * comet_random_jagged(seed, i);
-        double point_radius = radius * jagged;
-        
-        // Random angle offset for more irregular shape
-        float angle_offset = (comet_random_jagged(seed + 1, i) - 0.5f) * 0.5f;  // ±0.25 rad variation
-        
-        points[i][0] = point_radius * cos(angle + angle_offset);
-        points[i][1] = point_radius * sin(angle + angle_offset);
+// Geometry for one sprite, used when the sprite shader is unavailable
+static void gl_draw_sprite_geometry(const SpriteInstance *sprite) {
+    float r = sprite->color.r / 255.0f;
+    float g = sprite->color.g / 255.0f;
+    float b = sprite->color.b / 255.0f;
+    float a = sprite->color.a / 255.0f * (1.0f - sprite->age);
+
+    gl_set_color_alpha(r, g, b, a);
+    if (sprite->shape == SPRITE_RING) {
+        gl_draw_circle_outline(sprite->x, sprite->y, sprite->size, sprite->thickness,
+                               gl_sdf_segments(sprite->size));
+        return;
+    }
+    if (sprite->shape == SPRITE_GLOW) {
+        // Two flat layers stand in for the falloff
+        gl_set_color_alpha(r, g, b, a * 0.25f);
+        gl_draw_circle(sprite->x, sprite->y, sprite->size, gl_sdf_segments(sprite->size));
+        gl_draw_circle(sprite->x, sprite->y, sprite->size * 0.5f, gl_sdf_segments(sprite->size * 0.5f));
+        return;
+    }
+    if (sprite->shape == SPRITE_ARC) {
+        float sweep = fminf(sprite->trail_y, 2.0f * (float)M_PI);
+        int segments = (int)(gl_sdf_segments(sprite->size) * sweep / (2.0f * (float)M_PI)) + 1;
+        float points[(64 + 2) * 2];
+        for (int i = 0; i <= segments; i++) {
+            double s, c;
+            fm_sincos(sprite->trail_x + sweep * i / segments, &s, &c);
+            points[i * 2] = sprite->x + sprite->size * (float)c;
+            points[i * 2 + 1] = sprite->y + sprite->size * (float)s;
+        }
+        gl_draw_polyline(points, segments + 1, sprite->thickness);
+        return;
     }
-}
 
-// Helper to draw transformed polygon outline for comets with enhanced tumbling
-static void draw_comet_polygon(Comet *c, double points[][2], int num_points, float line_width) {
-    if (!c) return;
-    
-    // Allocate for points + closing point
-    Vertex *verts = (Vertex *)malloc((num_points + 1) * sizeof(Vertex));
-    
-    // PRIMARY rotation (main tumble)
-    float angle = c->base_angle + c->rotation * M_PI / 180.0f;
-    float cos_a = cosf(angle);
-    float sin_a = sinf(angle);
-    
-    // SECONDARY rotation (tumble in perpendicular direction for more dynamic rotation)
-    // This creates the illusion of tumbling/spinning in 3D space
-    float secondary_rotation = (c->rotation * 0.7f) * M_PI / 180.0f;
-    float cos_sec = cosf(secondary_rotation);
-    float sin_sec = sinf(secondary_rotation);
-    
-    // Transform and add all points
-    for (int j = 0; j < num_points; j++) {
-        float x = (float)points[j][0];
-        float y = (float)points[j][1];
-        
-        // Apply secondary rotation for tumbling effect (creates 3D-like tumble)
-        float x_tumble = x * cos_sec - y * sin_sec;
-        float y_tumble = x * sin_sec + y * cos_sec;
-        
-        // Apply primary rotation
-        float rotated_x = (float)(x_tumble * cos_a - y_tumble * sin_a);
-        float rotated_y = (float)(x_tumble * sin_a + y_tumble * cos_a);
-        
-        // Translate to comet position
-        rotated_x += (float)c->x;
-        rotated_y += (float)c->y;
-        
-        verts[j] = (Vertex){rotated_x, rotated_y, gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]};
+    if (sprite->shape == SPRITE_DIAMOND) {
+        float x = sprite->x, y = sprite->y, size = sprite->size;
+        float points[8] = {x + size, y, x, y + size, x - size, y, x, y - size};
+        PackedColor color = gl_current_color_packed();
+        PackedVertex verts[4];
+        for (int i = 0; i < 4; i++) {
+            verts[i] = (PackedVertex){points[i * 2], points[i * 2 + 1], color};
+        }
+        draw_packed_vertices(verts, 4, GL_TRIANGLE_FAN);
+    } else {
+        gl_draw_circle(sprite->x, sprite->y, sprite->size, 8);
+    }
+
+    if (sprite->trail_x != 0.0f || sprite->trail_y != 0.0f) {
+        gl_set_color_alpha(r, g, b, a * 0.3f);
+        gl_draw_line(sprite->x - sprite->trail_x, sprite->y - sprite->trail_y,
+                     sprite->x, sprite->y, 0.5f);
     }
-    
-    // Close the polygon by repeating first vertex
-    verts[num_points] = verts[0];
-    
-    glLineWidth(line_width);
-    // Use GL_LINE_STRIP with num_points+1 to close the polygon
-    draw_vertices(verts, num_points + 1, GL_LINE_STRIP);
-    free(verts);
 }
 
-// ✓ VECTOR-BASED ASTEROIDS (like original Asteroids arcade game)
-// Enhanced with varied shapes, tumbling animation, and better destruction particles
-void draw_comet_buster_comets_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)width;
-    (void)height;
-    (void)cr;
-    
-    for (int i = 0; i < game->comet_count; i++) {
-        Comet *c = &game->comets[i];
-        
-        // Skip inactive (destroyed) comets - DO NOT RENDER THEM
-        if (!c->active) continue;
-        
-        // Set color and line width
-        gl_set_color(c->color[0], c->color[1], c->color[2]);
-        
-        double radius = c->radius;
-        
-        // Use rotation_speed as deterministic shape seed for variety
-        int shape_seed = (int)(c->rotation_speed * 1000) % 997;  // Large prime for good distribution
-        int shape_variant = shape_seed % 4;  // 4 variants per size now
-        
-        if (c->size == COMET_MEGA) {
-            // Mega asteroid: 13+ points with high jagger
-            int num_points = 13 + (shape_seed % 3);  // 13-15 points
-            double points[16][2];
-            generate_jagged_asteroid_points(points, num_points, radius, shape_seed);
-            draw_comet_polygon(c, points, num_points, 3.5f);
-            
-        } else if (c->size == COMET_LARGE) {
-            // Large asteroid: 10-12 irregular points
-            int num_points = 10 + (shape_seed % 3);  // 10-12 points
-            double points[12][2];
-            generate_jagged_asteroid_points(points, num_points, radius, shape_seed);
-            draw_comet_polygon(c, points, num_points, 2.5f);
-            
-        } else if (c->size == COMET_MEDIUM) {
-            // Medium asteroid: 8-9 irregular points
-            int num_points = 8 + (shape_seed % 2);  // 8-9 points
-            double points[9][2];
-            generate_jagged_asteroid_points(points, num_points, radius, shape_seed);
-            draw_comet_polygon(c, points, num_points, 2.0f);
-            
-        } else if (c->size == COMET_SMALL) {
-            // Small asteroid: 6-7 points (still varied)
-            int num_points = 6 + (shape_seed % 2);  // 6-7 points
-            double points[7][2];
-            generate_jagged_asteroid_points(points, num_points, radius, shape_seed);
-            draw_comet_polygon(c, points, num_points, 1.5f);
+static void gl_queue_sprite(const SpriteInstance &sprite) {
+    if (!g_sprite_gl.ready) {
+        gl_draw_sprite_geometry(&sprite);
+        return;
+    }
+
+    int first = (int)g_frame_sprites.size();
+    g_frame_sprites.push_back(sprite);
+    g_frame_stats.submissions++;
+
+    if (!g_batches.empty()) {
+        GLBatch &last = g_batches.back();
+        if (last.kind == BATCH_SPRITES && last.blend == g_blend_mode) {
+            last.index_count++;
+            return;
         }
     }
+
+    GLBatch batch;
+    batch.kind = BATCH_SPRITES;
+    batch.mode = GL_TRIANGLES;
+    batch.blend = g_blend_mode;
+    batch.first_index = first;
+    batch.index_count = 1;
+    batch.texture = 0;
+    batch.mesh = 0;
+    g_batches.push_back(batch);
 }
 
-void draw_comet_buster_gl(Visualizer *visualizer, void *cr) {
-    if (!visualizer) return;
+void gl_draw_sprite(float x, float y, float trail_x, float trail_y, float size, float age,
+                    PackedColor color, SpriteShape shape) {
+    float trail_scale = quality_current()->trail_scale;
+    SpriteInstance sprite;
+    sprite.x = x;
+    sprite.y = y;
+    sprite.trail_x = trail_x * trail_scale;
+    sprite.trail_y = trail_y * trail_scale;
+    sprite.size = size;
+    sprite.age = age;
+    sprite.shape = (float)shape;
+    sprite.thickness = 0.0f;
+    sprite.color = color;
+    gl_queue_sprite(sprite);
+}
 
-    if (!isGLInitialized) {
-        gl_init();
-        SDL_Log("[Comet Busters] [Comet Busters] Initializing GL Init (should only happen once)");
-        isGLInitialized = 1;
-    }
-
-    CometBusterGame *game = &visualizer->comet_buster;
-    int width = visualizer->width;
-    int height = visualizer->height;
-    
-    gl_setup_2d_projection(width, height);
-    
-#ifdef ExternalSound
-    // Draw splash screen if active
-    if (game->splash_screen_active) {
-        comet_buster_draw_splash_screen_gl(game, cr, width, height);
-        return;  // Don't draw game yet
-    }
-    
-    // Draw finale splash if active (Wave 30 complete screen)
-    if (game->finale_splash_active) {
-        comet_buster_draw_finale_splash_gl(game, cr, width, height);
-        return;  // Don't draw game yet
-    }
-#endif
-    
-    // Background is already set in on_realize, no need to draw again
-    
-    // Draw grid (extended 50 pixels to the right)
-    gl_set_color(0.1f, 0.15f, 0.35f);
-    glLineWidth(0.5f);
-    
-    for (int i = 0; i <= width + 50; i += 50) {
-        gl_draw_line(i, 0, i, height, 0.5f);
-    }
-    for (int i = 0; i <= height; i += 50) {
-        gl_draw_line(0, i, width + 50, i, 0.5f);
-    }
-    
-    // Draw game elements
-    draw_comet_buster_comets_gl(game, cr, width, height);
-    draw_comet_buster_bullets_gl(game, cr, width, height);
-    draw_comet_buster_enemy_ships_gl(game, cr, width, height);
-    draw_comet_buster_ufos_gl(game, cr, width, height);
-    
-    // Draw boss (either Spawn Queen or regular Death Star)
-    if (game->boss_active) {
-        if (game->spawn_queen.active && game->spawn_queen.is_spawn_queen) {
-            draw_spawn_queen_boss_gl(game, &game->spawn_queen, cr, width, height);
-        } else if (game->boss.active) {
-            if (game->current_wave % 30 == 5) {
-               draw_comet_buster_boss_gl(game, &game->boss, cr, width, height);
-           } else if (game->current_wave % 30 == 10) {
-               draw_spawn_queen_boss_gl(game, &game->spawn_queen, cr, width, height);
-           } else if (game->current_wave % 30 == 15) {
-              draw_void_nexus_boss_gl(game, &game->boss, cr, width, height);
-           } else if (game->current_wave % 30 == 20) {
-              draw_harbinger_boss_gl(game, &game->boss, cr, width, height);
-           } else if (game->current_wave % 30 == 25) {
-              draw_star_vortex_boss_gl(&game->boss, cr, width, height);
-           } else if (game->current_wave % 30 == 0) {
-              draw_singularity_boss_gl(game, &game->boss, cr, width, height);
-           }
-       }
-    }
-    
-    draw_comet_buster_enemy_bullets_gl(game, cr, width, height);
-    draw_comet_buster_canisters_gl(game, cr, width, height);
-    draw_comet_buster_missile_pickups_gl(game, cr, width, height);
-    draw_comet_buster_bomb_pickups_gl(game, cr, width, height);
-    draw_comet_buster_missiles_gl(game, cr, width, height);
-    draw_comet_buster_bombs_gl(game, cr, width, height);
-    draw_comet_buster_particles_gl(game, cr, width, height);
-    draw_comet_buster_ship_gl(game, cr, width, height);
-    
-    // Draw boss explosion effect
-    boss_explosion_draw_gl(&game->boss_explosion_effect, cr);
-    
-    // Draw HUD
-    draw_comet_buster_hud_gl(game, cr, width, height);
-    
-    // Draw game over
-    if (game->game_over) {
-        draw_comet_buster_game_over_gl(game, cr, width, height);
-    }
+// One SDF shape in the current colour
+static void gl_queue_sdf(SpriteShape shape, float cx, float cy, float radius,
+                         float thickness, float start, float sweep) {
+    if (radius <= 0.0f) return;
+
+    SpriteInstance sprite;
+    sprite.x = cx;
+    sprite.y = cy;
+    sprite.trail_x = start;
+    sprite.trail_y = sweep;
+    sprite.size = radius;
+    sprite.age = 0.0f;
+    sprite.shape = (float)shape;
+    sprite.thickness = thickness;
+    sprite.color = gl_current_color_packed();
+    gl_queue_sprite(sprite);
 }
 
-void draw_comet_buster_bullets_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr;
-    (void)width;
-    (void)height;
-    
-    for (int i = 0; i < game->bullet_count; i++) {
-        Bullet *b = &game->bullets[i];
-        if (!b->active) continue;
-        
-        // Draw bullet as yellow diamond (4 points)
-        // Points: (x+size, y), (x, y+size), (x-size, y), (x, y-size)
-        double size = 3.0;
-        Vertex diamond_verts[5] = {
-            {(float)(b->x + size), (float)b->y, 1.0f, 1.0f, 0.0f, 1.0f},     // Right
-            {(float)b->x, (float)(b->y + size), 1.0f, 1.0f, 0.0f, 1.0f},    // Bottom
-            {(float)(b->x - size), (float)b->y, 1.0f, 1.0f, 0.0f, 1.0f},    // Left
-            {(float)b->x, (float)(b->y - size), 1.0f, 1.0f, 0.0f, 1.0f},    // Top
-            {(float)(b->x + size), (float)b->y, 1.0f, 1.0f, 0.0f, 1.0f}     // Close back to right
-        };
-        
-        // Draw filled diamond
-        gl_set_color(1.0f, 1.0f, 0.0f);
-        draw_vertices(diamond_verts, 5, GL_TRIANGLE_FAN);
-        
-        // Draw bullet trail (classic Asteroids style)
-        double trail_length = 5.0;
-        double norm_len = sqrt(b->vx * b->vx + b->vy * b->vy);
-        if (norm_len > 0.1) {
-            double trail_x = b->x - (b->vx / norm_len) * trail_length;
-            double trail_y = b->y - (b->vy / norm_len) * trail_length;
-            
-            gl_set_color_alpha(1.0f, 1.0f, 0.0f, 0.3f);
-            glLineWidth(0.5f);
-            gl_draw_line((float)trail_x, (float)trail_y, (float)b->x, (float)b->y, 0.5f);
-        }
-    }
+void gl_draw_disc(float cx, float cy, float radius) {
+    gl_queue_sdf(SPRITE_DISC, cx, cy, radius, 0.0f, 0.0f, 0.0f);
 }
 
-void draw_comet_buster_enemy_ships_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr;
-    (void)width;
-    (void)height;
-    
-    for (int i = 0; i < game->enemy_ship_count; i++) {
-        EnemyShip *ship = &game->enemy_ships[i];
-        if (!ship->active) continue;
-        
-        // Determine color based on ship type
-        float ship_r = 0.2f, ship_g = 0.6f, ship_b = 1.0f;  // Default: blue (patrol, type 0)
-        
-        switch (ship->ship_type) {
-            case 1:  // Aggressive red ship
-                ship_r = 1.0f; ship_g = 0.0f; ship_b = 0.0f;
-                break;
-            case 2:  // Hunter green ship
-                ship_r = 0.2f; ship_g = 1.0f; ship_b = 0.2f;
-                break;
-            case 3:  // Sentinel purple ship
-                ship_r = 0.8f; ship_g = 0.2f; ship_b = 1.0f;
-                break;
-            case 4:  // Brown coat elite cyan ship
-                ship_r = 0.0f; ship_g = 0.9f; ship_b = 1.0f;
-                break;
-            case 5:  // Juggernaut gold ship
-                ship_r = 1.0f; ship_g = 0.84f; ship_b = 0.0f;
-                break;
-        }
-        
-        // Determine size based on ship type
-        double ship_size;
-        if (ship->ship_type == 5) {
-            ship_size = 36.0;  // Juggernaut: 3x
-        } else if (ship->ship_type == 4) {
-            ship_size = 18.0;  // Brown coat: 1.5x
-        } else {
-            ship_size = 12.0;  // All others: 1x
-        }
-        
-        // Transform triangle points
-        float cos_a = cosf((float)ship->angle);
-        float sin_a = sinf((float)ship->angle);
-        
-        // Triangle points in local coordinates:
-        // Front: (ship_size, 0)
-        // Back left: (-ship_size, -ship_size/1.5)
-        // Back right: (-ship_size, ship_size/1.5)
-        double local_points[3][2] = {
-            {ship_size, 0},
-            {-ship_size, -ship_size / 1.5},
-            {-ship_size, ship_size / 1.5}
-        };
-        
-        // Transform to world coordinates
-        Vertex ship_verts[4];
-        for (int j = 0; j < 3; j++) {
-            float x = (float)local_points[j][0];
-            float y = (float)local_points[j][1];
-            
-            // Rotate by ship angle
-            float rotated_x = x * cos_a - y * sin_a;
-            float rotated_y = x * sin_a + y * cos_a;
-            
-            // Translate to ship position
-            rotated_x += (float)ship->x;
-            rotated_y += (float)ship->y;
-            
-            ship_verts[j] = (Vertex){rotated_x, rotated_y, ship_r, ship_g, ship_b, 1.0f};
-        }
-        
-        // Close the polygon
-        ship_verts[3] = ship_verts[0];
-        
-        // Draw filled triangle
-        gl_set_color(ship_r, ship_g, ship_b);
-        draw_vertices(ship_verts, 3, GL_TRIANGLE_FAN);
-        
-        // ========== INTIMIDATING STRIPES ==========
-        // Draw diagonal stripes across the ship body for aggressive look
-        {
-            float stripe_r = fminf(ship_r + 0.3f, 1.0f);
-            float stripe_g = fminf(ship_g + 0.3f, 1.0f);
-            float stripe_b = fminf(ship_b + 0.3f, 1.0f);
-            
-            // Calculate stripe positions along the ship body
-            int num_stripes = (ship->ship_type == 5) ? 6 : (ship->ship_type == 4) ? 4 : 3;
-            
-            for (int s = 0; s < num_stripes; s++) {
-                // Position along the body (from front to back)
-                float stripe_pos = 0.3f - (s * 0.35f / (float)num_stripes);
-                
-                // Calculate stripe width and angle
-                float stripe_width = (ship->ship_type == 5) ? 3.0f : 2.0f;
-                float stripe_length = ship_size * 0.8f;
-                
-                // Create two points for the stripe line (perpendicular to movement)
-                double local_x1 = stripe_pos * ship_size;
-                double local_y1 = -stripe_length / 4.0;
-                double local_x2 = stripe_pos * ship_size;
-                double local_y2 = stripe_length / 4.0;
-                
-                // Transform both points
-                float world_x1 = (float)(local_x1 * cos_a - local_y1 * sin_a + ship->x);
-                float world_y1 = (float)(local_x1 * sin_a + local_y1 * cos_a + ship->y);
-                float world_x2 = (float)(local_x2 * cos_a - local_y2 * sin_a + ship->x);
-                float world_y2 = (float)(local_x2 * sin_a + local_y2 * cos_a + ship->y);
-                
-                // Draw stripe with brighter color
-                glLineWidth(stripe_width);
-                gl_set_color(stripe_r, stripe_g, stripe_b);
-                gl_draw_line(world_x1, world_y1, world_x2, world_y2, stripe_width);
-            }
-        }
-        
-        // Draw outline
-        glLineWidth(1.5f);
-        gl_set_color(ship_r, ship_g, ship_b);
-        draw_vertices(ship_verts, 4, GL_LINE_STRIP);
-        
-        // ========== THRUSTER FLAME EFFECTS ==========
-        // Calculate velocity to determine flame intensity
-        double velocity = sqrt(ship->vx * ship->vx + ship->vy * ship->vy);
-        double flame_intensity = fminf(velocity / 100.0, 1.0);  // Normalize to 0-1
-        
-        if (flame_intensity > 0.05 || ship->ship_type == 5) {  // Always show flames for Juggernaut
-            // Flame ejection point at rear of ship
-            double flame_base_local_x = -ship_size * 0.9;
-            double flame_base_local_y = 0;
-            
-            float flame_base_x = (float)(flame_base_local_x * cos_a - flame_base_local_y * sin_a + ship->x);
-            float flame_base_y = (float)(flame_base_local_x * sin_a + flame_base_local_y * cos_a + ship->y);
-            
-            // Calculate flame direction (opposite to velocity direction)
-            double flame_dir_x = -ship->vx;
-            double flame_dir_y = -ship->vy;
-            double flame_dir_len = sqrt(flame_dir_x * flame_dir_x + flame_dir_y * flame_dir_y);
-            
-            if (flame_dir_len > 0.1) {
-                flame_dir_x /= flame_dir_len;
-                flame_dir_y /= flame_dir_len;
-            } else {
-                // Default to pointing backwards along ship angle
-                flame_dir_x = -cos_a;
-                flame_dir_y = -sin_a;
-            }
-            
-            // Flame base width
-            double flame_width = ship_size * 0.6;
-            
-            // ===== OUTER FLAME (orange/red) =====
-            double outer_flame_length = ship_size * 1.2 * flame_intensity;
-            double flicker = 0.8 + 0.2 * sin(ship->burner_flicker_timer * 30.0 + i);  // Flicker effect
-            
-            Vertex outer_flame_verts[4];
-            
-            // Left side
-            double left_x = flame_base_x - flame_dir_y * flame_width;
-            double left_y = flame_base_y + flame_dir_x * flame_width;
-            outer_flame_verts[0] = (Vertex){(float)left_x, (float)left_y, 1.0f, 0.4f, 0.0f, 1.0f};
-            
-            // Right side
-            double right_x = flame_base_x + flame_dir_y * flame_width;
-            double right_y = flame_base_y - flame_dir_x * flame_width;
-            outer_flame_verts[1] = (Vertex){(float)right_x, (float)right_y, 1.0f, 0.4f, 0.0f, 1.0f};
-            
-            // Tip
-            double tip_x = flame_base_x + flame_dir_x * outer_flame_length;
-            double tip_y = flame_base_y + flame_dir_y * outer_flame_length;
-            outer_flame_verts[2] = (Vertex){(float)tip_x, (float)tip_y, 1.0f, 0.2f, 0.0f, (float)flicker * 0.6f};
-            
-            outer_flame_verts[3] = outer_flame_verts[0];
-            
-            glLineWidth(2.0f);
-            gl_set_color_alpha(1.0f, 0.4f, 0.0f, 0.7f * (float)flame_intensity);
-            draw_vertices(outer_flame_verts, 3, GL_TRIANGLE_FAN);
-            
-            // ===== INNER FLAME (bright yellow) =====
-            double inner_flame_length = outer_flame_length * 0.6;
-            
-            Vertex inner_flame_verts[4];
-            
-            // Left side (narrower)
-            double inner_left_x = flame_base_x - flame_dir_y * flame_width * 0.4;
-            double inner_left_y = flame_base_y + flame_dir_x * flame_width * 0.4;
-            inner_flame_verts[0] = (Vertex){(float)inner_left_x, (float)inner_left_y, 1.0f, 1.0f, 0.3f, 1.0f};
-            
-            // Right side (narrower)
-            double inner_right_x = flame_base_x + flame_dir_y * flame_width * 0.4;
-            double inner_right_y = flame_base_y - flame_dir_x * flame_width * 0.4;
-            inner_flame_verts[1] = (Vertex){(float)inner_right_x, (float)inner_right_y, 1.0f, 1.0f, 0.3f, 1.0f};
-            
-            // Inner tip
-            double inner_tip_x = flame_base_x + flame_dir_x * inner_flame_length;
-            double inner_tip_y = flame_base_y + flame_dir_y * inner_flame_length;
-            inner_flame_verts[2] = (Vertex){(float)inner_tip_x, (float)inner_tip_y, 1.0f, 1.0f, 0.6f, (float)flicker * 0.9f};
-            
-            inner_flame_verts[3] = inner_flame_verts[0];
-            
-            gl_set_color_alpha(1.0f, 1.0f, 0.3f, 0.8f * (float)flame_intensity);
-            draw_vertices(inner_flame_verts, 3, GL_TRIANGLE_FAN);
-        }
-        
-        // Draw Juggernaut health bar (for type 5 only)
-        if (ship->ship_type == 5) {
-            double bar_width = 60.0;
-            double bar_height = 8.0;
-            double bar_x = ship->x - bar_width / 2.0;
-            double bar_y = ship->y + 50.0;
-            
-            // Background bar
-            gl_set_color(0.3f, 0.3f, 0.3f);
-            gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height);
-            
-            // Outline
-            glLineWidth(1.0f);
-            gl_set_color(0.3f, 0.3f, 0.3f);
-            gl_draw_rect_outline((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height, 1.0f);
-            
-            // Health fill (green to yellow to red)
-            double health_ratio = (double)ship->health / 10.0;
-            if (health_ratio < 0.0) health_ratio = 0.0;
-            if (health_ratio > 1.0) health_ratio = 1.0;
-            
-            float bar_r, bar_g, bar_b;
-            if (health_ratio > 0.5) {
-                // Green to yellow (high health)
-                bar_r = (1.0f - (float)health_ratio) * 2.0f;
-                bar_g = 1.0f;
-                bar_b = 0.0f;
-            } else {
-                // Yellow to red (low health)
-                bar_r = 1.0f;
-                bar_g = (float)health_ratio * 2.0f;
-                bar_b = 0.0f;
-            }
-            
-            gl_set_color(bar_r, bar_g, bar_b);
-            double fill_width = (bar_width - 2.0) * health_ratio;
-            gl_draw_rect_filled((float)(bar_x + 1.0), (float)(bar_y + 1.0), (float)fill_width, (float)(bar_height - 2.0));
-        }
-        
-        // ========== SHIELD CIRCLE ==========
-        if (ship->shield_health > 0) {
-            // Determine shield color based on ship type
-            float shield_r = 0.2f, shield_g = 0.6f, shield_b = 1.0f;
-            float shield_alpha = 0.5f;
-            
-            switch (ship->ship_type) {
-                case 1:  // Red ship shield: orange/red
-                    shield_r = 1.0f; shield_g = 0.5f; shield_b = 0.0f;
-                    break;
-                case 2:  // Green ship shield: bright green
-                    shield_r = 0.5f; shield_g = 1.0f; shield_b = 0.5f;
-                    break;
-                case 3:  // Sentinel purple shield: bright purple
-                    shield_r = 0.8f; shield_g = 0.4f; shield_b = 1.0f;
-                    break;
-                case 4:  // Brown coat cyan shield - bright cyan
-                    shield_r = 0.2f; shield_g = 0.9f; shield_b = 1.0f;
-                    shield_alpha = 0.6f;  // Brighter for brown coat
-                    break;
-                case 5:  // Juggernaut gold shield - golden glow
-                    shield_r = 1.0f; shield_g = 0.9f; shield_b = 0.2f;
-                    break;
-            }
-            
-            // Determine shield radius based on ship type
-            double shield_radius;
-            if (ship->ship_type == 5) {
-                shield_radius = 50.0;  // Larger shield for juggernaut
-            } else if (ship->ship_type == 4) {
-                shield_radius = 24.0;  // Slightly larger for brown coat
-            } else {
-                shield_radius = 22.0;  // Standard shield radius
-            }
-            
-            // Draw shield circle
-            gl_set_color_alpha(shield_r, shield_g, shield_b, shield_alpha);
-            gl_draw_circle_outline((float)ship->x, (float)ship->y, (float)shield_radius, 2.0f, 24);
-            
-            // Draw shield impact flash
-            if (ship->shield_impact_timer > 0) {
-                float flash_alpha = (float)(ship->shield_impact_timer / 0.2);
-                if (flash_alpha > 1.0f) flash_alpha = 1.0f;
-                
-                double impact_x = 22.0 * cos(ship->shield_impact_angle);
-                double impact_y = 22.0 * sin(ship->shield_impact_angle);
-                
-                // Bright white flash circle
-                gl_set_color_alpha(1.0f, 1.0f, 1.0f, flash_alpha * 0.8f);
-                gl_draw_circle((float)(ship->x + impact_x), (float)(ship->y + impact_y), 4.0f, 12);
-                
-                // Expanding rings
-                double ring_radius = 6.0 + (1.0 - flash_alpha) * 10.0;
-                gl_set_color_alpha(1.0f, 1.0f, 1.0f, flash_alpha * 0.4f);
-                gl_draw_circle_outline((float)(ship->x + impact_x), (float)(ship->y + impact_y), (float)ring_radius, 1.0f, 16);
-            }
-        }
-    }
+void gl_draw_ring(float cx, float cy, float radius, float thickness) {
+    gl_queue_sdf(SPRITE_RING, cx, cy, radius, thickness, 0.0f, 0.0f);
 }
 
-void draw_comet_buster_ufos_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr;
-    (void)width;
-    (void)height;
-    
-    for (int i = 0; i < game->ufo_count; i++) {
-        UFO *ufo = &game->ufos[i];
-        if (!ufo->active) continue;
-        
-        // Set color based on damage state
-        float ufo_r = 0.0f, ufo_g = 1.0f, ufo_b = 1.0f;  // Cyan
-        if (ufo->damage_flash_timer > 0) {
-            ufo_r = 1.0f; ufo_g = 1.0f; ufo_b = 1.0f;  // White when hit
-        }
-        
-        // UFO dimensions
-        double dome_width = 40.0;
-        double dome_height = 20.0;
-        double porthole_radius = 3.5;
-        double porthole_spacing = 14.0;
-        double fin_width = 5.0;
-        double fin_height = 6.0;
-        
-        // ========== DOME (Top semicircle) ==========
-        gl_set_color(ufo_r, ufo_g, ufo_b);
-        glLineWidth(1.5f);
-        
-        // Draw top dome - semicircle
-        int dome_segments = 20;
-        Vertex dome_verts[21];
-        for (int j = 0; j <= dome_segments; j++) {
-            double angle = M_PI + (j * M_PI / dome_segments);  // From PI to 2*PI (top half)
-            float x = (float)(ufo->x + (dome_width / 2.0) * cos(angle));
-            float y = (float)(ufo->y + (dome_width / 2.0) * sin(angle));
-            dome_verts[j] = (Vertex){x, y, ufo_r, ufo_g, ufo_b, 1.0f};
-        }
-        draw_vertices(dome_verts, dome_segments + 1, GL_LINE_STRIP);
-        
-        // ========== FLAT LINE (where dome meets body) ==========
-        gl_draw_line((float)(ufo->x - dome_width / 2.0), (float)ufo->y,
-                     (float)(ufo->x + dome_width / 2.0), (float)ufo->y, 1.5f);
-        
-        // ========== THREE PORTHOLES ==========
-        // Left porthole
-        gl_set_color(ufo_r, ufo_g, ufo_b);
-        gl_draw_circle_outline((float)(ufo->x - porthole_spacing), 
-                              (float)(ufo->y + dome_height / 2.0), 
-                              (float)porthole_radius, 1.5f, 12);
-        
-        // Center porthole
-        gl_draw_circle_outline((float)ufo->x, 
-                              (float)(ufo->y + dome_height / 2.0), 
-                              (float)porthole_radius, 1.5f, 12);
-        
-        // Right porthole
-        gl_draw_circle_outline((float)(ufo->x + porthole_spacing), 
-                              (float)(ufo->y + dome_height / 2.0), 
-                              (float)porthole_radius, 1.5f, 12);
-        
-        // ========== FINS ==========
-        // Left fin
-        gl_draw_rect_outline((float)(ufo->x - porthole_spacing - fin_width / 2.0),
-                            (float)(ufo->y + dome_height / 2.0),
-                            (float)fin_width, (float)fin_height, 1.5f);
-        
-        // Right fin
-        gl_draw_rect_outline((float)(ufo->x + porthole_spacing - fin_width / 2.0),
-                            (float)(ufo->y + dome_height / 2.0),
-                            (float)fin_width, (float)fin_height, 1.5f);
-        
-        // ========== HEALTH INDICATOR DOTS ==========
-        if (ufo->health < ufo->max_health) {
-            for (int h = 0; h < ufo->max_health; h++) {
-                if (h < ufo->health) {
-                    gl_set_color(0.0f, 1.0f, 1.0f);  // Cyan for healthy
-                } else {
-                    gl_set_color(0.3f, 0.3f, 0.3f);  // Dark gray for missing
-                }
-                
-                double dot_x = ufo->x - 10.0 + h * 10.0;
-                double dot_y = ufo->y - dome_height - 8.0;
-                gl_draw_circle((float)dot_x, (float)dot_y, 2.0f, 12);
-            }
-        }
-    }
+void gl_draw_glow(float cx, float cy, float radius) {
+    if (!quality_current()->glows) return;
+    gl_queue_sdf(SPRITE_GLOW, cx, cy, radius, 0.0f, 0.0f, 0.0f);
 }
 
-void draw_comet_buster_enemy_bullets_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr;
-    (void)width;
-    (void)height;
-    for (int i = 0; i < game->enemy_bullet_count; i++) {
-        Bullet *b = &game->enemy_bullets[i];
-        if (!b->active) continue;
-        gl_set_color(0.0f, 1.0f, 1.0f);  // Cyan - matches Cairo version
-        gl_draw_circle(b->x, b->y, 3.0f, 8);
-    }
+void gl_draw_arc(float cx, float cy, float radius, float thickness, float start, float sweep) {
+    if (sweep <= 0.0f) return;
+    gl_queue_sdf(SPRITE_ARC, cx, cy, radius, thickness, start, sweep);
 }
 
-void draw_comet_buster_canisters_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr;
-    (void)width;
-    (void)height;
-    
-    for (int i = 0; i < game->canister_count; i++) {
-        Canister *c = &game->canisters[i];
-        if (!c->active) continue;
-        
-        // Alpha based on remaining lifetime (fade out near end)
-        float alpha = 1.0f;
-        if (c->lifetime < 2.0) {
-            alpha = (float)(c->lifetime / 2.0);
-        }
-        
-        // Draw shield shape as a simple circle for now (easier to debug)
-        // Darker cyan fill
-        gl_set_color_alpha(0.0f, 0.6f, 0.8f, alpha * 0.3f);
-        gl_draw_circle(c->x, c->y, 12.0f, 24);
-        
-        // Bright cyan outline
-        gl_set_color_alpha(0.0f, 1.0f, 1.0f, alpha);
-        gl_draw_circle_outline(c->x, c->y, 12.0f, 2.0f, 24);
-        
-        // Draw medical cross in center
-        gl_set_color_alpha(0.0f, 1.0f, 1.0f, alpha);
-        float cross_size = 5.0f;
-        gl_draw_line(c->x - cross_size, (float)c->y, c->x + cross_size, (float)c->y, 1.5f);
-        gl_draw_line((float)c->x, c->y - cross_size, (float)c->x, c->y + cross_size, 1.5f);
-    }
+bool gl_glyphs_ready(void) {
+    return g_glyph_gl.ready;
 }
 
-void draw_comet_buster_missile_pickups_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr; (void)width; (void)height;
-    
-    for (int i = 0; i < game->missile_pickup_count; i++) {
-        MissilePickup *pickup = &game->missile_pickups[i];
-        if (!pickup->active) continue;
-        
-        // Alpha fade out in last 2 seconds
-        float alpha = 1.0f;
-        if (pickup->lifetime < 2.0) {
-            alpha = (float)(pickup->lifetime / 2.0);
+void gl_draw_coverage_quad(GLuint texture, const GlyphInstance *quad) {
+    int first = (int)g_frame_glyphs.size();
+    g_frame_glyphs.push_back(*quad);
+    g_frame_stats.submissions++;
+
+    if (!g_batches.empty()) {
+        GLBatch &last = g_batches.back();
+        if (last.kind == BATCH_GLYPHS && last.blend == g_blend_mode && last.texture == texture) {
+            last.index_count++;
+            return;
         }
-        
-        double size = 10.0;
-        
-        // Draw X shape (orange lines)
-        gl_set_color_alpha(1.0f, 0.65f, 0.0f, alpha);
-        gl_draw_line((float)(pickup->x - size), (float)(pickup->y - size), 
-                     (float)(pickup->x + size), (float)(pickup->y + size), 2.5f);
-        gl_draw_line((float)(pickup->x + size), (float)(pickup->y - size), 
-                     (float)(pickup->x - size), (float)(pickup->y + size), 2.5f);
-        
-        // Draw circle outline (orange)
-        gl_draw_circle_outline(pickup->x, pickup->y, size + 4.0, 1.5f, 24);
-        
-        // Draw yellow filled circle in center
-        gl_set_color_alpha(1.0f, 1.0f, 0.0f, alpha);
-        gl_draw_circle(pickup->x, pickup->y, 2.5f, 12);
     }
+
+    GLBatch batch;
+    batch.kind = BATCH_GLYPHS;
+    batch.mode = GL_TRIANGLES;
+    batch.blend = g_blend_mode;
+    batch.first_index = first;
+    batch.index_count = 1;
+    batch.texture = texture;
+    batch.mesh = 0;
+    g_batches.push_back(batch);
 }
 
-void draw_comet_buster_bomb_pickups_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr; (void)width; (void)height;
-    
-    for (int i = 0; i < game->bomb_pickup_count; i++) {
-        BombPickup *p = &game->bomb_pickups[i];
-        if (!p->active) continue;
-        
-        // Alpha fade out in last 2 seconds
-        float alpha = 1.0f;
-        if (p->lifetime < 2.0) {
-            alpha = (float)(p->lifetime / 2.0);
-        }
-        
-        // Draw main bomb circle (orange/yellow)
-        gl_set_color_alpha(1.0f, 0.7f, 0.0f, alpha);
-        gl_draw_circle(p->x, p->y, 12.0f, 24);
-        
-        // Draw fuse (line sticking out from top)
-        gl_set_color_alpha(0.8f, 0.4f, 0.2f, alpha);
-        gl_draw_line((float)p->x, (float)p->y - 12.0f, (float)p->x, (float)p->y - 22.0f, 1.5f);
-    }
+void gl_draw_glyph(const GlyphInstance *glyph) {
+    gl_draw_coverage_quad(ft_glyph_atlas_texture(), glyph);
 }
 
-void draw_comet_buster_missiles_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr;
-    (void)width;
-    (void)height;
-    
-    // Color scheme for each missile type
-    // Type 0: CYAN - Target furthest comet
-    // Type 1: RED - Target ships and boss
-    // Type 2: GREEN - Target closest comets
-    // Type 3: MAGENTA - Target comets ~400px away
-    // Type 4: ORANGE - Target comets 200-600px away
-    
-    for (int i = 0; i < game->missile_count; i++) {
-        Missile *missile = &game->missiles[i];
-        if (!missile->active) continue;
-        
-        // Calculate alpha fade based on lifetime
-        float alpha = 1.0f;
-        if (missile->lifetime < 0.5) {
-            alpha = (float)(missile->lifetime / 0.5);
-        }
-        
-        // Determine fill color based on missile type
-        float fill_r = 1.0f, fill_g = 1.0f, fill_b = 0.2f;  // Default yellow
-        float stroke_r = 1.0f, stroke_g = 0.8f, stroke_b = 0.0f;  // Default orange
-        
-        switch (missile->missile_type) {
-            case 0:  // Furthest comet - CYAN
-                fill_r = 0.2f; fill_g = 1.0f; fill_b = 1.0f;
-                stroke_r = 0.0f; stroke_g = 0.8f; stroke_b = 1.0f;
-                break;
-            case 1:  // Ships and boss - RED
-                fill_r = 1.0f; fill_g = 0.2f; fill_b = 0.2f;
-                stroke_r = 1.0f; stroke_g = 0.0f; stroke_b = 0.0f;
-                break;
-            case 2:  // Closest comets - GREEN
-                fill_r = 0.2f; fill_g = 1.0f; fill_b = 0.2f;
-                stroke_r = 0.0f; stroke_g = 0.8f; stroke_b = 0.0f;
-                break;
-            case 3:  // Comets ~400px away - MAGENTA
-                fill_r = 1.0f; fill_g = 0.2f; fill_b = 1.0f;
-                stroke_r = 0.8f; stroke_g = 0.0f; stroke_b = 0.8f;
-                break;
-            case 4:  // Comets 200-600px away - ORANGE
-                fill_r = 1.0f; fill_g = 0.6f; fill_b = 0.0f;
-                stroke_r = 1.0f; stroke_g = 0.4f; stroke_b = 0.0f;
-                break;
-        }
-        
-        float cos_a = cosf((float)missile->angle);
-        float sin_a = sinf((float)missile->angle);
-        
-        // ===== DRAW EXHAUST FLAMES (behind the missile) =====
-        // All flames are red
-        float flame_r = 1.0f, flame_g = 0.2f, flame_b = 0.0f;  // Red flame
-        
-        // Draw exhaust flame (two triangles for width)
-        float flame_length = 8.0f;
-        float flame_width = 2.5f;
-        
-        // Left flame
-        float flame_points_left[6] = {
-            -6.0f,  -flame_width,    // Base left
-            -6.0f,  flame_width,     // Base right
-            -6.0f - flame_length, 0.0f  // Tip
-        };
-        
-        // Right flame
-        float flame_points_right[6] = {
-            -6.0f,  flame_width,     // Base left
-            -6.0f,  -flame_width,    // Base right
-            -6.0f - flame_length, 0.0f  // Tip
-        };
-        
-        Vertex flame_verts[3];
-        for (int j = 0; j < 3; j++) {
-            float x = flame_points_left[j*2];
-            float y = flame_points_left[j*2+1];
-            float rotated_x = x * cos_a - y * sin_a + (float)missile->x;
-            float rotated_y = x * sin_a + y * cos_a + (float)missile->y;
-            flame_verts[j] = (Vertex){rotated_x, rotated_y, flame_r, flame_g, flame_b, alpha * 0.6f};
-        }
-        gl_set_color_alpha(flame_r, flame_g, flame_b, alpha * 0.6f);
-        draw_vertices(flame_verts, 3, GL_TRIANGLES);
-        
-        // ===== DRAW MISSILE BODY =====
-        // Missile shape (pointed nose with body and thruster fins):
-        // Nose cone, body, and two small thruster fins
-        float points[20] = {
-            10.0f,  0.0f,      // Pointed nose (0)
-            6.0f,   2.0f,      // Upper body (1)
-            4.0f,   3.0f,      // Upper thruster start (2)
-            0.0f,   3.5f,      // Upper thruster wing (3)
-            -4.0f,  1.5f,      // Upper back (4)
-            -6.0f,  0.0f,      // Back center (5)
-            -4.0f, -1.5f,      // Lower back (6)
-            0.0f,  -3.5f,      // Lower thruster wing (7)
-            4.0f,  -3.0f,      // Lower thruster start (8)
-            6.0f,  -2.0f       // Lower body (9)
-        };
-        
-        Vertex verts[10];
-        for (int j = 0; j < 10; j++) {
-            float x = points[j*2];
-            float y = points[j*2+1];
-            
-            // Rotate point
-            float rotated_x = x * cos_a - y * sin_a;
-            float rotated_y = x * sin_a + y * cos_a;
-            
-            // Translate to missile position
-            rotated_x += (float)missile->x;
-            rotated_y += (float)missile->y;
-            
-            verts[j] = (Vertex){rotated_x, rotated_y, fill_r, fill_g, fill_b, alpha};
-        }
-        
-        // Draw filled missile body
-        gl_set_color_alpha(fill_r, fill_g, fill_b, alpha);
-        draw_vertices(verts, 10, GL_TRIANGLE_FAN);
-        
-        // Draw missile outline for definition
-        gl_set_color_alpha(stroke_r, stroke_g, stroke_b, alpha);
-        gl_set_line_width_cached(1.5f);
-        
-        // Create outline vertices (repeat first to close)
-        Vertex outline_verts[11];
-        for (int j = 0; j < 10; j++) {
-            outline_verts[j] = verts[j];
-        }
-        outline_verts[10] = verts[0];  // Close the shape
-        
-        draw_vertices(outline_verts, 11, GL_LINE_STRIP);
-        
-        // ===== DRAW SMALL THRUSTER NOZZLES =====
-        // Two small thruster nozzles on the sides (red flame colored)
-        
-        gl_set_color_alpha(flame_r, flame_g, flame_b, alpha);
-        
-        // Upper thruster nozzle (small circle at wing position)
-        float thruster_size = 1.5f;
-        float nozzle_points[6] = {
-            0.0f,   3.5f,
-            thruster_size,   3.0f,
-            -thruster_size,  3.0f
-        };
-        
-        Vertex thruster_verts[3];
-        for (int j = 0; j < 3; j++) {
-            float x = nozzle_points[j*2];
-            float y = nozzle_points[j*2+1];
-            float rotated_x = x * cos_a - y * sin_a + (float)missile->x;
-            float rotated_y = x * sin_a + y * cos_a + (float)missile->y;
-            thruster_verts[j] = (Vertex){rotated_x, rotated_y, flame_r, flame_g, flame_b, alpha};
-        }
-        draw_vertices(thruster_verts, 3, GL_TRIANGLES);
-        
-        // Lower thruster nozzle
-        float nozzle_points_lower[6] = {
-            0.0f,   -3.5f,
-            -thruster_size,  -3.0f,
-            thruster_size,   -3.0f
-        };
-        
-        for (int j = 0; j < 3; j++) {
-            float x = nozzle_points_lower[j*2];
-            float y = nozzle_points_lower[j*2+1];
-            float rotated_x = x * cos_a - y * sin_a + (float)missile->x;
-            float rotated_y = x * sin_a + y * cos_a + (float)missile->y;
-            thruster_verts[j] = (Vertex){rotated_x, rotated_y, flame_r, flame_g, flame_b, alpha};
-        }
-        draw_vertices(thruster_verts, 3, GL_TRIANGLES);
-    }
+// ============================================================================
+// BAKED MESHES
+// ============================================================================
+// See GLMeshId. Each bake function below draws one mesh with the ordinary
+// drawing calls, at the origin and facing +x, between
+// gl_mesh_capture_begin() and gl_mesh_capture_end(). Capturing takes the
+// triangles those calls queued out of the frame stream (circles are
+// tessellated instead of becoming SDF sprites) and appends them to the mesh
+// buffer, so the art stays written the same way as everything else.
+
+static void gl_mesh_capture_begin(void) {
+    gl_flush_batches();
+    g_mesh_gl.capturing = true;
 }
 
-void draw_comet_buster_bombs_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr; (void)width; (void)height;
-    for (int i = 0; i < game->bomb_count; i++) {
-        Bomb *bomb = &game->bombs[i];
-        if (!bomb->active) continue;
-        
-        if (!bomb->detonated) {
-            // Pulsing effect based on time left
-            double pulse = 1.0 - (bomb->lifetime / bomb->max_lifetime) * 0.3;  // Pulses as countdown happens
-            
-            // Main bomb body - orange circle with pulsing
-            gl_set_color_alpha((float)(1.0 * pulse), 0.6f, 0.0f, 1.0f);
-            gl_draw_circle(bomb->x, bomb->y, 15.0f, 24);
-            
-            // Outline - yellow
-            gl_set_color(1.0f, 0.8f, 0.0f);
-            gl_draw_circle_outline(bomb->x, bomb->y, 15.0f, 2.0f, 24);
-            
-            // Fuse - brown line sticking up
-            gl_set_color(0.7f, 0.3f, 0.1f);
-            gl_draw_line(bomb->x, bomb->y - 15.0f, bomb->x, bomb->y - 28.0f, 2.0f);
-            
-            // Spark at fuse - yellow circle
-            gl_set_color(1.0f, 1.0f, 0.2f);
-            gl_draw_circle(bomb->x, bomb->y - 28.0f, 3.0f, 12);
-            
-            // Countdown text - white number
-            gl_set_color(1.0f, 1.0f, 1.0f);
-            int countdown = (int)(bomb->lifetime + 1);
-            if (countdown < 1) countdown = 1;
-            
-            char text[8];
-            snprintf(text, sizeof(text), "%d", countdown);
-            
-            // Draw countdown text centered on bomb
-            gl_draw_text_simple(text, (int)bomb->x - 3, (int)bomb->y - 2, 12);
-        } else {
-            // Draw explosion wave
-            // Expanding circle with fading opacity
-            double wave_progress = bomb->wave_radius / bomb->wave_max_radius;
-            double opacity = 1.0 - wave_progress;  // Fades out as it expands
-            
-            gl_set_color_alpha(1.0f, 0.5f, 0.0f, (float)opacity);
-            gl_draw_circle_outline(bomb->x, bomb->y, bomb->wave_radius, 2.0f, 24);
+static void gl_mesh_capture_end(GLMeshId id) {
+    GLMesh &mesh = g_mesh_gl.meshes[id];
+    mesh.first = (int)g_mesh_gl.vertices.size();
+    for (size_t b = 0; b < g_batches.size(); b++) {
+        const GLBatch &batch = g_batches[b];
+        if (batch.kind != BATCH_GEOMETRY || batch.mode != GL_TRIANGLES) continue;
+        for (int i = 0; i < batch.index_count; i++) {
+            g_mesh_gl.vertices.push_back(g_frame_verts[g_frame_indices[batch.first_index + i]]);
         }
     }
-}
+    mesh.count = (int)g_mesh_gl.vertices.size() - mesh.first;
 
-void draw_comet_buster_particles_gl(CometBusterGame *game, void *cr, int width, int height)
-{
-    if (!game) return;
-    (void)cr;
-    (void)width;
-    (void)height;
-
-//#ifdef ANDROID
-    // Android: Batch all particles into one GL_TRIANGLES draw call
+    g_frame_verts.clear();
+    g_frame_indices.clear();
+    g_frame_sprites.clear();
+    g_frame_glyphs.clear();
+    g_batches.clear();
+    g_mesh_gl.capturing = false;
+}
 
-    if (game->particle_count == 0) return;
+static void gl_bake_player_ship(void) {
+    double ship_size = 12.0;
 
-    static Vertex *particle_buffer = NULL;
-    static int buffer_capacity = 0;
+    // (12,0), (-12,-12), (-3.6,0), (-12,12), closed like cairo_close_path
+    float points[10] = {
+        (float)ship_size, 0.0f,                 // Front point
+        (float)-ship_size, (float)-ship_size,   // Top left
+        (float)(-ship_size * 0.3), 0.0f,        // Side notch
+        (float)-ship_size, (float)ship_size,    // Bottom left
+        (float)ship_size, 0.0f
+    };
 
-    // Count total vertices needed (6 triangles = 18 verts per particle)
-    int total_verts = 0;
-    for (int i = 0; i < game->particle_count; i++) {
-        if (game->particles[i].active) {
-            total_verts += 18;
-        }
-    }
+    // Outline only - no fill, like the Cairo version
+    gl_set_color(0.0f, 1.0f, 0.0f);
+    gl_draw_polyline(points, 5, 2.0f);
+}
 
-    if (total_verts == 0) return;
+static void gl_bake_enemy_ship(int ship_type) {
+    // Color by ship type
+    float ship_r = 0.2f, ship_g = 0.6f, ship_b = 1.0f;  // Default: blue (patrol, type 0)
+    switch (ship_type) {
+        case 1: ship_r = 1.0f; ship_g = 0.0f; ship_b = 0.0f; break;    // Aggressive red
+        case 2: ship_r = 0.2f; ship_g = 1.0f; ship_b = 0.2f; break;    // Hunter green
+        case 3: ship_r = 0.8f; ship_g = 0.2f; ship_b = 1.0f; break;    // Sentinel purple
+        case 4: ship_r = 0.0f; ship_g = 0.9f; ship_b = 1.0f; break;    // Brown coat cyan
+        case 5: ship_r = 1.0f; ship_g = 0.84f; ship_b = 0.0f; break;   // Juggernaut gold
+    }
+
+    double ship_size = drawlist_enemy_ship_size(ship_type);
+
+    // Front (ship_size, 0), back left and back right, closed
+    float points[8] = {
+        (float)ship_size, 0.0f,
+        (float)-ship_size, (float)(-ship_size / 1.5),
+        (float)-ship_size, (float)(ship_size / 1.5),
+        (float)ship_size, 0.0f
+    };
 
-    // Grow buffer if needed
-    if (total_verts > buffer_capacity) {
-        particle_buffer = (Vertex *)realloc(particle_buffer, total_verts * sizeof(Vertex));
-        buffer_capacity = total_verts;
-    }
+    // Filled triangle
+    gl_set_color(ship_r, ship_g, ship_b);
+    gl_draw_polygon(points, 3, 1);
+
+    // Intimidating stripes across the body, brighter than the hull
+    float stripe_r = fminf(ship_r + 0.3f, 1.0f);
+    float stripe_g = fminf(ship_g + 0.3f, 1.0f);
+    float stripe_b = fminf(ship_b + 0.3f, 1.0f);
+    int num_stripes = (ship_type == 5) ? 6 : (ship_type == 4) ? 4 : 3;
+    float stripe_width = (ship_type == 5) ? 3.0f : 2.0f;
+    float stripe_length = (float)ship_size * 0.8f;
+
+    gl_set_color(stripe_r, stripe_g, stripe_b);
+    for (int s = 0; s < num_stripes; s++) {
+        // Position along the body (from front to back)
+        float stripe_pos = 0.3f - (s * 0.35f / (float)num_stripes);
+        float x = stripe_pos * (float)ship_size;
+        gl_draw_line(x, -stripe_length / 4.0f, x, stripe_length / 4.0f, stripe_width);
+    }
+
+    // Outline
+    gl_set_color(ship_r, ship_g, ship_b);
+    gl_draw_polyline(points, 4, 1.5f);
+}
 
-    int vert_idx = 0;
+static void gl_bake_ufo(void) {
+    double dome_width = 40.0;
+    double dome_height = 20.0;
+    double porthole_radius = 3.5;
+    double porthole_spacing = 14.0;
+    double fin_width = 5.0;
+    double fin_height = 6.0;
 
-    // Fill buffer
-    for (int i = 0; i < game->particle_count; i++) {
-        Particle *p = &game->particles[i];
-        if (!p->active) continue;
+    gl_set_color(1.0f, 1.0f, 1.0f);
 
-        float r = (float)p->color[0];
-        float g = (float)p->color[1];
-        float b = (float)p->color[2];
-        float alpha = (float)(p->lifetime / p->max_lifetime);
+    // Dome - top semicircle, PI to 2*PI
+    int dome_segments = 20;
+    float dome[(20 + 1) * 2];
+    for (int j = 0; j <= dome_segments; j++) {
+        double angle = M_PI + (j * M_PI / dome_segments);
+        dome[j * 2] = (float)((dome_width / 2.0) * cos(angle));
+        dome[j * 2 + 1] = (float)((dome_width / 2.0) * sin(angle));
+    }
+    gl_draw_polyline(dome, dome_segments + 1, 1.5f);
 
-        float cx = (float)p->x;
-        float cy = (float)p->y;
+    // Flat line where the dome meets the body
+    gl_draw_line((float)(-dome_width / 2.0), 0.0f, (float)(dome_width / 2.0), 0.0f, 1.5f);
 
-        // 6‑sided circle → 6 triangles
-        for (int j = 0; j < 6; j++) {
-            double a0 = (j / 6.0) * 2.0 * M_PI;
-            double a1 = ((j + 1) / 6.0) * 2.0 * M_PI;
+    // Three portholes
+    for (int p = -1; p <= 1; p++) {
+        gl_draw_circle_outline((float)(p * porthole_spacing), (float)(dome_height / 2.0),
+                               (float)porthole_radius, 1.5f, 12);
+    }
 
-            float x0 = (float)(p->x + p->size * cos(a0));
-            float y0 = (float)(p->y + p->size * sin(a0));
+    // Fins
+    gl_draw_rect_outline((float)(-porthole_spacing - fin_width / 2.0), (float)(dome_height / 2.0),
+                         (float)fin_width, (float)fin_height, 1.5f);
+    gl_draw_rect_outline((float)(porthole_spacing - fin_width / 2.0), (float)(dome_height / 2.0),
+                         (float)fin_width, (float)fin_height, 1.5f);
+}
 
-            float x1 = (float)(p->x + p->size * cos(a1));
-            float y1 = (float)(p->y + p->size * sin(a1));
+static void gl_bake_canister(void) {
+    // Darker cyan fill, bright cyan outline
+    gl_set_color_alpha(0.0f, 0.6f, 0.8f, 0.3f);
+    gl_draw_circle(0.0f, 0.0f, 12.0f, 24);
+    gl_set_color(0.0f, 1.0f, 1.0f);
+    gl_draw_circle_outline(0.0f, 0.0f, 12.0f, 2.0f, 24);
 
-            // Triangle: center → v0 → v1
-            particle_buffer[vert_idx++] = (Vertex){cx, cy, r, g, b, alpha};
-            particle_buffer[vert_idx++] = (Vertex){x0, y0, r, g, b, alpha};
-            particle_buffer[vert_idx++] = (Vertex){x1, y1, r, g, b, alpha};
-        }
-    }
+    // Medical cross in the centre
+    float cross_size = 5.0f;
+    gl_draw_line(-cross_size, 0.0f, cross_size, 0.0f, 1.5f);
+    gl_draw_line(0.0f, -cross_size, 0.0f, cross_size, 1.5f);
+}
 
-    // One draw call for all particles
-    draw_vertices(particle_buffer, total_verts, GL_TRIANGLES);
+static void gl_bake_missile_pickup(void) {
+    float size = 10.0f;
 
-/*#else
-    // Desktop: simple per‑particle draw (fast enough)
-    for (int i = 0; i < game->particle_count; i++) {
-        Particle *p = &game->particles[i];
-        if (!p->active) continue;
+    // Orange X inside an orange ring
+    gl_set_color(1.0f, 0.65f, 0.0f);
+    gl_draw_line(-size, -size, size, size, 2.5f);
+    gl_draw_line(size, -size, -size, size, 2.5f);
+    gl_draw_circle_outline(0.0f, 0.0f, size + 4.0f, 1.5f, 24);
 
-        double alpha = p->lifetime / p->max_lifetime;
-        gl_set_color_alpha(p->color[0], p->color[1], p->color[2], alpha);
-        gl_draw_circle(p->x, p->y, p->size, 6);
-    }
-#endif*/
+    // Yellow centre
+    gl_set_color(1.0f, 1.0f, 0.0f);
+    gl_draw_circle(0.0f, 0.0f, 2.5f, 12);
 }
 
+static void gl_bake_bomb_pickup(void) {
+    // Orange bomb with its fuse sticking out of the top
+    gl_set_color(1.0f, 0.7f, 0.0f);
+    gl_draw_circle(0.0f, 0.0f, 12.0f, 24);
+    gl_set_color(0.8f, 0.4f, 0.2f);
+    gl_draw_line(0.0f, -12.0f, 0.0f, -22.0f, 1.5f);
+}
 
-void draw_comet_buster_ship_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)cr;
-    (void)width;
-    (void)height;
-    
-    // ========== MAIN SHIP BODY ==========
-    double ship_size = 12.0;
-    float cos_a = cosf((float)game->ship_angle);
-    float sin_a = sinf((float)game->ship_angle);
-    
-    // Ship triangle points (in local coordinates):
-    // (12,0), (-12,-12), (-3.6,0), (-12,12), close back to (12,0)
-    double local_points[4][2] = {
-        {ship_size, 0},           // Front point
-        {-ship_size, -ship_size}, // Top left
-        {-ship_size * 0.3, 0},    // Side notch
-        {-ship_size, ship_size}   // Bottom left
-    };
-    
-    // Transform points to world coordinates
-    Vertex ship_verts[5];
-    for (int i = 0; i < 4; i++) {
-        float x = (float)local_points[i][0];
-        float y = (float)local_points[i][1];
-        
-        // Rotate by ship angle
-        float rotated_x = x * cos_a - y * sin_a;
-        float rotated_y = x * sin_a + y * cos_a;
-        
-        // Translate to ship position
-        rotated_x += (float)game->ship_x;
-        rotated_y += (float)game->ship_y;
-        
-        // Determine color with invulnerability flash
-        float r = 0.0f, g = 1.0f, b = 0.0f;
-        float a = 1.0f;
-        
-        if (game->invulnerability_time > 0) {
-            float flash = sinf((float)game->invulnerability_time * 10.0f) * 0.5f + 0.5f;
-            a = flash;
-        }
-        
-        ship_verts[i] = (Vertex){rotated_x, rotated_y, r, g, b, a};
-    }
-    
-    // Close the polygon by repeating first vertex (like cairo_close_path)
-    ship_verts[4] = ship_verts[0];
-    
-    // Draw outline only - NO FILL (just stroke like Cairo version)
-    gl_set_color(0.0f, 1.0f, 0.0f);
-    gl_set_line_width_cached(2.0f);
-    draw_vertices(ship_verts, 5, GL_LINE_STRIP);
-    
-    // ========== MUZZLE FLASH ==========
-    if (game->muzzle_flash_timer > 0) {
-        float alpha = (float)(game->muzzle_flash_timer / 0.1);
-        if (alpha > 1.0f) alpha = 1.0f;
-        
-        // Muzzle flash triangle: (12,0), (12+20,-5), (12+20,5), close
-        double muzzle_local[3][2] = {
-            {ship_size, 0},
-            {ship_size + 20.0, -5.0},
-            {ship_size + 20.0, 5.0}
-        };
-        
-        Vertex muzzle_verts[3];
-        for (int i = 0; i < 3; i++) {
-            float x = (float)muzzle_local[i][0];
-            float y = (float)muzzle_local[i][1];
-            
-            float rotated_x = x * cos_a - y * sin_a;
-            float rotated_y = x * sin_a + y * cos_a;
-            
-            rotated_x += (float)game->ship_x;
-            rotated_y += (float)game->ship_y;
-            
-            muzzle_verts[i] = (Vertex){rotated_x, rotated_y, 1.0f, 1.0f, 0.0f, alpha};
-        }
-        
-        gl_set_color_alpha(1.0f, 1.0f, 0.0f, alpha);
-        draw_vertices(muzzle_verts, 3, GL_TRIANGLE_FAN);
-    }
-    
-    // ========== BURNER/THRUSTER EFFECT ==========
-    if (game->burner_intensity > 0.01) {
-        // Flicker effect
-        float flicker = 0.7f + 0.3f * sinf((float)game->burner_intensity * 20.0f);
-        float effective_intensity = (float)game->burner_intensity * flicker;
-        
-        // Calculate speed for length multiplier
-        double speed = sqrt(game->ship_vx * game->ship_vx + game->ship_vy * game->ship_vy);
-        double length_mult = 1.0 + (speed / 150.0) * 0.5;
-        
-        double flame_length = 30.0 * effective_intensity * length_mult;
-        double flame_width = 8.0 * effective_intensity;
-        
-        // Main burner flame points (pointing backward from back of ship)
-        // Ship back is at x = -ship_size (-12), flame extends from there
-        double burner_local[4][2] = {
-            {-ship_size, -flame_width},                          // Top at back of ship
-            {-ship_size - flame_length, -flame_width * 0.3},    // Top tip of flame
-            {-ship_size - flame_length, flame_width * 0.3},     // Bottom tip of flame
-            {-ship_size, flame_width}                            // Bottom at back of ship
-        };
-        
-        Vertex burner_verts[4];
-        for (int i = 0; i < 4; i++) {
-            float x = (float)burner_local[i][0];
-            float y = (float)burner_local[i][1];
-            
-            float rotated_x = x * cos_a - y * sin_a;
-            float rotated_y = x * sin_a + y * cos_a;
-            
-            rotated_x += (float)game->ship_x;
-            rotated_y += (float)game->ship_y;
-            
-            // Flame color gradient: yellow -> orange -> red
-            float color_r = 1.0f;
-            float color_g = 0.7f * (1.0f - (float)i / 3.0f);  // Fade orange
-            float color_b = 0.0f;
-            
-            burner_verts[i] = (Vertex){rotated_x, rotated_y, color_r, color_g, color_b, effective_intensity * 0.7f};
-        }
-        
-        gl_set_color_alpha(1.0f, 0.7f, 0.0f, effective_intensity * 0.7f);
-        draw_vertices(burner_verts, 4, GL_TRIANGLE_FAN);
-    }
-    
-    // ========== SHIELD CIRCLE ==========
-    if (game->shield_health > 0) {
-        float shield_alpha = (float)game->shield_health / (float)game->max_shield_health;
-        
-        // Shield color: cyan when healthy, orange when medium, red when critical
-        float shield_r = 0.0f, shield_g = 1.0f, shield_b = 1.0f;
-        if (game->shield_health >= 2) {
-            shield_r = 0.0f; shield_g = 1.0f; shield_b = 1.0f;  // Cyan
-        } else if (game->shield_health >= 1) {
-            shield_r = 1.0f; shield_g = 0.8f; shield_b = 0.0f;  // Orange
-        } else {
-            shield_r = 1.0f; shield_g = 0.3f; shield_b = 0.3f;  // Red
-        }
-        
-        // Draw shield circle
-        gl_set_color_alpha(shield_r, shield_g, shield_b, shield_alpha * 0.6f);
-        gl_draw_circle_outline((float)game->ship_x, (float)game->ship_y, 28.0f, 2.5f, 24);
-        
-        // Draw shield segment pips
-        glLineWidth(1.5f);
-        double segment_angle = (2.0 * M_PI) / game->max_shield_health;
-        
-        for (int i = 0; i < game->shield_health; i++) {
-            double angle = (i * segment_angle) - (M_PI / 2.0);
-            double x1 = 24.0 * cos(angle);
-            double y1 = 24.0 * sin(angle);
-            double x2 = 32.0 * cos(angle);
-            double y2 = 32.0 * sin(angle);
-            
-            gl_draw_line((float)(game->ship_x + x1), (float)(game->ship_y + y1),
-                        (float)(game->ship_x + x2), (float)(game->ship_y + y2),
-                        1.5f);
-        }
-        
-        // Draw impact flash
-        if (game->shield_impact_timer > 0) {
-            float flash_alpha = (float)(game->shield_impact_timer / 0.2);
-            if (flash_alpha > 1.0f) flash_alpha = 1.0f;
-            
-            double impact_x = 28.0 * cos(game->shield_impact_angle);
-            double impact_y = 28.0 * sin(game->shield_impact_angle);
-            
-            // Bright white flash
-            gl_set_color_alpha(1.0f, 1.0f, 1.0f, flash_alpha * 0.8f);
-            gl_draw_circle((float)(game->ship_x + impact_x), (float)(game->ship_y + impact_y), 5.0f, 12);
-            
-            // Expanding rings
-            double ring_radius = 8.0 + (1.0 - flash_alpha) * 12.0;
-            gl_set_color_alpha(1.0f, 1.0f, 1.0f, flash_alpha * 0.4f);
-            gl_draw_circle_outline((float)(game->ship_x + impact_x), (float)(game->ship_y + impact_y), 
-                                  (float)ring_radius, 1.0f, 16);
-        }
-    }
+static void gl_bake_boss_body(void) {
+    // Large dark gray hull (the damage flash goes over it)
+    gl_set_color(0.3f, 0.3f, 0.4f);
+    gl_draw_circle(0.0f, 0.0f, 35.0f, 32);
 }
 
-void draw_comet_buster_boss_gl(CometBusterGame *game, BossShip *boss, void *cr, int width, int height) {
-    if (!boss || !boss->active) return;
-    (void)cr; (void)width; (void)height;
-    
+static void gl_bake_boss_detail(void) {
     double body_radius = 35.0;
-    
-    // Main body - large dark gray circle
-    gl_set_color(0.3f, 0.3f, 0.4f);
-    gl_draw_circle(boss->x, boss->y, (float)body_radius, 32);
-    
-    // Highlight if taking damage
-    if (boss->damage_flash_timer > 0) {
-        gl_set_color_alpha(1.0f, 0.5f, 0.5f, 0.7f);
-        gl_draw_circle(boss->x, boss->y, (float)body_radius, 32);
-    }
-    
+
     // Outer ring - metallic look
     gl_set_color_alpha(0.6f, 0.6f, 0.7f, 0.8f);
-    gl_draw_circle_outline(boss->x, boss->y, (float)body_radius, 2.5f, 32);
-    
-    // Draw rotating pattern on the boss (8 lines radiating)
+    gl_draw_circle_outline(0.0f, 0.0f, (float)body_radius, 2.5f, 32);
+
+    // Pattern of 8 lines radiating
     gl_set_color(0.8f, 0.8f, 0.9f);
     for (int i = 0; i < 8; i++) {
         double angle = (i * 2.0 * M_PI / 8.0);
-        double x1 = cos(angle) * 20.0;
-        double y1 = sin(angle) * 20.0;
-        double x2 = cos(angle) * 30.0;
-        double y2 = sin(angle) * 30.0;
-        
-        gl_draw_line((float)(boss->x + x1), (float)(boss->y + y1),
-                     (float)(boss->x + x2), (float)(boss->y + y2), 1.5f);
+        gl_draw_line((float)(cos(angle) * 20.0), (float)(sin(angle) * 20.0),
+                     (float)(cos(angle) * 30.0), (float)(sin(angle) * 30.0), 1.5f);
     }
-    
-    // Core/center glow - red pulsing
+
+    // Red core and the glow ring around it
     double core_radius = 8.0;
     gl_set_color(1.0f, 0.2f, 0.2f);
-    gl_draw_circle(boss->x, boss->y, (float)core_radius, 16);
-    
-    // Inner glow around core
+    gl_draw_circle(0.0f, 0.0f, (float)core_radius, 16);
     gl_set_color_alpha(1.0f, 0.3f, 0.3f, 0.6f);
-    gl_draw_circle_outline(boss->x, boss->y, (float)(core_radius + 3.0), 1.5f, 16);
-    
-    // Draw health bar above boss
-    double bar_width = 80.0;
-    double bar_height = 6.0;
-    double bar_x = boss->x - bar_width / 2.0;
-    double bar_y = boss->y - 50.0;
-    
-    // Background (gray)
-    gl_set_color(0.3f, 0.3f, 0.3f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height);
-    
-    // Health fill (red)
-    double health_ratio = (double)boss->health / boss->max_health;
-    gl_set_color(1.0f, 0.2f, 0.2f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)(bar_width * health_ratio), (float)bar_height);
-    
-    // Border (white)
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    gl_draw_rect_outline((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height, 1.0f);
-    
-    // Draw shield if active
-    if (boss->shield_active && boss->shield_health > 0) {
-        double shield_radius = 50.0;
-        double shield_ratio = (double)boss->shield_health / boss->max_shield_health;
-        
-        // Outer shield glow (pulsing)
-        float pulse_alpha = 0.3f + 0.1f * (float)sin(boss->shield_impact_timer * 10.0);
-        gl_set_color_alpha(0.0f, 0.8f, 1.0f, pulse_alpha);
-        gl_draw_circle(boss->x, boss->y, (float)shield_radius, 32);
-        
-        // Shield outline
-        gl_set_color_alpha(0.0f, 1.0f, 1.0f, 0.8f);
-        gl_draw_circle_outline(boss->x, boss->y, (float)shield_radius, 2.0f, 32);
-        
-        // Shield segments
-        gl_set_color(0.0f, 1.0f, 1.0f);
-        int num_segments = 12;
-        for (int i = 0; i < num_segments; i++) {
-            if (i < (int)(num_segments * shield_ratio)) {
-                double angle = (i * 2.0 * M_PI / num_segments);
-                double x1 = cos(angle) * (shield_radius - 3.0);
-                double y1 = sin(angle) * (shield_radius - 3.0);
-                double x2 = cos(angle) * (shield_radius + 3.0);
-                double y2 = sin(angle) * (shield_radius + 3.0);
-                
-                gl_draw_line((float)(boss->x + x1), (float)(boss->y + y1),
-                             (float)(boss->x + x2), (float)(boss->y + y2), 1.5f);
-            }
-        }
+    gl_draw_circle_outline(0.0f, 0.0f, (float)(core_radius + 3.0), 1.5f, 16);
+}
+
+static void gl_meshes_init(void) {
+    g_mesh_gl.program = 0;
+    g_mesh_gl.vao = 0;
+    g_mesh_gl.buffer = 0;
+    g_mesh_gl.ready = false;
+    g_mesh_gl.capturing = false;
+    g_mesh_gl.vertices.clear();
+    memset(g_mesh_gl.meshes, 0, sizeof(g_mesh_gl.meshes));
+
+    // Bake on the CPU first - gl_draw_mesh() can draw from the copy even
+    // if the shader is unavailable
+    float saved_color[4];
+    memcpy(saved_color, gl_state.color, sizeof(saved_color));
+    float saved_width = g_line_width;
+    GLBlendMode saved_blend = g_blend_mode;
+    g_blend_mode = BLEND_ALPHA;
+
+    gl_mesh_capture_begin();
+    gl_bake_player_ship();
+    gl_mesh_capture_end(MESH_PLAYER_SHIP);
+    for (int type = 0; type < 6; type++) {
+        gl_mesh_capture_begin();
+        gl_bake_enemy_ship(type);
+        gl_mesh_capture_end((GLMeshId)(MESH_ENEMY_SHIP + type));
+    }
+    gl_mesh_capture_begin();
+    gl_bake_ufo();
+    gl_mesh_capture_end(MESH_UFO);
+    gl_mesh_capture_begin();
+    gl_bake_canister();
+    gl_mesh_capture_end(MESH_CANISTER);
+    gl_mesh_capture_begin();
+    gl_bake_missile_pickup();
+    gl_mesh_capture_end(MESH_MISSILE_PICKUP);
+    gl_mesh_capture_begin();
+    gl_bake_bomb_pickup();
+    gl_mesh_capture_end(MESH_BOMB_PICKUP);
+    gl_mesh_capture_begin();
+    gl_bake_boss_body();
+    gl_mesh_capture_end(MESH_BOSS_BODY);
+    gl_mesh_capture_begin();
+    gl_bake_boss_detail();
+    gl_mesh_capture_end(MESH_BOSS_DETAIL);
+
+    memcpy(gl_state.color, saved_color, sizeof(saved_color));
+    g_line_width = saved_width;
+    g_blend_mode = saved_blend;
+
+    g_mesh_gl.program = create_program(mesh_vertex_shader, fragment_shader);
+    if (!g_mesh_gl.program || g_mesh_gl.vertices.empty()) {
+        SDL_Log("[Comet Busters] [GL] Mesh shader failed, drawing meshes on the CPU\n");
+        return;
+    }
+    g_mesh_gl.proj_loc = glGetUniformLocation(g_mesh_gl.program, "projection");
+
+    glGenBuffers(1, &g_mesh_gl.buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, g_mesh_gl.buffer);
+    glBufferData(GL_ARRAY_BUFFER, g_mesh_gl.vertices.size() * sizeof(PackedVertex),
+                 g_mesh_gl.vertices.data(), GL_STATIC_DRAW);
+
+    glGenVertexArrays(1, &g_mesh_gl.vao);
+    glBindVertexArray(g_mesh_gl.vao);
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(5);
+    glBindVertexArray(0);
+
+    gl_stream_init(&g_mesh_gl.instances, GL_ARRAY_BUFFER, 16 * 1024, "Mesh instance");
+    g_mesh_gl.ready = true;
+    SDL_Log("[Comet Busters] [GL] Baked %d meshes: %d vertices, %d KB\n", (int)MESH_COUNT,
+            (int)g_mesh_gl.vertices.size(),
+            (int)(g_mesh_gl.vertices.size() * sizeof(PackedVertex) / 1024));
+}
+
+// Transform a mesh on the CPU into the frame stream - used when the mesh
+// shader is unavailable
+static void gl_draw_mesh_geometry(const GLMesh &mesh, const MeshInstance &inst) {
+    GLuint *idx, base;
+    PackedVertex *out = gl_batch_append(GL_TRIANGLES, mesh.count, mesh.count, &idx, &base);
+    if (!out) return;
+
+    double s, c;
+    fm_sincos(inst.angle, &s, &c);
+    float cos_a = (float)c * inst.scale;
+    float sin_a = (float)s * inst.scale;
+    for (int i = 0; i < mesh.count; i++) {
+        const PackedVertex &v = g_mesh_gl.vertices[mesh.first + i];
+        out[i].x = inst.x + v.x * cos_a - v.y * sin_a;
+        out[i].y = inst.y + v.x * sin_a + v.y * cos_a;
+        out[i].color.r = (GLubyte)((v.color.r * inst.tint.r + 127) / 255);
+        out[i].color.g = (GLubyte)((v.color.g * inst.tint.g + 127) / 255);
+        out[i].color.b = (GLubyte)((v.color.b * inst.tint.b + 127) / 255);
+        out[i].color.a = (GLubyte)((v.color.a * inst.tint.a + 127) / 255);
+        out[i].edge[0] = (GLshort)(v.edge[0] * inst.scale);
+        out[i].edge[1] = (GLshort)(v.edge[1] * inst.scale);
+        idx[i] = base + i;
     }
-    
-    // Draw phase indicator
-    const char *phase_text = "";
-    float phase_r = 1.0f, phase_g = 1.0f, phase_b = 0.5f;
-    
-    if (boss->phase == 0) {
-        phase_text = phase_normal_text[game->current_language];
-        phase_r = 1.0f; phase_g = 1.0f; phase_b = 0.5f;  // Yellow
-    } else if (boss->phase == 1) {
-        phase_text = phase_shielded_text[game->current_language];
-        phase_r = 0.0f; phase_g = 1.0f; phase_b = 1.0f;  // Cyan
-    } else {
-        phase_text = phase_enraged_text[game->current_language];
-        phase_r = 1.0f; phase_g = 0.2f; phase_b = 0.2f;  // Red
+}
+
+void gl_draw_mesh(GLMeshId id, float x, float y, float angle, float scale, PackedColor tint) {
+    if (id < 0 || id >= MESH_COUNT) return;
+    const GLMesh &mesh = g_mesh_gl.meshes[id];
+    if (mesh.count <= 0) return;
+
+    MeshInstance inst;
+    inst.x = x;
+    inst.y = y;
+    inst.angle = angle;
+    inst.scale = scale;
+    inst.tint = tint;
+
+    if (!g_mesh_gl.ready) {
+        gl_draw_mesh_geometry(mesh, inst);
+        return;
     }
 
-    
-    gl_set_color(phase_r, phase_g, phase_b);
-    gl_draw_text_simple(phase_text, (int)(boss->x - 25), (int)(boss->y - 25), 10);
+    int first = (int)g_frame_meshes.size();
+    g_frame_meshes.push_back(inst);
+    g_frame_stats.submissions++;
+
+    if (!g_batches.empty()) {
+        GLBatch &last = g_batches.back();
+        if (last.kind == BATCH_MESHES && last.mesh == (int)id && last.blend == g_blend_mode) {
+            last.index_count++;
+            return;
+        }
+    }
+
+    GLBatch batch;
+    batch.kind = BATCH_MESHES;
+    batch.mode = GL_TRIANGLES;
+    batch.blend = g_blend_mode;
+    batch.first_index = first;
+    batch.index_count = 1;
+    batch.texture = 0;
+    batch.mesh = (int)id;
+    g_batches.push_back(batch);
 }
 
-void draw_spawn_queen_boss_gl(CometBusterGame *game, SpawnQueenBoss *queen, void *cr, int width, int height) {
-    if (!queen || !queen->active) return;
-    (void)cr; (void)width; (void)height;
-    
-    double major_axis = 70.0;
-    double minor_axis = 45.0;
-    int segments = 32;
-    
-    // Build vertices for the elliptical body
-    Vertex body_verts[32];
-    for (int i = 0; i < segments; i++) {
-        double angle = 2.0 * M_PI * i / segments;
-        float cos_a = (float)cos(angle);
-        float sin_a = (float)sin(angle);
-        
-        // Rotate the point around the boss center
-        float cos_rot = (float)cos(queen->rotation * M_PI / 180.0);
-        float sin_rot = (float)sin(queen->rotation * M_PI / 180.0);
-        
-        float x = cos_a * (float)major_axis;
-        float y = sin_a * (float)minor_axis;
-        
-        // Apply rotation
-        float rx = x * cos_rot - y * sin_rot;
-        float ry = x * sin_rot + y * cos_rot;
-        
-        body_verts[i] = {(float)queen->x + rx, (float)queen->y + ry, 0.7f, 0.3f, 0.8f, 1.0f};
+// ============================================================================
+// BACKGROUND LAYER
+// ============================================================================
+// Everything behind the game that only changes with the window size. The
+// grid used to be ~60 gl_draw_line() calls tessellated and streamed every
+// frame; now it is built into a static buffer when the size changes and
+// drawn with one glDrawArrays. Starfields or parallax layers that do not
+// move with the game belong here too.
+
+#define BACKGROUND_GRID_SPACING 50
+#define BACKGROUND_GRID_OVERSHOOT 50    // Lines run on past the right edge
+#define BACKGROUND_GRID_LINE_WIDTH 0.5f
+
+static struct {
+    GLuint buffer;
+    GLuint vao;
+    int width;
+    int height;
+    int vertex_count;
+} g_background_gl;
+
+// A straight stroke as two triangles, in the same format gl_stroke_path()
+// writes so the shared fragment shader anti-aliases it
+static void gl_background_line(std::vector<PackedVertex> &verts, float x1, float y1,
+                               float x2, float y2, float width, PackedColor color) {
+    float dx = x2 - x1, dy = y2 - y1;
+    float len = sqrtf(dx * dx + dy * dy);
+    if (len <= 0.0f) return;
+
+    float half = width * 0.5f;
+    float reach = half + GL_STROKE_FRINGE;
+    float nx = -dy / len * reach, ny = dx / len * reach;
+    GLshort edge_reach = (GLshort)(reach * 16.0f + 0.5f);
+    GLshort edge_half = (GLshort)fmaxf(half * 16.0f + 0.5f, 1.0f);
+
+    PackedVertex corners[4] = {
+        {x1 + nx, y1 + ny, color, {edge_reach, edge_half}},
+        {x1 - nx, y1 - ny, color, {(GLshort)-edge_reach, edge_half}},
+        {x2 + nx, y2 + ny, color, {edge_reach, edge_half}},
+        {x2 - nx, y2 - ny, color, {(GLshort)-edge_reach, edge_half}}
+    };
+    static const int order[6] = {0, 1, 2, 2, 1, 3};
+    for (int i = 0; i < 6; i++) verts.push_back(corners[order[i]]);
+}
+
+static void gl_background_build(int width, int height) {
+    std::vector<PackedVertex> verts;
+    PackedColor grid = gl_pack_color(0.1f, 0.15f, 0.35f, 1.0f);
+    float right = (float)(width + BACKGROUND_GRID_OVERSHOOT);
+
+    for (int i = 0; i <= width + BACKGROUND_GRID_OVERSHOOT; i += BACKGROUND_GRID_SPACING) {
+        gl_background_line(verts, (float)i, 0.0f, (float)i, (float)height,
+                           BACKGROUND_GRID_LINE_WIDTH, grid);
+    }
+    for (int i = 0; i <= height; i += BACKGROUND_GRID_SPACING) {
+        gl_background_line(verts, 0.0f, (float)i, right, (float)i,
+                           BACKGROUND_GRID_LINE_WIDTH, grid);
+    }
+
+    if (!g_background_gl.buffer) {
+        glGenBuffers(1, &g_background_gl.buffer);
+        glGenVertexArrays(1, &g_background_gl.vao);
+        glBindVertexArray(g_background_gl.vao);
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+        glEnableVertexAttribArray(5);
+        glBindVertexArray(0);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, g_background_gl.buffer);
+    glBufferData(GL_ARRAY_BUFFER, verts.size() * sizeof(PackedVertex),
+                 verts.empty() ? NULL : verts.data(), GL_STATIC_DRAW);
+
+    g_background_gl.width = width;
+    g_background_gl.height = height;
+    g_background_gl.vertex_count = (int)verts.size();
+    SDL_Log("[Comet Busters] [GL] Background layer built for %dx%d: %d vertices\n",
+            width, height, g_background_gl.vertex_count);
+}
+
+void gl_draw_background(int width, int height) {
+    if (!gl_state.program || width <= 0 || height <= 0) return;
+
+    if (!g_background_gl.buffer || width != g_background_gl.width ||
+        height != g_background_gl.height) {
+        gl_background_build(width, height);
     }
-    
-    // Draw filled magenta body
-    draw_vertices(body_verts, segments, GL_TRIANGLE_FAN);
-    
-    // Draw rotating darker oval pattern on the body (shows rotation)
-    gl_set_color_alpha(0.4f, 0.1f, 0.5f, 0.6f);
-    double pattern_major = 50.0;
-    double pattern_minor = 20.0;
-    Vertex pattern_verts[32];
-    for (int i = 0; i < segments; i++) {
-        double angle = 2.0 * M_PI * i / segments;
-        float cos_a = (float)cos(angle);
-        float sin_a = (float)sin(angle);
-        
-        // Rotate the pattern point
-        float cos_rot = (float)cos(queen->rotation * M_PI / 180.0);
-        float sin_rot = (float)sin(queen->rotation * M_PI / 180.0);
-        
-        float x = cos_a * (float)pattern_major;
-        float y = sin_a * (float)pattern_minor;
-        
-        // Apply rotation
-        float rx = x * cos_rot - y * sin_rot;
-        float ry = x * sin_rot + y * cos_rot;
-        
-        pattern_verts[i] = {(float)queen->x + rx, (float)queen->y + ry, 0.4f, 0.1f, 0.5f, 0.6f};
+    if (g_background_gl.vertex_count == 0) return;
+
+    // Keep painter's order with whatever was batched before it
+    gl_flush_batches();
+
+    gl_use_draw_program(gl_state.program, gl_state.proj_loc);
+    glBindVertexArray(g_background_gl.vao);
+
+    // Pointers are set every draw: without VAOs (Android) the next flush
+    // moves them back to the frame stream
+    gl_packed_vertex_arrays(g_background_gl.buffer, 0);
+
+    gl_apply_blend_mode(BLEND_ALPHA);
+    glDrawArrays(GL_TRIANGLES, 0, g_background_gl.vertex_count);
+    g_frame_stats.draw_calls++;
+}
+
+// ============================================================================
+// INSTANCED COMETS
+// ============================================================================
+// A comet's outline depends only on its size class and shape seed, so every
+// possible outline is baked once at init (unit radius) into a float texture.
+// Each frame the comets become one instance record apiece and each size
+// class is drawn with a single glDrawArraysInstanced: the vertex shader
+// fetches the two outline points of its segment, scales them by the radius,
+// applies the tumble and spin rotations on the GPU and puts out one corner
+// of the segment's stroke quad (the same edge distance the batch stroker
+// writes, so the outline is anti-aliased by the shared fragment shader).
+//
+// The outlines live in a texture rather than a vertex buffer because
+// every instance of a draw reads the same vertex range; picking a
+// different outline per instance needs either base-instance draws (not in
+// GLES 3.0) or a fetch by index like this.
+
+#define COMET_SHAPE_SEED_MIN (-996)     // shape_seed is (int)(speed*1000) % 997
+#define COMET_SHAPE_SEEDS 1993
+#define COMET_SHAPE_MAX_POINTS DRAWLIST_COMET_MAX_POINTS
+#define COMET_SHAPE_TEX_WIDTH 1024      // Must match the shader below
+#define COMET_SIZE_CLASSES (COMET_MEGA + 1)
+#define COMET_SHAPE_SLOTS 4             // Drawn size classes - COMET_SPECIAL has no outline
+
+// Per-instance data (32 bytes)
+typedef struct {
+    float x, y;
+    float angle;            // Primary rotation (radians)
+    float tumble;           // Secondary rotation applied first (radians)
+    float radius;
+    float first_texel;      // Outline start in the shape texture
+    float points;           // Outline point count
+    PackedColor color;
+} CometInstance;
+
+static struct {
+    GLuint program;
+    GLuint vao;
+    GLuint shape_tex;
+    GLint proj_loc;
+    GLint shapes_loc;
+    GLint half_width_loc;
+    GLStreamBuffer instances;
+    bool ready;
+} g_comet_gl;
+
+#ifndef ANDROID
+static const char *comet_vertex_shader =
+    "#version 330 core\n"
+#else
+static const char *comet_vertex_shader =
+    "#version 300 es\n"
+    "precision highp float;\n"
+    "precision highp int;\n"
+#endif
+    "layout(location = 2) in vec4 transform;\n"   // x, y, angle, tumble
+    "layout(location = 3) in vec3 shape;\n"       // radius, first texel, points
+    "layout(location = 4) in vec4 color;\n"
+    "uniform mat4 projection;\n"
+    "uniform highp sampler2D shapes;\n"
+    "uniform float halfWidth;\n"                   // Negative: no fringe, hard edge
+    "out vec4 vertexColor;\n"
+    "out vec2 vertexEdge;\n"
+    // x = along the segment, y = side of the centre line
+    "const vec2 corners[6] = vec2[6](vec2(0.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0),\n"
+    "                                vec2(0.0, -1.0), vec2(1.0, 1.0), vec2(0.0, 1.0));\n"
+    "vec2 outline_point(int index, vec2 tumble, vec2 spin) {\n"
+    "    int texel = int(shape.y) + index;\n"
+    "    vec2 p = texelFetch(shapes, ivec2(texel % 1024, texel / 1024), 0).xy * shape.x;\n"
+    "    p = vec2(p.x * tumble.x - p.y * tumble.y, p.x * tumble.y + p.y * tumble.x);\n"
+    "    p = vec2(p.x * spin.x - p.y * spin.y, p.x * spin.y + p.y * spin.x);\n"
+    "    return p + transform.xy;\n"
+    "}\n"
+    "void main() {\n"
+    "    int points = int(shape.z);\n"
+    "    int segment = gl_VertexID / 6;\n"
+    "    vertexColor = color;\n"
+    "    if (segment >= points) {\n"
+    "        vertexEdge = vec2(0.0);\n"
+    "        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n"   // Unused segment - clipped
+    "        return;\n"
+    "    }\n"
+    "    vec2 tumble = vec2(cos(transform.w), sin(transform.w));\n"
+    "    vec2 spin = vec2(cos(transform.z), sin(transform.z));\n"
+    "    vec2 a = outline_point(segment, tumble, spin);\n"
+    "    vec2 b = outline_point((segment + 1) % points, tumble, spin);\n"
+    "    vec2 dir = b - a;\n"
+    "    float len = length(dir);\n"
+    "    dir = len > 0.0 ? dir / len : vec2(1.0, 0.0);\n"
+    // Segments run on by a half width at both ends so the corners are
+    // covered without join geometry
+    "    vec2 corner = corners[gl_VertexID % 6];\n"
+    "    float half_width = abs(halfWidth);\n"
+    "    float reach = half_width + (halfWidth > 0.0 ? 1.0 : 0.0);\n"
+    "    vec2 p = mix(a - dir * half_width, b + dir * half_width, corner.x) +\n"
+    "             vec2(-dir.y, dir.x) * corner.y * reach;\n"
+    "    vertexEdge = vec2(corner.y * reach, halfWidth);\n"
+    "    gl_Position = VIEW_TRANSFORM(projection * vec4(p, 0.0, 1.0));\n"
+    "}\n";
+
+// Outline block of a size class in the shape texture, -1 if not drawn
+static int comet_shape_slot(int size) {
+    switch (size) {
+        case COMET_SMALL:  return 0;
+        case COMET_MEDIUM: return 1;
+        case COMET_LARGE:  return 2;
+        case COMET_MEGA:   return 3;
+        default:           return -1;
     }
-    draw_vertices(pattern_verts, segments, GL_TRIANGLE_FAN);
-    
-    // Draw cyan outline ring (elliptical, matching body rotation)
-    gl_set_color_alpha(0.0f, 1.0f, 1.0f, 0.7f);
-    Vertex outline_verts[32];
-    for (int i = 0; i < segments; i++) {
-        double angle = 2.0 * M_PI * i / segments;
-        float cos_a = (float)cos(angle);
-        float sin_a = (float)sin(angle);
-        
-        // Rotate the outline point
-        float cos_rot = (float)cos(queen->rotation * M_PI / 180.0);
-        float sin_rot = (float)sin(queen->rotation * M_PI / 180.0);
-        
-        float x = cos_a * (float)major_axis;
-        float y = sin_a * (float)minor_axis;
-        
-        // Apply rotation
-        float rx = x * cos_rot - y * sin_rot;
-        float ry = x * sin_rot + y * cos_rot;
-        
-        outline_verts[i] = {(float)queen->x + rx, (float)queen->y + ry, 0.0f, 1.0f, 1.0f, 0.7f};
+}
+
+static void gl_comets_init(void) {
+    memset(&g_comet_gl, 0, sizeof(g_comet_gl));
+
+    g_comet_gl.program = create_program(comet_vertex_shader, fragment_shader);
+    if (!g_comet_gl.program) {
+        SDL_Log("[Comet Busters] [GL] Comet shader failed, drawing comets on the CPU\n");
+        return;
+    }
+    g_comet_gl.proj_loc = glGetUniformLocation(g_comet_gl.program, "projection");
+    g_comet_gl.shapes_loc = glGetUniformLocation(g_comet_gl.program, "shapes");
+    g_comet_gl.half_width_loc = glGetUniformLocation(g_comet_gl.program, "halfWidth");
+
+    // Bake every outline: COMET_SHAPE_SLOTS x COMET_SHAPE_SEEDS blocks of
+    // COMET_SHAPE_MAX_POINTS texels, unit radius (1000 KB of RG32F)
+    int texels = COMET_SHAPE_SLOTS * COMET_SHAPE_SEEDS * COMET_SHAPE_MAX_POINTS;
+    int rows = (texels + COMET_SHAPE_TEX_WIDTH - 1) / COMET_SHAPE_TEX_WIDTH;
+    float *data = (float *)calloc((size_t)rows * COMET_SHAPE_TEX_WIDTH * 2, sizeof(float));
+    if (!data) return;
+
+    for (int size = 0; size < COMET_SIZE_CLASSES; size++) {
+        int block = comet_shape_slot(size);
+        if (block < 0) continue;
+        for (int s = 0; s < COMET_SHAPE_SEEDS; s++) {
+            int seed = COMET_SHAPE_SEED_MIN + s;
+            int num_points = drawlist_comet_points(size, seed);
+            if (num_points <= 0) continue;
+
+            double points[COMET_SHAPE_MAX_POINTS][2];
+            drawlist_comet_outline(points, num_points, 1.0, seed);
+
+            float *slot = data + ((block * COMET_SHAPE_SEEDS + s) * COMET_SHAPE_MAX_POINTS) * 2;
+            for (int p = 0; p < num_points; p++) {
+                slot[p * 2] = (float)points[p][0];
+                slot[p * 2 + 1] = (float)points[p][1];
+            }
+        }
     }
-    glLineWidth(2.5f);
-    draw_vertices(outline_verts, segments, GL_LINE_LOOP);
-    glLineWidth(1.0f);
-    
-    // Draw light cyan glow background (elliptical, matching body rotation)
-    gl_set_color_alpha(0.0f, 0.8f, 1.0f, 0.2f);
-    double glow_major = major_axis + 10.0;
-    double glow_minor = minor_axis + 10.0;
-    Vertex glow_verts[32];
-    for (int i = 0; i < segments; i++) {
-        double angle = 2.0 * M_PI * i / segments;
-        float cos_a = (float)cos(angle);
-        float sin_a = (float)sin(angle);
-        
-        // Rotate the glow point
-        float cos_rot = (float)cos(queen->rotation * M_PI / 180.0);
-        float sin_rot = (float)sin(queen->rotation * M_PI / 180.0);
-        
-        float x = cos_a * (float)glow_major;
-        float y = sin_a * (float)glow_minor;
-        
-        // Apply rotation
-        float rx = x * cos_rot - y * sin_rot;
-        float ry = x * sin_rot + y * cos_rot;
-        
-        glow_verts[i] = {(float)queen->x + rx, (float)queen->y + ry, 0.0f, 0.8f, 1.0f, 0.2f};
+
+    glGenTextures(1, &g_comet_gl.shape_tex);
+    glBindTexture(GL_TEXTURE_2D, g_comet_gl.shape_tex);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RG32F, COMET_SHAPE_TEX_WIDTH, rows, 0, GL_RG, GL_FLOAT, data);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    free(data);
+
+    // Instance attributes; the outline itself comes from gl_VertexID
+    gl_stream_init(&g_comet_gl.instances, GL_ARRAY_BUFFER, 16 * 1024, "Comet instance");
+    glGenVertexArrays(1, &g_comet_gl.vao);
+
+    g_comet_gl.ready = true;
+    SDL_Log("[Comet Busters] [GL] Baked comet outlines: %d shapes, %d KB\n",
+            COMET_SHAPE_SLOTS * COMET_SHAPE_SEEDS,
+            rows * COMET_SHAPE_TEX_WIDTH * 2 * (int)sizeof(float) / 1024);
+}
+
+// Draw list colours are already bytes
+static PackedColor gl_draw_color(DrawColor c) {
+    PackedColor packed = {c.r, c.g, c.b, c.a};
+    return packed;
+}
+
+// One instanced draw per size class for a run of DL_COMET commands.
+// Returns false if the CPU path has to draw them instead.
+static bool gl_draw_comets_instanced(const DrawCmd *cmds, int count) {
+    if (!g_comet_gl.ready) return false;
+
+    static std::vector<CometInstance> by_size[COMET_SIZE_CLASSES];
+    static float half_width[COMET_SIZE_CLASSES];
+    bool antialias = quality_current()->antialias;     // Sign of halfWidth
+    int total = 0;
+    for (int size = 0; size < COMET_SIZE_CLASSES; size++) by_size[size].clear();
+
+    for (int i = 0; i < count; i++) {
+        const DrawCmd *cmd = &cmds[i];
+        int size = cmd->id;
+        if (size >= COMET_SIZE_CLASSES) continue;
+
+        int block = comet_shape_slot(size);
+        if (block < 0) continue;
+
+        CometInstance inst;
+        inst.x = cmd->x;
+        inst.y = cmd->y;
+        inst.angle = cmd->a;
+        inst.tumble = cmd->b;
+        inst.radius = cmd->size;
+        inst.first_texel = (float)((block * COMET_SHAPE_SEEDS + (cmd->first - COMET_SHAPE_SEED_MIN)) *
+                                   COMET_SHAPE_MAX_POINTS);
+        inst.points = (float)cmd->count;
+        inst.color = gl_draw_color(cmd->color);
+        by_size[size].push_back(inst);
+        half_width[size] = cmd->width * (antialias ? 0.5f : -0.5f);
+        total++;
+    }
+    if (total == 0) return true;
+
+    // Keep painter's order with whatever was batched before the comets
+    gl_flush_batches();
+
+    gl_use_draw_program(g_comet_gl.program, g_comet_gl.proj_loc);
+    glUniform1i(gl_draw_uniform(g_comet_gl.shapes_loc), 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, g_comet_gl.shape_tex);
+    glBindVertexArray(g_comet_gl.vao);
+    gl_apply_blend_mode(BLEND_ALPHA);
+
+#ifdef ANDROID
+    // No VAOs - the batch stream's attributes would be read for every
+    // outline vertex
+    glDisableVertexAttribArray(0);
+    glDisableVertexAttribArray(1);
+    glDisableVertexAttribArray(5);
+#endif
+    gl_instance_arrays(true);
+
+    for (int size = 0; size < COMET_SIZE_CLASSES; size++) {
+        std::vector<CometInstance> &list = by_size[size];
+        if (list.empty()) continue;
+
+        GLintptr offset = gl_stream_upload(&g_comet_gl.instances, list.data(),
+                                           list.size() * sizeof(CometInstance));
+        g_frame_stats.upload_bytes += (int)(list.size() * sizeof(CometInstance));
+        glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(CometInstance),
+                              (void*)(offset + offsetof(CometInstance, x)));
+        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(CometInstance),
+                              (void*)(offset + offsetof(CometInstance, radius)));
+        glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CometInstance),
+                              (void*)(offset + offsetof(CometInstance, color)));
+
+        glUniform1f(gl_draw_uniform(g_comet_gl.half_width_loc), half_width[size]);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, COMET_SHAPE_MAX_POINTS * 6, (GLsizei)list.size());
+        g_frame_stats.draw_calls++;
     }
-    draw_vertices(glow_verts, segments, GL_TRIANGLE_FAN);
-    
-    // Spawn ports - 6 around equator with pulsing glow
-    double port_radius = 6.0;
-    double port_orbit = 50.0;
-    
-    // Determine port colors based on phase
-    float port_r, port_g, port_b;
-    if (queen->phase == 0) {
-        port_r = 1.0f; port_g = 0.2f; port_b = 0.2f;  // Red
-    } else if (queen->phase == 1) {
-        port_r = 1.0f; port_g = 0.5f; port_b = 0.8f;  // Magenta
-    } else {
-        port_r = 0.8f; port_g = 0.3f; port_b = 1.0f;  // Purple
+
+    gl_instance_arrays(false);
+#ifdef ANDROID
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(5);
+#endif
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return true;
+}
+
+// ============================================================================
+// GPU PARTICLES
+// ============================================================================
+// Explosion debris (see comet_buster_set_gpu_particles) lives in a pair of
+// GPU buffers instead of particles[]. Each frame the new ParticleSpawn
+// records are written into free slots, one transform feedback pass moves
+// every slot from one buffer to the other with the same rules as the CPU
+// kernel, and the live slots are drawn as disc sprites straight from that
+// buffer. Nothing is read back.
+//
+// GLES 3.0 has no geometry shaders, so the feedback pass cannot drop dead
+// particles; they stay in their slot with lifetime <= 0, are skipped by the
+// pass and clipped by the draw, and the slot is reused when the spawn
+// cursor comes round again. Both passes are skipped once every particle
+// that was spawned has run out.
+
+#define GPU_PARTICLE_SLOTS 8192
+#define GPU_PARTICLE_GRAVITY 100.0f     // Same as comet_buster_update_particles
+
+// One slot (32 bytes); also the transform feedback record
+typedef struct {
+    float x, y;
+    float vx, vy;
+    float lifetime;
+    float max_lifetime;
+    float size;
+    GLuint color;           // RGB8 in the low 24 bits
+} GpuParticle;
+
+static_assert(sizeof(GpuParticle) == 32, "GpuParticle must match the feedback varyings");
+
+static struct {
+    GLuint update_program;
+    GLuint draw_program;
+    GLint dt_loc;
+    GLint gravity_loc;
+    GLint proj_loc;
+    GLuint vao;
+    GLuint buffers[2];
+    int current;                // Buffer holding the latest state
+    int cursor;                 // Next slot for a spawn
+    float remaining;            // Longest lifetime left of anything spawned
+    unsigned int consumed_seq;  // Last particle_spawn_seq copied in
+    unsigned int epoch;         // particle_epoch the buffers belong to
+    double clock;               // particle_clock at the last step
+    bool resync;                // Another renderer drew meanwhile
+    bool ready;
+} g_gpu_particles;
+
+static bool g_gpu_particles_allowed = true;
+static bool g_gpu_particles_active = true;
+
+static const char *gpu_particle_update_shader =
+    SPRITE_SHADER_VERSION
+    "layout(location = 2) in vec4 motion;\n"      // x, y, vx, vy
+    "layout(location = 3) in vec3 life;\n"        // lifetime, max lifetime, size
+    "layout(location = 4) in uint color;\n"
+    "uniform float dt;\n"
+    "uniform float gravity;\n"
+    "out vec4 outMotion;\n"
+    "out vec3 outLife;\n"
+    "flat out uint outColor;\n"
+    "void main() {\n"
+    "    vec4 m = motion;\n"
+    "    float lifetime = life.x - dt;\n"
+    "    if (lifetime > 0.0) {\n"
+    "        m.xy += m.zw * dt;\n"
+    "        m.w += gravity * dt;\n"
+    "    }\n"
+    "    outMotion = m;\n"
+    "    outLife = vec3(lifetime, life.yz);\n"
+    "    outColor = color;\n"
+    "    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);\n"
+    "}\n";
+
+// GLES needs a fragment shader to link even with rasterizer discard on
+static const char *gpu_particle_null_fragment_shader =
+    SPRITE_SHADER_VERSION
+    "out vec4 FragColor;\n"
+    "void main() {\n"
+    "    FragColor = vec4(0.0);\n"
+    "}\n";
+
+// Draws with sprite_fragment_shader (disc, no trail)
+static const char *gpu_particle_draw_shader =
+    SPRITE_SHADER_VERSION
+    "layout(location = 2) in vec4 motion;\n"
+    "layout(location = 3) in vec3 life;\n"
+    "layout(location = 4) in uint color;\n"
+    "uniform mat4 projection;\n"
+    "out vec2 localPos;\n"
+    "out vec4 vertexColor;\n"
+    "flat out float spriteSize;\n"
+    "flat out int spriteKind;\n"
+    "flat out vec3 shapeParams;\n"
+    "const vec2 corners[6] = vec2[6](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0),\n"
+    "                                vec2(-1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0));\n"
+    "void main() {\n"
+    "    spriteKind = 0;\n"
+    "    spriteSize = life.z;\n"
+    "    shapeParams = vec3(0.0);\n"
+    "    localPos = corners[gl_VertexID] * (life.z + 1.0);\n"
+    "    if (life.x <= 0.0) {\n"
+    "        vertexColor = vec4(0.0);\n"
+    "        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);\n"   // Dead slot - clipped
+    "        return;\n"
+    "    }\n"
+    "    vec3 rgb = vec3(float(color & 255u), float((color >> 8) & 255u),\n"
+    "                    float((color >> 16) & 255u)) / 255.0;\n"
+    "    vertexColor = vec4(rgb, clamp(life.x / life.y, 0.0, 1.0));\n"
+    "    gl_Position = VIEW_TRANSFORM(projection * vec4(motion.xy + localPos, 0.0, 1.0));\n"
+    "}\n";
+
+void gl_set_gpu_particles_allowed(bool allowed) {
+    g_gpu_particles_allowed = allowed;
+}
+
+void gl_set_gpu_particles_active(bool active) {
+    if (active && !g_gpu_particles_active) g_gpu_particles.resync = true;
+    g_gpu_particles_active = active;
+    comet_buster_set_gpu_particles(active && g_gpu_particles.ready);
+}
+
+static void gl_gpu_particles_clear(void) {
+    std::vector<GpuParticle> empty(GPU_PARTICLE_SLOTS);
+    memset(empty.data(), 0, empty.size() * sizeof(GpuParticle));
+    for (int i = 0; i < 2; i++) {
+        glBindBuffer(GL_ARRAY_BUFFER, g_gpu_particles.buffers[i]);
+        glBufferData(GL_ARRAY_BUFFER, empty.size() * sizeof(GpuParticle), empty.data(), GL_DYNAMIC_COPY);
     }
-    
-    // Pulsing glow intensity
-    double glow_intensity = 0.5 + 0.5 * sin(queen->spawn_particle_timer * 5.0);
-    
-    for (int i = 0; i < 6; i++) {
-        double angle = 2.0 * M_PI * i / 6.0;
-        double px = cos(angle) * port_orbit;
-        double py = sin(angle) * port_orbit * 0.6;
-        
-        // Outer glow
-        gl_set_color_alpha(port_r, port_g, port_b, (float)(glow_intensity * 0.5));
-        gl_draw_circle(queen->x + px, queen->y + py, (float)(port_radius + 4.0), 16);
-        
-        // Port center (brighter)
-        gl_set_color(port_r, port_g, port_b);
-        gl_draw_circle(queen->x + px, queen->y + py, (float)port_radius, 16);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    g_gpu_particles.current = 0;
+    g_gpu_particles.cursor = 0;
+    g_gpu_particles.remaining = 0.0f;
+}
+
+static void gl_gpu_particles_init(void) {
+    memset(&g_gpu_particles, 0, sizeof(g_gpu_particles));
+    comet_buster_set_gpu_particles(false);
+
+    if (!g_gpu_particles_allowed) {
+        SDL_Log("[Comet Busters] [GL] GPU particles disabled, simulating particles on the CPU\n");
+        return;
+    }
+
+    static const char *varyings[] = { "outMotion", "outLife", "outColor" };
+    g_gpu_particles.update_program = link_program(gpu_particle_update_shader,
+                                                  gpu_particle_null_fragment_shader, varyings, 3, 1);
+    g_gpu_particles.draw_program = create_program(gpu_particle_draw_shader, sprite_fragment_shader);
+    if (!g_gpu_particles.update_program || !g_gpu_particles.draw_program) {
+        SDL_Log("[Comet Busters] [GL] Particle feedback shaders failed, simulating particles on the CPU\n");
+        if (g_gpu_particles.update_program) glDeleteProgram(g_gpu_particles.update_program);
+        if (g_gpu_particles.draw_program) glDeleteProgram(g_gpu_particles.draw_program);
+        memset(&g_gpu_particles, 0, sizeof(g_gpu_particles));
+        return;
+    }
+    g_gpu_particles.dt_loc = glGetUniformLocation(g_gpu_particles.update_program, "dt");
+    g_gpu_particles.gravity_loc = glGetUniformLocation(g_gpu_particles.update_program, "gravity");
+    g_gpu_particles.proj_loc = glGetUniformLocation(g_gpu_particles.draw_program, "projection");
+
+    glGenVertexArrays(1, &g_gpu_particles.vao);
+    glGenBuffers(2, g_gpu_particles.buffers);
+    gl_gpu_particles_clear();
+
+    g_gpu_particles.ready = true;
+    comet_buster_set_gpu_particles(g_gpu_particles_active);
+    SDL_Log("[Comet Busters] [GL] GPU particles: %d slots, %d KB per buffer\n",
+            GPU_PARTICLE_SLOTS, GPU_PARTICLE_SLOTS * (int)sizeof(GpuParticle) / 1024);
+}
+
+// Point locations 2-4 at a particle buffer: per vertex for the feedback
+// pass, per instance for the draw. Without VAOs (Android) the batch
+// stream's attributes are global state and would be read for every slot,
+// so they are switched off until gl_gpu_particles_unbind().
+static void gl_gpu_particles_bind(GLuint buffer, GLuint divisor) {
+    glBindVertexArray(g_gpu_particles.vao);
+#ifdef ANDROID
+    glDisableVertexAttribArray(0);
+    glDisableVertexAttribArray(1);
+    glDisableVertexAttribArray(5);
+#endif
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(GpuParticle),
+                          (void*)offsetof(GpuParticle, x));
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GpuParticle),
+                          (void*)offsetof(GpuParticle, lifetime));
+    glVertexAttribIPointer(4, 1, GL_UNSIGNED_INT, sizeof(GpuParticle),
+                           (void*)offsetof(GpuParticle, color));
+    for (int i = 2; i <= 4; i++) {
+        glEnableVertexAttribArray(i);
+        glVertexAttribDivisor(i, divisor);
     }
-    
-    // Damage flash overlay (elliptical, matching body rotation)
-    if (queen->damage_flash_timer > 0) {
-        gl_set_color_alpha(1.0f, 0.5f, 0.5f, 0.4f);
-        Vertex damage_verts[32];
-        for (int i = 0; i < segments; i++) {
-            double angle = 2.0 * M_PI * i / segments;
-            float cos_a = (float)cos(angle);
-            float sin_a = (float)sin(angle);
-            
-            // Rotate the damage overlay point
-            float cos_rot = (float)cos(queen->rotation * M_PI / 180.0);
-            float sin_rot = (float)sin(queen->rotation * M_PI / 180.0);
-            
-            float x = cos_a * (float)major_axis;
-            float y = sin_a * (float)minor_axis;
-            
-            // Apply rotation
-            float rx = x * cos_rot - y * sin_rot;
-            float ry = x * sin_rot + y * cos_rot;
-            
-            damage_verts[i] = {(float)queen->x + rx, (float)queen->y + ry, 1.0f, 0.5f, 0.5f, 0.4f};
+}
+
+static void gl_gpu_particles_unbind(void) {
+    gl_instance_arrays(false);
+#ifdef ANDROID
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(5);
+#endif
+}
+
+// Write records into the current buffer, oldest slots first
+static void gl_gpu_particles_append(const GpuParticle *records, int count) {
+    glBindBuffer(GL_ARRAY_BUFFER, g_gpu_particles.buffers[g_gpu_particles.current]);
+    while (count > 0) {
+        int n = GPU_PARTICLE_SLOTS - g_gpu_particles.cursor;
+        if (n > count) n = count;
+        glBufferSubData(GL_ARRAY_BUFFER, g_gpu_particles.cursor * sizeof(GpuParticle),
+                        n * sizeof(GpuParticle), records);
+        for (int i = 0; i < n; i++) {
+            if (records[i].lifetime > g_gpu_particles.remaining) {
+                g_gpu_particles.remaining = records[i].lifetime;
+            }
         }
-        draw_vertices(damage_verts, segments, GL_TRIANGLE_FAN);
-    }
-    
-    // Red pulsing core
-    double core_size = 12.0 + 3.0 * sin(queen->phase_timer * 3.0);
-    gl_set_color(1.0f, 0.2f, 0.2f);
-    gl_draw_circle(queen->x, queen->y, (float)core_size, 16);
-    
-    // Health bar above boss
-    double bar_width = 100.0;
-    double bar_height = 8.0;
-    double bar_x = queen->x - bar_width / 2.0;
-    double bar_y = queen->y - 70.0;
-    
-    // Health bar - Background
-    gl_set_color(0.2f, 0.2f, 0.2f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height);
-    
-    // Health fill
-    double health_ratio = (double)queen->health / queen->max_health;
-    gl_set_color(1.0f, 0.2f, 0.2f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)(bar_width * health_ratio), (float)bar_height);
-    
-    // Health bar border
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    gl_draw_rect_outline((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height, 1.0f);
-    
-    // Shield bar below health bar
-    double shield_y = bar_y + bar_height + 2.0;
-    
-    // Shield bar - Background
-    gl_set_color(0.2f, 0.2f, 0.2f);
-    gl_draw_rect_filled((float)bar_x, (float)shield_y, (float)bar_width, (float)bar_height);
-    
-    // Shield fill (cyan)
-    double shield_ratio = (double)queen->shield_health / queen->max_shield_health;
-    gl_set_color(0.0f, 1.0f, 1.0f);
-    gl_draw_rect_filled((float)bar_x, (float)shield_y, (float)(bar_width * shield_ratio), (float)bar_height);
-    
-    // Shield bar border
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    gl_draw_rect_outline((float)bar_x, (float)shield_y, (float)bar_width, (float)bar_height, 1.0f);
-    
-    // Phase indicator text
-    const char *phase_text = "";
-    float text_r = 1.0f, text_g = 0.5f, text_b = 0.0f;
-
-    if (queen->phase == 0) {
-        phase_text = queen_phase_recruiting_text[game->current_language];
-        text_r = 1.0f; text_g = 0.5f; text_b = 0.0f;  // Orange
-    } else if (queen->phase == 1) {
-        phase_text = queen_phase_aggressive_text[game->current_language];
-        text_r = 1.0f; text_g = 1.0f; text_b = 0.0f;  // Yellow
-    } else {
-        phase_text = queen_phase_desperate_text[game->current_language];
-        text_r = 1.0f; text_g = 0.0f; text_b = 0.0f;  // Red
+        records += n;
+        count -= n;
+        g_gpu_particles.cursor = (g_gpu_particles.cursor + n) % GPU_PARTICLE_SLOTS;
     }
+}
 
-    
-    gl_set_color(text_r, text_g, text_b);
-    gl_draw_text_simple(phase_text, (int)(queen->x - 35), (int)(queen->y + 75), 11);
+// One feedback pass: current buffer -> other buffer, which becomes current
+static void gl_gpu_particles_step(float dt) {
+    int src = g_gpu_particles.current;
+    int dst = 1 - src;
+
+    glUseProgram(g_gpu_particles.update_program);
+    glUniform1f(g_gpu_particles.dt_loc, dt);
+    glUniform1f(g_gpu_particles.gravity_loc, GPU_PARTICLE_GRAVITY);
+    gl_gpu_particles_bind(g_gpu_particles.buffers[src], 0);
+
+    // The update program is single-view, so it cannot run against a
+    // two-view framebuffer (nothing is rasterised either way)
+    if (g_multiview.active) glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, g_gpu_particles.buffers[dst]);
+    glBeginTransformFeedback(GL_POINTS);
+    glDrawArrays(GL_POINTS, 0, GPU_PARTICLE_SLOTS);
+    glEndTransformFeedback();
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glDisable(GL_RASTERIZER_DISCARD);
+    if (g_multiview.active) glBindFramebuffer(GL_FRAMEBUFFER, g_multiview.fbo);
+
+    gl_gpu_particles_unbind();
+    g_gpu_particles.current = dst;
+    g_gpu_particles.remaining -= dt;
+    g_frame_stats.draw_calls++;
 }
 
-void draw_void_nexus_boss_gl(CometBusterGame *game, BossShip *boss, void *cr, int width, int height) {
-    if (!boss || !boss->active) return;
-    (void)cr; (void)width; (void)height;
-    
-    if (boss->fragment_count == 0) {
-        // Draw main body - crystalline octagon with rotating rings
-        
-        // Outer energy ring (pulsing circle)
-        double pulse = 0.5 + 0.3 * sin(boss->rotation * M_PI / 180.0 * 0.1);
-        gl_set_color_alpha(0.2f, 0.8f, 1.0f, (float)pulse);
-        gl_draw_circle(boss->x, boss->y, (float)(40.0 + pulse * 5.0), 32);
-        
-        // Main crystalline body - octagon (8 sides)
-        gl_set_color(0.3f, 0.7f, 1.0f);  // Bright cyan
-        const int oct_sides = 8;
-        Vertex oct_verts[8];
-        double oct_radius = 30.0;
-        
-        for (int i = 0; i < oct_sides; i++) {
-            double angle = (i * 2.0 * M_PI / oct_sides) + (boss->rotation * M_PI / 180.0);
-            double x = cos(angle) * oct_radius;
-            double y = sin(angle) * oct_radius;
-            oct_verts[i] = {(float)(boss->x + x), (float)(boss->y + y), 0.3f, 0.7f, 1.0f, 1.0f};
-        }
-        draw_vertices(oct_verts, oct_sides, GL_TRIANGLE_FAN);
-        
-        // Draw octagon outline
-        gl_set_color(0.3f, 0.7f, 1.0f);
-        glLineWidth(2.0f);
-        draw_vertices(oct_verts, oct_sides, GL_LINE_LOOP);
-        glLineWidth(1.0f);
-        
-        // Core nucleus (bright white)
-        gl_set_color(1.0f, 1.0f, 1.0f);
-        gl_draw_circle(boss->x, boss->y, 6.0f, 16);
-        
-        // Damage flash overlay
-        if (boss->damage_flash_timer > 0) {
-            gl_set_color_alpha(1.0f, 0.5f, 0.5f, 0.6f);
-            gl_draw_circle(boss->x, boss->y, 35.0f, 32);
-        }
-        
-    } else {
-        // Draw fragments - smaller crystals (hexagons)
-        for (int i = 0; i < boss->fragment_count; i++) {
-            double frag_x = boss->fragment_positions[i][0];
-            double frag_y = boss->fragment_positions[i][1];
-            
-            double frag_pulse = 0.3 + 0.2 * sin((boss->rotation + i * 45) * M_PI / 180.0 * 0.1);
-            
-            // Fragment glow (pulsing circle)
-            gl_set_color_alpha(0.0f, 1.0f, 1.0f, (float)frag_pulse);
-            gl_draw_circle(frag_x, frag_y, (float)(25.0 + frag_pulse * 3.0), 16);
-            
-            // Fragment body - hexagon (6 sides)
-            gl_set_color(0.2f, 0.9f, 1.0f);
-            const int hex_sides = 6;
-            Vertex hex_verts[6];
-            double hex_radius = 20.0;
-            
-            for (int j = 0; j < hex_sides; j++) {
-                double angle = j * 2.0 * M_PI / hex_sides;
-                double x = cos(angle) * hex_radius;
-                double y = sin(angle) * hex_radius;
-                hex_verts[j] = {(float)(frag_x + x), (float)(frag_y + y), 0.2f, 0.9f, 1.0f, 1.0f};
-            }
-            draw_vertices(hex_verts, hex_sides, GL_TRIANGLE_FAN);
-            
-            // Draw hexagon outline
-            gl_set_color(0.2f, 0.9f, 1.0f);
-            glLineWidth(1.5f);
-            draw_vertices(hex_verts, hex_sides, GL_LINE_LOOP);
-            glLineWidth(1.0f);
-            
-            // Fragment core (white circle)
-            gl_set_color(1.0f, 1.0f, 1.0f);
-            gl_draw_circle(frag_x, frag_y, 4.0f, 16);
-            
-            // Fragment health indicator (red text)
-            if (boss->fragment_health[i] > 0) {
-                gl_set_color(1.0f, 0.0f, 0.0f);
-                char health_text[8];
-                snprintf(health_text, sizeof(health_text), "%d", boss->fragment_health[i]);
-                gl_draw_text_simple(health_text, (int)frag_x - 5, (int)frag_y + 3, 8);
-            }
+static GpuParticle gl_gpu_particle_from_spawn(const ParticleSpawn *s) {
+    GpuParticle p;
+    p.x = s->x;
+    p.y = s->y;
+    p.vx = s->vx;
+    p.vy = s->vy;
+    p.lifetime = s->lifetime;
+    p.max_lifetime = s->lifetime;
+    p.size = s->size;
+    p.color = (GLuint)gl_unit_to_byte(s->color[0]) |
+              ((GLuint)gl_unit_to_byte(s->color[1]) << 8) |
+              ((GLuint)gl_unit_to_byte(s->color[2]) << 16);
+    return p;
+}
+
+// Take the spawns the list carries that have not been consumed yet,
+// advance by the simulated time since the last call and draw. Returns
+// false if the GPU path is off.
+static bool gl_draw_gpu_particles(const DrawList *list) {
+    if (!g_gpu_particles.ready) return false;
+
+    if (list->particle_epoch != g_gpu_particles.epoch) {
+        // comet_buster_clear_particles() ran (new game, menu, splash):
+        // drop the old debris along with the spawn ring it came from
+        gl_gpu_particles_clear();
+        g_gpu_particles.consumed_seq = 0;
+        g_gpu_particles.clock = list->particle_clock;
+        g_gpu_particles.epoch = list->particle_epoch;
+    }
+    if (g_gpu_particles.resync) {
+        // Back from another renderer: the buffers hold debris frozen
+        // when it took over, and what spawned since went to the CPU
+        gl_gpu_particles_clear();
+        g_gpu_particles.consumed_seq = list->spawn_seq;
+        g_gpu_particles.clock = list->particle_clock;
+        g_gpu_particles.resync = false;
+    }
+
+    // The list holds spawns [first, spawn_seq); one drawn twice (stereo)
+    // or a list built for another view has nothing new
+    unsigned int seq = list->spawn_seq;
+    unsigned int first = seq - (unsigned int)list->spawns.size();
+    int behind = (int)(seq - g_gpu_particles.consumed_seq);
+    if (behind > (int)list->spawns.size()) {
+        g_gpu_particles.consumed_seq = first;
+    }
+
+    static std::vector<GpuParticle> fresh;
+    fresh.clear();
+    if (behind > 0) {
+        for (; g_gpu_particles.consumed_seq != seq; g_gpu_particles.consumed_seq++) {
+            // The quality governor's thinning, keyed on the spawn number
+            if (!drawlist_keep_particle(g_gpu_particles.consumed_seq, list->particle_density)) continue;
+            fresh.push_back(gl_gpu_particle_from_spawn(&list->spawns[g_gpu_particles.consumed_seq - first]));
         }
     }
-    
-    // Draw health bar
-    double bar_width = 100.0;
-    double bar_height = 8.0;
-    double bar_x = boss->x - bar_width / 2.0;
-    double bar_y = boss->y - 55.0;
-    
-    // Background
-    gl_set_color(0.2f, 0.2f, 0.2f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height);
-    
-    // Health fill (cyan)
-    double health_percent = (double)boss->health / boss->max_health;
-    if (health_percent < 0) health_percent = 0;
-    
-    gl_set_color(0.0f, 1.0f, 1.0f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)(bar_width * health_percent), (float)bar_height);
-    
-    // Border
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    gl_draw_rect_outline((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height, 1.0f);
-}
 
-void draw_harbinger_boss_gl(CometBusterGame *game, BossShip *boss, void *cr, int width, int height) {
-    if (!boss || !boss->active) return;
-    (void)cr; (void)width; (void)height;
-    
-    // Main body - dark cosmic entity with 6 points
-    double core_size = 35.0;
-    
-    // Outer aura (pulsing based on phase)
-    double aura_pulse = 0.3 + 0.4 * sin(boss->rotation * M_PI / 180.0 * 0.05);
-    if (boss->phase == 2) {
-        aura_pulse = 0.7;  // Brighter in frenzy
+    // Simulated time, so particles stop while the game is paused and a
+    // snapshot drawn twice (stereo, repeated frames) does not move them
+    double dt = list->particle_clock - g_gpu_particles.clock;
+    g_gpu_particles.clock = list->particle_clock;
+    if (dt < 0.0) dt = 0.0;
+    if (dt > 0.25) dt = 0.25;
+
+    if (!fresh.empty()) {
+        gl_gpu_particles_append(fresh.data(), (int)fresh.size());
     }
-    
-    gl_set_color_alpha((float)(0.4 + aura_pulse * 0.3), 0.0f, (float)(0.8 + aura_pulse * 0.2), 0.6f);
-    gl_draw_circle(boss->x, boss->y, (float)(core_size + 15), 32);
-    
-    // Core body - dark purple with 6 angular points
-    gl_set_color(0.3f, 0.0f, 0.7f);
-    const int hex_points = 6;
-    Vertex hex_verts[6];
-    
-    for (int i = 0; i < hex_points; i++) {
-        double angle = (i * 2.0 * M_PI / hex_points) + (boss->rotation * M_PI / 180.0);
-        double x = cos(angle) * core_size;
-        double y = sin(angle) * core_size;
-        hex_verts[i] = {(float)(boss->x + x), (float)(boss->y + y), 0.3f, 0.0f, 0.7f, 1.0f};
+    if (g_gpu_particles.remaining <= 0.0f) return true;
+
+    // Keep painter's order with whatever was batched before the particles
+    gl_flush_batches();
+
+    if (dt > 0.0) {
+        gl_gpu_particles_step((float)dt);
     }
-    
-    draw_vertices(hex_verts, hex_points, GL_TRIANGLE_FAN);
-    
-    // Magenta outline
-    gl_set_color(1.0f, 0.3f, 1.0f);
-    glLineWidth(2.0f);
-    draw_vertices(hex_verts, hex_points, GL_LINE_LOOP);
-    glLineWidth(1.0f);
-    
-    // Inner core (yellow center)
+
+    gl_use_draw_program(g_gpu_particles.draw_program, g_gpu_particles.proj_loc);
+    gl_apply_blend_mode(BLEND_ALPHA);
+    gl_gpu_particles_bind(g_gpu_particles.buffers[g_gpu_particles.current], 1);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, GPU_PARTICLE_SLOTS);
+    gl_gpu_particles_unbind();
+    g_frame_stats.draw_calls++;
+    return true;
+}
+
+#define GPU_PARTICLE_TEST_COUNT 256
+#define GPU_PARTICLE_TEST_STEPS 60
+
+bool gl_gpu_particles_self_test(void) {
+    if (!g_gpu_particles.ready) {
+        SDL_Log("[Comet Busters] [GL] GPU particle self-test: transform feedback path not available\n");
+        return false;
+    }
+
+    // A burst like comet_buster_spawn_explosion, with lifetimes half a step
+    // off the step boundaries so float and double agree on when each dies
+    const float dt = 1.0f / 60.0f;
+    static Particle cpu[GPU_PARTICLE_TEST_COUNT];
+    static GpuParticle gpu[GPU_PARTICLE_TEST_COUNT];
+    for (int i = 0; i < GPU_PARTICLE_TEST_COUNT; i++) {
+        double angle = 2.0 * M_PI * i / GPU_PARTICLE_TEST_COUNT;
+        double speed = 100.0 + (i % 13) * 9.0;
+        Particle *p = &cpu[i];
+        memset(p, 0, sizeof(Particle));
+        p->x = 960.0 + (i % 7) * 3.0;
+        p->y = 540.0 - (i % 5) * 4.0;
+        p->vx = (float)(cos(angle) * speed);
+        p->vy = (float)(sin(angle) * speed);
+        p->lifetime = 0.3 + (i % 8) * 0.15 + 0.5 * dt;
+        p->max_lifetime = p->lifetime;
+        p->size = 2.0 + (i % 4);
+        p->color[0] = (i % 3) / 2.0;
+        p->color[1] = 0.5;
+        p->color[2] = 1.0;
+        p->active = true;
+
+        ParticleSpawn s = {(float)p->x, (float)p->y, (float)p->vx, (float)p->vy,
+                           (float)p->lifetime, (float)p->size,
+                           {(float)p->color[0], (float)p->color[1], (float)p->color[2]}};
+        gpu[i] = gl_gpu_particle_from_spawn(&s);
+    }
+
+    gl_gpu_particles_clear();
+    gl_gpu_particles_append(gpu, GPU_PARTICLE_TEST_COUNT);
+    for (int step = 0; step < GPU_PARTICLE_TEST_STEPS; step++) {
+        gl_gpu_particles_step(dt);
+        simd_kernels.particles_integrate(cpu, GPU_PARTICLE_TEST_COUNT, dt, GPU_PARTICLE_GRAVITY);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, g_gpu_particles.buffers[g_gpu_particles.current]);
+    const GpuParticle *result = (const GpuParticle *)glMapBufferRange(
+        GL_ARRAY_BUFFER, 0, GPU_PARTICLE_TEST_COUNT * sizeof(GpuParticle), GL_MAP_READ_BIT);
+    if (!result) {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        SDL_Log("[Comet Busters] [GL] GPU particle self-test: FAIL (could not map the result)\n");
+        gl_gpu_particles_clear();
+        return false;
+    }
+
+    double max_error = 0.0;
+    int alive_mismatch = 0;
+    int alive = 0;
+    for (int i = 0; i < GPU_PARTICLE_TEST_COUNT; i++) {
+        bool cpu_alive = cpu[i].lifetime > 0;
+        bool gpu_alive = result[i].lifetime > 0.0f;
+        if (cpu_alive != gpu_alive) alive_mismatch++;
+        if (cpu_alive) alive++;
+        max_error = fmax(max_error, fabs(result[i].x - cpu[i].x));
+        max_error = fmax(max_error, fabs(result[i].y - cpu[i].y));
+    }
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    gl_gpu_particles_clear();
+
+    bool pass = alive_mismatch == 0 && max_error < 0.05;
+    SDL_Log("[Comet Busters] [GL] GPU particle self-test: %s (%d particles, %d steps, %d alive, "
+            "%d lifetime mismatches, max position error %.2e px)\n",
+            pass ? "PASS" : "FAIL", GPU_PARTICLE_TEST_COUNT, GPU_PARTICLE_TEST_STEPS,
+            alive, alive_mismatch, max_error);
+    return pass;
+}
+
+#define MULTIVIEW_TEST_SIZE 128
+
+// A little of everything the game draws: batched geometry, a stroke,
+// sprites, a baked mesh and glyphs
+static void gl_multiview_test_scene(void) {
+    gl_setup_2d_projection(MULTIVIEW_TEST_SIZE, MULTIVIEW_TEST_SIZE);
+    gl_set_color(0.2f, 0.6f, 1.0f);
+    gl_draw_rect_filled(10, 10, 40, 30);
     gl_set_color(1.0f, 1.0f, 0.0f);
-    gl_draw_circle(boss->x, boss->y, 8.0f, 16);
-    
-    // Draw laser charging indicator (phase 1)
-    if (boss->phase == 1) {
-        gl_set_color(1.0f, 0.5f, 1.0f);  // Light magenta
-        glLineWidth(2.0f);
-        
-        for (int i = 0; i < 4; i++) {
-            double laser_angle = boss->laser_angle * M_PI / 180.0 + (i * M_PI / 2.0);
-            double x = cos(laser_angle) * 40.0;
-            double y = sin(laser_angle) * 40.0;
-            
-            // Draw line from center outward
-            Vertex laser_verts[2] = {
-                {(float)boss->x, (float)boss->y, 1.0f, 0.5f, 1.0f, 1.0f},
-                {(float)(boss->x + x), (float)(boss->y + y), 1.0f, 0.5f, 1.0f, 1.0f}
-            };
-            draw_vertices(laser_verts, 2, GL_LINES);
+    gl_draw_line(10, 100, 110, 60, 2.0f);
+    gl_draw_disc(96, 28, 12);
+    gl_draw_mesh(MESH_PLAYER_SHIP, 64, 64, 0.5f, 1.5f, gl_pack_color(1.0f, 1.0f, 1.0f, 1.0f));
+    gl_set_color(1.0f, 0.5f, 0.0f);
+    gl_draw_text_simple("VR", 20, 120, 16);
+    gl_flush_batches();
+}
+
+bool gl_multiview_self_test(void) {
+#ifdef ANDROID
+    SDL_Log("[Comet Busters] [GL] Multiview self-test: not available on GLES\n");
+    return false;
+#else
+    const int size = MULTIVIEW_TEST_SIZE;
+    const int pixels = size * size * 4;
+    bool multiview = gl_multiview_supported();
+
+    GLint previous_fbo = 0;
+    GLint viewport[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_fbo);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    Mat4 screen_projection = gl_state.projection;
+
+    // Two texture arrays with a layer per eye, as an OpenXR swapchain
+    // with arraySize 2 hands them out: one drawn in a single multiview
+    // pass, one an eye at a time through a framebuffer per layer (the
+    // path taken without OVR_multiview2)
+    GLuint layers[2] = {0, 0}, fbos[3] = {0, 0, 0};
+    glGenTextures(2, layers);
+    for (int t = 0; t < 2; t++) {
+        glBindTexture(GL_TEXTURE_2D_ARRAY, layers[t]);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, size, size, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    glGenFramebuffers(3, fbos);
+    bool eyes_complete = true;
+    for (int eye = 0; eye < 2; eye++) {
+        glBindFramebuffer(GL_FRAMEBUFFER, fbos[1 + eye]);
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, layers[1], 0, eye);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) eyes_complete = false;
+    }
+    bool complete = false;
+    if (multiview) {
+        glBindFramebuffer(GL_FRAMEBUFFER, fbos[0]);
+        glFramebufferTextureMultiviewOVR(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, layers[0], 0, 0, 2);
+        complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    // Different per-eye transforms, so a pass that ignored the view
+    // index would not match
+    Mat4 eyes[2] = { mat4_identity(), mat4_identity() };
+    eyes[0].m[12] = -0.2f;
+    eyes[1].m[0] = 0.9f;
+    eyes[1].m[12] = 0.25f;
+
+    glViewport(0, 0, size, size);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+    // One eye at a time, each into its own layer
+    for (int eye = 0; eye < 2 && eyes_complete; eye++) {
+        glBindFramebuffer(GL_FRAMEBUFFER, fbos[1 + eye]);
+        glClear(GL_COLOR_BUFFER_BIT);
+        gl_set_view_transforms(eyes[eye].m, 1);
+        gl_multiview_test_scene();
+    }
+
+    bool drawn = false;
+    if (complete) {
+        gl_set_view_transforms(eyes[0].m, 2);
+        if (gl_begin_multiview(fbos[0])) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            gl_multiview_test_scene();
+            gl_end_multiview();
+            drawn = true;
         }
-        glLineWidth(1.0f);
     }
-    
-    // Gravity well effect (phase 2 - visual ripples)
-    if (boss->phase == 2 && boss->gravity_well_strength > 0) {
-        gl_set_color_alpha(0.0f, 1.0f, 0.8f, 0.3f);
-        glLineWidth(1.5f);
-        double ripple_size = 20.0 + 10.0 * sin(boss->rotation * M_PI / 180.0 * 0.1);
-        
-        Vertex ripple_verts[32];
-        for (int i = 0; i < 32; i++) {
-            double angle = 2.0 * M_PI * i / 32;
-            double x = cos(angle) * ripple_size;
-            double y = sin(angle) * ripple_size;
-            ripple_verts[i] = {(float)(boss->x + x), (float)(boss->y + y), 0.0f, 1.0f, 0.8f, 0.3f};
+    gl_set_view_transforms(NULL, 0);
+
+    std::vector<GLubyte> stereo(pixels * 2), single(pixels * 2);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, layers[1]);
+    glGetTexImage(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, GL_UNSIGNED_BYTE, single.data());
+    if (drawn) {
+        glBindTexture(GL_TEXTURE_2D_ARRAY, layers[0]);
+        glGetTexImage(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, GL_UNSIGNED_BYTE, stereo.data());
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)previous_fbo);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    glDeleteFramebuffers(3, fbos);
+    glDeleteTextures(2, layers);
+    gl_state.projection = screen_projection;
+
+    // Per-eye layers: both lit and different. Eyes that shared one layer
+    // would leave the other black.
+    int eye_lit[2] = {0, 0}, eye_difference = 0;
+    for (int i = 0; i < pixels * 2; i += 4) {
+        if (single[i] | single[i + 1] | single[i + 2]) eye_lit[i / pixels]++;
+        if (i < pixels && memcmp(&single[i], &single[i + pixels], 4) != 0) eye_difference++;
+    }
+    bool per_eye = eyes_complete && eye_lit[0] > 0 && eye_lit[1] > 0 && eye_difference > 0;
+    SDL_Log("[Comet Busters] [GL] Multiview self-test: per-eye layers %s (%d / %d lit, %d pixels differ)\n",
+            per_eye ? "PASS" : "FAIL", eye_lit[0], eye_lit[1], eye_difference);
+
+    // Without OVR_multiview2 the per-eye layers are the stereo path
+    if (!multiview) {
+        SDL_Log("[Comet Busters] [GL] Multiview self-test: OVR_multiview2 not supported, per-eye only\n");
+        return per_eye;
+    }
+    if (!drawn) {
+        SDL_Log("[Comet Busters] [GL] Multiview self-test: FAIL (%s)\n",
+                complete ? "no two-view programs" : "framebuffer incomplete");
+        return false;
+    }
+
+    // Rasterisation is the same either way, so allow only rounding in
+    // the blend
+    int mismatched = 0, lit = 0;
+    eye_difference = 0;
+    for (int i = 0; i < pixels * 2; i += 4) {
+        bool differs = false;
+        for (int c = 0; c < 3; c++) {
+            if (abs((int)stereo[i + c] - (int)single[i + c]) > 1) differs = true;
         }
-        draw_vertices(ripple_verts, 32, GL_LINE_LOOP);
-        glLineWidth(1.0f);
-    }
-    
-    // Damage flash overlay
-    if (boss->damage_flash_timer > 0) {
-        gl_set_color_alpha(1.0f, 0.2f, 0.2f, 0.6f);
-        gl_draw_circle(boss->x, boss->y, (float)core_size, 32);
+        if (differs) mismatched++;
+        if (stereo[i] | stereo[i + 1] | stereo[i + 2]) lit++;
+        if (i < pixels && memcmp(&stereo[i], &stereo[i + pixels], 4) != 0) eye_difference++;
     }
-    
-    // Draw health bar
-    double bar_width = 100.0;
-    double bar_height = 8.0;
-    double bar_x = boss->x - bar_width / 2.0;
-    double bar_y = boss->y - 55.0;
-    
-    // Background
-    gl_set_color(0.2f, 0.2f, 0.2f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height);
-    
-    // Health fill
-    double health_percent = (double)boss->health / boss->max_health;
-    if (health_percent < 0) health_percent = 0;
-    
-    gl_set_color(1.0f, 0.0f, 1.0f);  // Magenta
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)(bar_width * health_percent), (float)bar_height);
-    
-    // Border
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    gl_draw_rect_outline((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height, 1.0f);
+
+    bool pass = per_eye && mismatched == 0 && lit > 0 && eye_difference > 0;
+    SDL_Log("[Comet Busters] [GL] Multiview self-test: %s (%dx%d x 2 views, %d lit, "
+            "%d pixels differ between eyes, %d mismatched against per-eye passes)\n",
+            pass ? "PASS" : "FAIL", size, size, lit, eye_difference, mismatched);
+    return pass;
+#endif
 }
 
-void draw_star_vortex_boss_gl(BossShip *boss, void *cr, int width, int height) {
-    if (!boss || !boss->active) return;
-    (void)cr; (void)width; (void)height;
-    
-    // Draw a 6-pointed star with phase-based colors
-    int num_points = 6;
-    double outer_radius = 50.0;
-    double inner_radius = 25.0;
-    
-    // Star color (shifts based on phase)
-    float r = 1.0f, g = 0.6f, b = 0.0f;  // Orange by default
-    if (boss->phase == 1) {
-        r = 1.0f; g = 0.3f; b = 0.3f;  // Red for Phase 1
-    } else if (boss->phase == 2) {
-        r = 1.0f; g = 1.0f; b = 0.0f;  // Yellow for Phase 2
-    }
-    
-    // Draw the star shape with alternating inner/outer points
-    const int star_vertices = num_points * 2;
-    Vertex star_verts[12];
-    
-    for (int i = 0; i < star_vertices; i++) {
-        double angle = (i * M_PI / num_points) + (boss->rotation * M_PI / 180.0);
-        double radius = (i % 2 == 0) ? outer_radius : inner_radius;
-        double x = cos(angle) * radius;
-        double y = sin(angle) * radius;
-        star_verts[i] = {(float)(boss->x + x), (float)(boss->y + y), r, g, b, 1.0f};
-    }
-    
-    // Fill star
-    draw_vertices(star_verts, star_vertices, GL_TRIANGLE_FAN);
-    
-    // Outline (darker shade)
-    gl_set_color(r * 0.5f, g * 0.5f, b * 0.5f);
-    glLineWidth(2.0f);
-    draw_vertices(star_verts, star_vertices, GL_LINE_LOOP);
-    glLineWidth(1.0f);
-    
-    // Damage flash (white highlight)
-    if (boss->damage_flash_timer > 0) {
-        gl_set_color_alpha(1.0f, 1.0f, 1.0f, (float)boss->damage_flash_timer);
-        gl_draw_circle(boss->x, boss->y, (float)(outer_radius * 1.2), 32);
+// ============================================================================
+// DRAW LIST BACKEND
+// ============================================================================
+// See cometbuster_drawlist.h. Shapes come from the baked meshes, comets
+// from the baked outlines, debris from the GPU particle buffers.
+// Lines, paths and rectangles - and comets and circles when their shaders
+// are unavailable - are the CPU work left at replay: each is stroked or
+// filled into vertices. When a list has enough of them they are all
+// tessellated up front, in slices on the job system, each slice into its
+// own GLTessSegment. The replay then walks the commands in order and
+// copies each one's vertices into the frame stream where it would have
+// drawn them, so vertices, indices and batches match a serial replay.
+
+#define GL_TESS_SLICE 32                // Geometry commands per job, at least
+#define GL_TESS_MAX_SLICES 64           // Bigger lists get bigger slices
+#define GL_TESS_PARALLEL_MIN 96         // Fewer geometry commands: tessellate inline
+
+static const GLMeshId g_shape_meshes[DL_SHAPE_COUNT] = {
+    MESH_PLAYER_SHIP,
+    (GLMeshId)(MESH_ENEMY_SHIP + 0), (GLMeshId)(MESH_ENEMY_SHIP + 1), (GLMeshId)(MESH_ENEMY_SHIP + 2),
+    (GLMeshId)(MESH_ENEMY_SHIP + 3), (GLMeshId)(MESH_ENEMY_SHIP + 4), (GLMeshId)(MESH_ENEMY_SHIP + 5),
+    MESH_UFO,
+    MESH_CANISTER,
+    MESH_MISSILE_PICKUP,
+    MESH_BOMB_PICKUP,
+    MESH_BOSS_BODY,
+    MESH_BOSS_DETAIL
+};
+
+static void gl_set_draw_color(DrawColor c) {
+    gl_set_color_alpha(c.r / 255.0f, c.g / 255.0f, c.b / 255.0f, c.a / 255.0f);
+}
+
+// Commands whose vertices are built on the CPU
+static bool gl_is_tess_cmd(const DrawCmd *cmd) {
+    switch (cmd->type) {
+        case DL_LINE:
+        case DL_PATH:
+        case DL_RECT:
+            return true;
+        case DL_CIRCLE:
+            return !g_sprite_gl.ready;
+        case DL_COMET:
+            return !g_comet_gl.ready;
+        default:
+            return false;
     }
-    
-    // Shield visualization (if active)
-    if (boss->shield_active && boss->shield_health > 0) {
-        double shield_ratio = (double)boss->shield_health / boss->max_shield_health;
-        gl_set_color_alpha(0.2f, 0.8f, 1.0f, (float)(shield_ratio * 0.6));
-        glLineWidth(3.0f);
-        
-        Vertex shield_verts[32];
-        for (int i = 0; i < 32; i++) {
-            double angle = 2.0 * M_PI * i / 32;
-            double x = cos(angle) * (outer_radius + 10.0);
-            double y = sin(angle) * (outer_radius + 10.0);
-            shield_verts[i] = {(float)(boss->x + x), (float)(boss->y + y), 0.2f, 0.8f, 1.0f, (float)(shield_ratio * 0.6)};
+}
+
+// Colour and width come from the command, never from gl_state or the
+// current line width, so this is safe on any thread
+static void gl_tess_cmd(const DrawList *list, const DrawCmd *cmd) {
+    static const GLushort quad_indices[6] = {0, 1, 2, 0, 2, 3};
+    static thread_local std::vector<PackedVertex> verts;
+    PackedColor color = gl_draw_color(cmd->color);
+
+    switch (cmd->type) {
+        case DL_LINE: {
+            PackedVertex line[2] = {
+                {cmd->x, cmd->y, color},
+                {cmd->a, cmd->b, color}
+            };
+            gl_stroke_lines(line, NULL, 2, GL_LINES, cmd->width);
+            break;
+        }
+        case DL_RECT: {
+            PackedVertex quad[4] = {
+                {cmd->x, cmd->y, color},
+                {cmd->x + cmd->a, cmd->y, color},
+                {cmd->x + cmd->a, cmd->y + cmd->b, color},
+                {cmd->x, cmd->y + cmd->b, color}
+            };
+            if (cmd->flags & DL_FILL) {
+                draw_packed_indexed(quad, 4, quad_indices, 6, GL_TRIANGLES);
+            } else {
+                gl_stroke_lines(quad, NULL, 4, GL_LINE_LOOP, cmd->width);
+            }
+            break;
+        }
+        case DL_PATH: {
+            const DrawPoint *points = &list->points[cmd->first];
+            int count = cmd->count;
+            verts.resize(count + 1);
+            for (int i = 0; i < count; i++) {
+                verts[i].x = points[i].x;
+                verts[i].y = points[i].y;
+                verts[i].color = (cmd->flags & DL_POINT_COLORS) ? gl_draw_color(points[i].color) : color;
+                verts[i].edge[0] = verts[i].edge[1] = 0;
+            }
+
+            if (cmd->flags & DL_FILL) {
+                draw_packed_vertices(verts.data(), count, GL_TRIANGLE_FAN);
+                break;
+            }
+
+            // Repeating the first point closes the stroke with a proper join
+            if (cmd->flags & DL_CLOSED) {
+                verts[count++] = verts[0];
+            }
+            gl_stroke_lines(verts.data(), NULL, count, GL_LINE_STRIP, cmd->width);
+            break;
+        }
+        case DL_CIRCLE: {
+            int segments = gl_sdf_segments(cmd->size);
+            float stack_xy[(GL_CIRCLE_STACK_SEGMENTS + 1) * 2];
+            float *xy = gl_circle_rim(cmd->x, cmd->y, cmd->size, segments, stack_xy);
+
+            if (cmd->flags & DL_FILL) {
+                // Fan from the centre round the closed rim
+                verts.resize(segments + 2);
+                verts[0] = (PackedVertex){cmd->x, cmd->y, color};
+                for (int i = 0; i <= segments; i++) {
+                    verts[i + 1] = (PackedVertex){xy[i * 2], xy[i * 2 + 1], color};
+                }
+                draw_packed_vertices(verts.data(), segments + 2, GL_TRIANGLE_FAN);
+            } else {
+                // The rim's closing point repeats the first one - a loop closes itself
+                verts.resize(segments);
+                for (int i = 0; i < segments; i++) {
+                    verts[i] = (PackedVertex){xy[i * 2], xy[i * 2 + 1], color};
+                }
+                gl_stroke_lines(verts.data(), NULL, segments, GL_LINE_LOOP, cmd->width);
+            }
+            if (xy != stack_xy) free(xy);
+            break;
+        }
+        case DL_COMET: {
+            // The outline stroked on the CPU, for when the instanced path is off
+            double points[COMET_SHAPE_MAX_POINTS][2];
+            PackedVertex outline[COMET_SHAPE_MAX_POINTS];
+            int count = cmd->count < COMET_SHAPE_MAX_POINTS ? cmd->count : COMET_SHAPE_MAX_POINTS;
+            drawlist_comet_outline(points, count, cmd->size, cmd->first);
+
+            // Tumble first, then the spin, for a 3D-ish roll
+            float cos_a = cosf(cmd->a), sin_a = sinf(cmd->a);
+            float cos_t = cosf(cmd->b), sin_t = sinf(cmd->b);
+            for (int j = 0; j < count; j++) {
+                float x = (float)points[j][0];
+                float y = (float)points[j][1];
+                float x_tumble = x * cos_t - y * sin_t;
+                float y_tumble = x * sin_t + y * cos_t;
+                outline[j].x = x_tumble * cos_a - y_tumble * sin_a + cmd->x;
+                outline[j].y = x_tumble * sin_a + y_tumble * cos_a + cmd->y;
+                outline[j].color = color;
+                outline[j].edge[0] = outline[j].edge[1] = 0;
+            }
+            // Line loop closes the outline without repeating the first vertex
+            gl_stroke_lines(outline, NULL, count, GL_LINE_LOOP, cmd->width);
+            break;
         }
-        draw_vertices(shield_verts, 32, GL_LINE_LOOP);
-        glLineWidth(1.0f);
+        default:
+            break;
     }
-    
-    // Draw health bar
-    double bar_width = 60.0;
-    double bar_height = 8.0;
-    double bar_x = boss->x - bar_width / 2.0;
-    double bar_y = boss->y - 50.0;
-    
-    // Background
-    gl_set_color_alpha(0.2f, 0.2f, 0.2f, 0.8f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height);
-    
-    // Health fill (green)
-    double health_ratio = (double)boss->health / boss->max_health;
-    gl_set_color(0.0f, 1.0f, 0.0f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)(bar_width * health_ratio), (float)bar_height);
-    
-    // Border
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    gl_draw_rect_outline((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height, 1.0f);
 }
 
-void draw_singularity_boss_gl(CometBusterGame *game, BossShip *boss, void *cr, int width, int height) {
-    if (!boss || !boss->active) return;
-    (void)cr; (void)width; (void)height;
-    
-    // Determine phase for visual effects
-    int phase = boss->phase;
-    
-    // Main black hole body (grows larger in later phases)
-    double core_radius = 60.0;
-    if (phase >= 2) core_radius = 80.0;
-    
-    // Dark center
-    gl_set_color(0.1f, 0.05f, 0.15f);
-    gl_draw_circle(boss->x, boss->y, (float)core_radius, 32);
-    
-    // Outer event horizon glow (cyan, pulsing)
-    double glow_intensity = 0.2 + 0.3 * sin(boss->rotation * M_PI / 180.0 * 0.1);
-    gl_set_color_alpha(0.2f, 0.8f, 1.0f, (float)glow_intensity);
-    glLineWidth(3.0f);
-    
-    Vertex event_horizon[32];
-    for (int i = 0; i < 32; i++) {
-        double angle = 2.0 * M_PI * i / 32;
-        double x = cos(angle) * (core_radius + 15);
-        double y = sin(angle) * (core_radius + 15);
-        event_horizon[i] = {(float)(boss->x + x), (float)(boss->y + y), 0.2f, 0.8f, 1.0f, (float)glow_intensity};
-    }
-    draw_vertices(event_horizon, 32, GL_LINE_LOOP);
-    glLineWidth(1.0f);
-    
-    // Inner event horizon rings (3 concentric rings)
-    for (int ring = 1; ring <= 3; ring++) {
-        double ring_radius = core_radius - (ring * 8);
-        double ring_intensity = 0.3 - ring * 0.08;
-        
-        gl_set_color_alpha(0.2f, 0.8f, 1.0f, (float)ring_intensity);
-        glLineWidth(1.5f);
-        
-        Vertex ring_verts[32];
-        for (int i = 0; i < 32; i++) {
-            double angle = 2.0 * M_PI * i / 32;
-            double x = cos(angle) * ring_radius;
-            double y = sin(angle) * ring_radius;
-            ring_verts[i] = {(float)(boss->x + x), (float)(boss->y + y), 0.2f, 0.8f, 1.0f, (float)ring_intensity};
+// A list's geometry, tessellated ahead of the replay
+typedef struct {
+    const DrawList *list;
+    std::vector<int> cmds;          // Indices of the geometry commands
+    GLTessSegment segments[GL_TESS_MAX_SLICES];
+    int slice;                      // Geometry commands per segment
+    int slices;                     // 0 = tessellate during the replay instead
+    int segment;                    // Replay cursor: next submission to make
+    size_t submission;
+    size_t vertex;
+    size_t index;
+} GLTessFrame;
+
+static void gl_tess_slices(void *data, int begin, int end) {
+    GLTessFrame *tess = (GLTessFrame *)data;
+    for (int s = begin; s < end; s++) {
+        GLTessSegment *segment = &tess->segments[s];
+        segment->verts.clear();
+        segment->indices.clear();
+        segment->submissions.clear();
+
+        int first = s * tess->slice;
+        int last = first + tess->slice < (int)tess->cmds.size() ? first + tess->slice : (int)tess->cmds.size();
+        g_tess_segment = segment;
+        for (int i = first; i < last; i++) {
+            segment->cmd = tess->cmds[i];
+            gl_tess_cmd(tess->list, &tess->list->cmds[segment->cmd]);
         }
-        draw_vertices(ring_verts, 32, GL_LINE_LOOP);
-    }
-    glLineWidth(1.0f);
-    
-    // Damage flash overlay
-    if (boss->damage_flash_timer > 0) {
-        gl_set_color_alpha(1.0f, 0.5f, 0.5f, (float)boss->damage_flash_timer);
-        gl_draw_circle(boss->x, boss->y, (float)(core_radius + 20), 32);
-    }
-    
-    // Draw orbiting satellites
-    // NOTE: These are visual elements only - they do NOT cause collision damage
-    // They orbit the Singularity boss and are purely for visual feedback of the boss's status
-    for (int i = 0; i < boss->fragment_count; i++) {
-        double angle = (i * 360.0 / boss->fragment_count + boss->rotation) * M_PI / 180.0;
-        double orbit_radius = 120.0;
-        double sat_x = cos(angle) * orbit_radius;
-        double sat_y = sin(angle) * orbit_radius;
-        
-        // Satellite glow
-        gl_set_color_alpha(0.0f, 1.0f, 1.0f, 0.5f);
-        gl_draw_circle(boss->x + sat_x, boss->y + sat_y, 12.0f, 16);
-        
-        // Satellite core
-        gl_set_color(0.3f, 1.0f, 1.0f);
-        gl_draw_circle(boss->x + sat_x, boss->y + sat_y, 8.0f, 16);
+        g_tess_segment = NULL;
     }
-    
-    // Draw health bar
-    double bar_width = 140.0;
-    double bar_height = 12.0;
-    double bar_x = boss->x - bar_width / 2.0;
-    double bar_y = boss->y - 80.0;
-    
-    // Background
-    gl_set_color(0.1f, 0.05f, 0.1f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height);
-    
-    // Health fill (cyan gradient effect)
-    double health_percent = (double)boss->health / boss->max_health;
-    if (health_percent < 0) health_percent = 0;
-    
-    gl_set_color(0.0f, 1.0f, 1.0f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)(bar_width * health_percent), (float)bar_height);
-    
-    // Border
-    gl_set_color(0.5f, 0.5f, 1.0f);
-    gl_draw_rect_outline((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height, 1.0f);
 }
 
-void draw_comet_buster_hud_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game) return;
-    (void)height;   // Suppress unused parameter warning
-    
-    char text[256];
-    
-    // --- TOP LEFT SECTION ---
-    // Score (with multiplier indicator)
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    sprintf(text, "%s %d (x%.1f)", score_label_text[game->current_language], game->score, game->score_multiplier);
-    gl_draw_text_simple(text, 20, 30, 18);
-    
-    // Lives
-    sprintf(text, "%s %d", lives_label_text[game->current_language], game->ship_lives);
-    gl_draw_text_simple(text, 20, 55, 18);
-    
-    // Shield status
-    sprintf(text, "%s %d/%d", shield_label_text[game->current_language], game->shield_health, game->max_shield_health);
-    if (game->shield_health <= 0) {
-        gl_set_color(1.0f, 0.3f, 0.3f);  // Red when no shield
-    } else if (game->shield_health == 1) {
-        gl_set_color(1.0f, 0.8f, 0.0f);  // Orange when low
-    } else {
-        gl_set_color(0.0f, 1.0f, 1.0f);  // Cyan when healthy
+static void gl_tess_prepare(GLTessFrame *tess, const DrawList *list) {
+    tess->list = list;
+    tess->cmds.clear();
+    tess->slices = 0;
+    tess->segment = 0;
+    tess->submission = tess->vertex = tess->index = 0;
+
+    for (size_t i = 0; i < list->cmds.size(); i++) {
+        if (gl_is_tess_cmd(&list->cmds[i])) tess->cmds.push_back((int)i);
     }
-    gl_draw_text_simple(text, 20, 105, 18);
-    gl_set_color(1.0f, 1.0f, 1.0f);  // Reset to white
-    
-    // --- TOP RIGHT SECTION ---
-    // Wave
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    snprintf(text, sizeof(text), HUD_WAVE_LABEL[game->current_language], game->current_wave);
-    gl_draw_text_simple(text, width - 180, 30, 18);
-    
-    // Asteroids remaining
-    snprintf(text, sizeof(text), HUD_WAVE_LABEL[game->current_language], game->current_wave);
+    int count = (int)tess->cmds.size();
+    if (count < GL_TESS_PARALLEL_MIN || job_system_worker_count() == 0) return;
 
-    gl_draw_text_simple(text, width - 280, 55, 18);
-    
-    // Wave progress info (only show if wave is incomplete)
-    if (game->wave_complete_timer > 0) {  // Comet count <= 0 should never happen but I had it happen to me once so I put it here.
-        sprintf(text, "%s %.1fs", next_wave_in_text[game->current_language], game->wave_complete_timer);
-        gl_set_color(1.0f, 1.0f, 0.0f);
-        gl_draw_text_simple(text, width / 2 - 160, height / 2 - 50, 18);
-        gl_set_color(1.0f, 1.0f, 1.0f);
-    } else if (game->comet_count > 0) {
-        int expected_count = comet_buster_get_wave_comet_count(game->current_wave);
-        sprintf(text, "%s %d/%d", destroyed_label_text[game->current_language], expected_count - game->comet_count, expected_count);
-        gl_set_color(1.0f, 1.0f, 1.0f);
-        gl_draw_text_simple(text, width - 280, 75, 12);
+    tess->slice = (count + GL_TESS_MAX_SLICES - 1) / GL_TESS_MAX_SLICES;
+    if (tess->slice < GL_TESS_SLICE) tess->slice = GL_TESS_SLICE;
+    tess->slices = (count + tess->slice - 1) / tess->slice;
+    job_parallel_for(tess->slices, 1, gl_tess_slices, tess);
+}
+
+// Put command 'index' into the frame stream: copy what gl_tess_prepare()
+// made for it, or tessellate it now
+static void gl_tess_emit(GLTessFrame *tess, int index) {
+    const DrawCmd *cmd = &tess->list->cmds[index];
+    if (!tess->slices || !gl_is_tess_cmd(cmd)) {
+        gl_tess_cmd(tess->list, cmd);
+        return;
+    }
+
+    while (tess->segment < tess->slices) {
+        const GLTessSegment *segment = &tess->segments[tess->segment];
+        if (tess->submission == segment->submissions.size()) {
+            tess->segment++;
+            tess->submission = tess->vertex = tess->index = 0;
+            continue;
+        }
+
+        const GLTessSubmission &submission = segment->submissions[tess->submission];
+        if (submission.cmd != index) return;
+
+        GLuint *idx, base;
+        PackedVertex *out = gl_batch_append(submission.prim, submission.vertex_count,
+                                            submission.index_count, &idx, &base);
+        if (out) {
+            memcpy(out, &segment->verts[tess->vertex], submission.vertex_count * sizeof(PackedVertex));
+            const GLuint *indices = &segment->indices[tess->index];
+            for (int k = 0; k < submission.index_count; k++) {
+                idx[k] = base + indices[k];
+            }
+        }
+        tess->submission++;
+        tess->vertex += submission.vertex_count;
+        tess->index += submission.index_count;
     }
-    
-    // --- FLOATING TEXT POPUPS ---
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    for (int i = 0; i < game->floating_text_count; i++) {
-        FloatingText *ft = &game->floating_texts[i];
-        if (ft->active) {
-            // Calculate fade (alpha) based on remaining lifetime
-            float alpha = (float)(ft->lifetime / ft->max_lifetime);
-            
-            // Set color with fade
-            gl_set_color_alpha((float)ft->color[0], (float)ft->color[1], (float)ft->color[2], alpha);
-            
-            // Draw text
-            gl_draw_text_simple(ft->text, (int)ft->x - 30, (int)ft->y, 16);
+}
+
+void drawlist_replay_gl(const DrawList *list) {
+    static GLTessFrame tess;
+    if (!list) return;
+
+    gl_tess_prepare(&tess, list);
+
+    for (size_t i = 0; i < list->cmds.size(); i++) {
+        const DrawCmd *cmd = &list->cmds[i];
+        if (gl_is_tess_cmd(cmd)) {
+            gl_tess_emit(&tess, (int)i);
+            continue;
+        }
+
+        switch (cmd->type) {
+            case DL_CIRCLE:
+                gl_set_draw_color(cmd->color);
+                if (cmd->flags & DL_FILL) {
+                    gl_draw_disc(cmd->x, cmd->y, cmd->size);
+                } else {
+                    gl_draw_ring(cmd->x, cmd->y, cmd->size, cmd->width);
+                }
+                break;
+            case DL_SPRITE:
+                if (cmd->id == DL_SPRITE_GLOW) {
+                    gl_set_draw_color(cmd->color);
+                    gl_draw_glow(cmd->x, cmd->y, cmd->size);
+                } else {
+                    gl_draw_sprite(cmd->x, cmd->y, cmd->a, cmd->b, cmd->size, 0.0f, gl_draw_color(cmd->color),
+                                   cmd->id == DL_SPRITE_DIAMOND ? SPRITE_DIAMOND : SPRITE_DISC);
+                }
+                break;
+            case DL_TEXT: {
+                const char *text = &list->text[cmd->first];
+                float x = cmd->x;
+                if (cmd->flags & DL_TEXT_CENTER) {
+                    x -= gl_calculate_text_width(text, cmd->id) / 2.0f;
+                }
+                gl_set_draw_color(cmd->color);
+                gl_draw_text_simple(text, (int)x, (int)cmd->y, cmd->id);
+                break;
+            }
+            case DL_SHAPE:
+                if (cmd->id < DL_SHAPE_COUNT) {
+                    gl_draw_mesh(g_shape_meshes[cmd->id], cmd->x, cmd->y, cmd->a, cmd->b, gl_draw_color(cmd->color));
+                }
+                break;
+            case DL_COMET: {
+                // The whole run of comets goes in one instanced draw per size
+                size_t end = i + 1;
+                while (end < list->cmds.size() && list->cmds[end].type == DL_COMET) end++;
+                if (!gl_draw_comets_instanced(cmd, (int)(end - i))) {
+                    for (size_t c = i; c < end; c++) gl_tess_emit(&tess, (int)c);
+                }
+                i = end - 1;
+                break;
+            }
+            case DL_BACKGROUND:
+                gl_draw_background(list->width, list->height);
+                break;
+            case DL_DEBRIS:
+                gl_draw_gpu_particles(list);
+                break;
+            default:
+                break;
         }
     }
-    gl_set_color(1.0f, 1.0f, 1.0f);  // Reset to white
-    
-    // --- BOTTOM LEFT SECTION ---
-    // Energy bar
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    sprintf(text, "%s %.0f%%", energy_label_text[game->current_language], game->energy_amount);    
-    
-    // Color based on fuel level
-    if (game->energy_amount < 20) {
-        gl_set_color(1.0f, 0.2f, 0.2f);  // Red - critical
-    } else if (game->energy_amount < 50) {
-        gl_set_color(1.0f, 1.0f, 0.0f);  // Yellow - low
-    } else {
-        gl_set_color(0.2f, 1.0f, 0.2f);  // Green - good
+}
+
+// The game screen from a list built by drawlist_build_game(). Front-ends
+// that draw one frame more than once (OpenXR eyes) build the list once
+// and call this per view.
+void draw_comet_buster_gl_list(Visualizer *visualizer, const DrawList *list) {
+    if (!visualizer || !list) return;
+
+    if (!isGLInitialized) {
+        gl_init();
+        SDL_Log("[Comet Busters] [Comet Busters] Initializing GL Init (should only happen once)");
+        isGLInitialized = 1;
     }
+
+    CometBusterGame *game = &visualizer->comet_buster;
+    int width = visualizer->width;
+    int height = visualizer->height;
     
-    gl_draw_text_simple(text, 20, height - 40, 14);
-    
-    // Draw fuel bar (visual indicator)
-    double bar_width = 150;
-    double bar_height = 12;
-    double bar_x = 20;
-    double bar_y = height - 25;
-    
-    // Background (dark)
-    gl_set_color(0.2f, 0.2f, 0.2f);
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height);
+    gl_setup_2d_projection(width, height);
     
-    // Fuel level (colored)
-    double fuel_percent = game->energy_amount / game->max_energy;
-    if (fuel_percent > 0.5) {
-        gl_set_color(0.2f, 1.0f, 0.2f);  // Green
-    } else if (fuel_percent > 0.2) {
-        gl_set_color(1.0f, 1.0f, 0.0f);  // Yellow
-    } else {
-        gl_set_color(1.0f, 0.2f, 0.2f);  // Red
+#ifdef ExternalSound
+    // Draw splash screen if active
+    if (game->splash_screen_active) {
+        comet_buster_draw_splash_screen_gl(game, NULL, width, height);
+        return;  // Don't draw game yet
     }
-    gl_draw_rect_filled((float)bar_x, (float)bar_y, (float)(bar_width * fuel_percent), (float)bar_height);
     
-    // Border
-    gl_set_color(1.0f, 1.0f, 1.0f);
-    gl_draw_rect_outline((float)bar_x, (float)bar_y, (float)bar_width, (float)bar_height, 1.0f);
-    
-    // --- MISSILES DISPLAY ---
-    // Missile ammo display (bottom left, above Energy)
-    if (game->missile_ammo > 0 || game->using_missiles) {
-        gl_set_color(1.0f, 0.8f, 0.0f);  // Yellow/orange
-        char missile_text[32];
-        sprintf(missile_text, "%s %d", missiles_label_text[game->current_language], game->missile_ammo);        
-        
-        gl_draw_text_simple(missile_text, 20, height - 110, 14);
-        
-        // Draw missile bar
-        double missile_bar_width = 150;
-        double missile_bar_height = 12;
-        double missile_bar_x = 20;
-        double missile_bar_y = height - 95;
-        
-        // Background
-        gl_set_color(0.2f, 0.2f, 0.2f);
-        gl_draw_rect_filled((float)missile_bar_x, (float)missile_bar_y, (float)missile_bar_width, (float)missile_bar_height);
-        
-        // Missile bar (assume max 100 for display, each pickup adds 20)
-        double missile_percent = (game->missile_ammo > 100) ? 1.0 : (game->missile_ammo / 100.0);
-        gl_set_color(1.0f, 0.8f, 0.0f);  // Yellow
-        gl_draw_rect_filled((float)missile_bar_x, (float)missile_bar_y, (float)(missile_bar_width * missile_percent), (float)missile_bar_height);
-        
-        // Border
-        gl_set_color(1.0f, 1.0f, 1.0f);
-        gl_draw_rect_outline((float)missile_bar_x, (float)missile_bar_y, (float)missile_bar_width, (float)missile_bar_height, 1.0f);
+    // Draw finale splash if active (Wave 30 complete screen)
+    if (game->finale_splash_active) {
+        comet_buster_draw_finale_splash_gl(game, NULL, width, height);
+        return;  // Don't draw game yet
     }
+#endif
     
-    // --- BOMBS DISPLAY ---
-    // Bomb ammo display
-    if (game->bomb_ammo > 0 || game->bomb_count > 0) {
-        gl_set_color(1.0f, 0.6f, 0.0f);  // Orange for bombs
-        char bomb_text[32];
-        sprintf(bomb_text, "%s %d", bombs_label_text[game->current_language], game->bomb_ammo);
-        
-        gl_draw_text_simple(bomb_text, 20, height - 65, 14);
-        
-        // Show active bombs
-        if (game->bomb_count > 0) {
-            gl_set_color(1.0f, 1.0f, 0.0f);  // Yellow for active
-            char active_text[32];
-            sprintf(active_text, "%s %d", armed_label_text[game->current_language], game->bomb_count);
-            gl_draw_text_simple(active_text, 20, height - 50, 12);
-        }
-        
-        // Draw bomb bar
-        double bomb_bar_width = 150;
-        double bomb_bar_height = 12;
-        double bomb_bar_x = 20;
-        double bomb_bar_y = game->bomb_count > 0 ? (height - 35) : (height - 50);
-        
-        // Background
-        gl_set_color(0.2f, 0.2f, 0.2f);
-        gl_draw_rect_filled((float)bomb_bar_x, (float)bomb_bar_y, (float)bomb_bar_width, (float)bomb_bar_height);
-        
-        // Bomb bar
-        double bomb_percent = (game->bomb_ammo > 10) ? 1.0 : (game->bomb_ammo / 10.0);
-        gl_set_color(1.0f, 0.6f, 0.0f);  // Orange
-        gl_draw_rect_filled((float)bomb_bar_x, (float)bomb_bar_y, (float)(bomb_bar_width * bomb_percent), (float)bomb_bar_height);
-        
-        // Border
-        gl_set_color(1.0f, 1.0f, 1.0f);
-        gl_draw_rect_outline((float)bomb_bar_x, (float)bomb_bar_y, (float)bomb_bar_width, (float)bomb_bar_height, 1.0f);
-    }
+    drawlist_replay_gl(list);
 }
 
-void draw_comet_buster_game_over_gl(CometBusterGame *game, void *cr, int width, int height) {
-    if (!game || !game->game_over) return;
-    gl_set_color_alpha(0.0f, 0.0f, 0.0f, 0.7f);
-    gl_draw_rect_filled(0.0f, 0.0f, width, height);
-    gl_set_color(1.0f, 0.0f, 0.0f);
-    gl_draw_rect_outline(width / 2.0f - 50.0f, height / 2.0f - 30.0f, 100.0f, 60.0f, 2.0f);
+void draw_comet_buster_gl(Visualizer *visualizer, void *cr) {
+    if (!visualizer) return;
+    (void)cr;
+
+    static DrawList frame_list;
+    drawlist_build_game(&frame_list, &visualizer->comet_buster, visualizer->width, visualizer->height);
+    draw_comet_buster_gl_list(visualizer, &frame_list);
 }
 
-void boss_explosion_draw_gl(BossExplosion *explosion, void *cr) {
-    if (!explosion) return;
-    for (int i = 0; i < explosion->particle_count; i++) {
-        BossExplosionParticle *p = &explosion->particles[i];
-        if (!p->active) continue;
-        gl_set_color_alpha(p->color[0], p->color[1], p->color[2], p->glow_intensity);
-        gl_draw_circle(p->x, p->y, 3.0f, 12);
-    }
+static struct {
+    char pacing[256];
+    char quality[256];
+    bool visible;
+} g_debug_overlay;
+
+void gl_set_debug_overlay(const char *pacing, const char *quality) {
+    g_debug_overlay.visible = pacing != NULL;
+    if (!pacing) return;
+    snprintf(g_debug_overlay.pacing, sizeof(g_debug_overlay.pacing), "%s", pacing);
+    snprintf(g_debug_overlay.quality, sizeof(g_debug_overlay.quality), "%s", quality ? quality : "");
 }
 
+void gl_draw_debug_overlay(int width, int height) {
+    if (!g_debug_overlay.visible) return;
 
+    gl_set_color_alpha(0.0f, 0.0f, 0.0f, 0.6f);
+    gl_draw_rect_filled(0, height - 48, width, 48);
+    gl_set_color(0.6f, 1.0f, 0.6f);
+    gl_draw_text_simple(g_debug_overlay.pacing, 10, height - 29, 14);
+    gl_draw_text_simple(g_debug_overlay.quality, 10, height - 9, 14);
+}
 
 // ============================================================================
 // COMPLETE LOCALIZED OPENGL SPLASH SCREEN FUNCTIONS
 // Replace your existing GL functions with these
 // ============================================================================
 
+// ============================================================================
+// PRE-RENDERED TEXT PANELS
+// ============================================================================
+// The opening crawl, the victory scroll and the finale scroll draw the same
+// few dozen lines every frame. A GLTextPanel renders a line list once,
+// white on black, into single-channel textures (pages of fixed-height
+// cells, one line per cell, left-aligned). The scenes then draw one quad
+// per visible line with the colour and fade they already computed, so the
+// per-line fades are unchanged and a frame of crawl costs a few dozen
+// quads. A panel is rebuilt when its line list changes (language switch);
+// if render-to-texture is not available the scenes draw text directly.
+
+#define TEXT_PANEL_PAGE_HEIGHT 1024
+#define TEXT_PANEL_MAX_PAGES 8
+#define TEXT_PANEL_MARGIN 8         // Room for glyphs overhanging their advance
+
+typedef struct {
+    const char **lines;
+    int line_count;
+    int font_size;
+    int cell_height;
+    int baseline;               // Baseline offset within a cell
+    int page_width;
+    int lines_per_page;
+    int page_count;
+    GLuint pages[TEXT_PANEL_MAX_PAGES];
+    float *widths;              // gl_calculate_text_width() of each line
+    bool ready;
+} GLTextPanel;
+
+static GLTextPanel g_crawl_panel;
+static GLTextPanel g_victory_panel;
+static GLTextPanel g_finale_panel;
+
+static void gl_text_panel_release(GLTextPanel *panel) {
+    if (panel->page_count > 0) glDeleteTextures(panel->page_count, panel->pages);
+    free(panel->widths);
+    memset(panel, 0, sizeof(*panel));
+}
+
+static bool gl_text_panel_build(GLTextPanel *panel, const char **lines, int line_count, int font_size) {
+    gl_text_panel_release(panel);
+    panel->lines = lines;
+    panel->line_count = line_count;
+    panel->font_size = font_size;
+    if (!gl_glyphs_ready() || line_count <= 0) return false;
+
+    panel->cell_height = (int)ceilf(font_size * 1.8f);
+    panel->baseline = (int)(font_size * 1.25f + 0.5f);
+    panel->lines_per_page = TEXT_PANEL_PAGE_HEIGHT / panel->cell_height;
+    panel->page_count = (line_count + panel->lines_per_page - 1) / panel->lines_per_page;
+
+    panel->widths = (float *)calloc(line_count, sizeof(float));
+    if (!panel->widths) return false;
+    float widest = 0.0f;
+    for (int i = 0; i < line_count; i++) {
+        panel->widths[i] = gl_calculate_text_width(lines[i], font_size);
+        if (panel->widths[i] > widest) widest = panel->widths[i];
+    }
+    panel->page_width = (int)ceilf(widest) + 2 * TEXT_PANEL_MARGIN;
+
+    GLint max_size = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+    if (panel->page_count > TEXT_PANEL_MAX_PAGES || panel->page_width > max_size) {
+        SDL_Log("[Comet Busters] [GL] Text panel too large (%d lines, %d px), drawing text directly\n",
+                line_count, panel->page_width);
+        panel->page_count = 0;
+        return false;
+    }
+
+    // Everything queued so far belongs to the screen
+    gl_flush_batches();
+
+    GLint previous_fbo = 0;
+    GLint viewport[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_fbo);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    GLfloat clear_color[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clear_color);
+    Mat4 screen_projection = gl_state.projection;
+    float color[4];
+    memcpy(color, gl_state.color, sizeof(color));
+    // Pages are ordinary 2D textures - bake them with the single-view
+    // programs and no eye transform
+    bool multiview = g_multiview.active;
+    int view_count = g_multiview.view_count;
+    g_multiview.active = false;
+    g_multiview.view_count = 0;
+
+    GLuint fbo = 0;
+    glGenFramebuffers(1, &fbo);
+    glGenTextures(panel->page_count, panel->pages);
+
+    // Text y runs down the texture rows, and the scenes sample row 0 at
+    // the top of each quad, so the text ends up upright
+    gl_state.projection = mat4_ortho(0, (float)panel->page_width, 0, TEXT_PANEL_PAGE_HEIGHT, -1, 1);
+    gl_set_color(1.0f, 1.0f, 1.0f);
+
+    bool complete = true;
+    for (int page = 0; page < panel->page_count && complete; page++) {
+        glBindTexture(GL_TEXTURE_2D, panel->pages[page]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, panel->page_width, TEXT_PANEL_PAGE_HEIGHT, 0,
+                     GL_RED, GL_UNSIGNED_BYTE, NULL);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, panel->pages[page], 0);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            complete = false;
+            break;
+        }
+        glViewport(0, 0, panel->page_width, TEXT_PANEL_PAGE_HEIGHT);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        int first = page * panel->lines_per_page;
+        for (int i = first; i < first + panel->lines_per_page && i < line_count; i++) {
+            int cell_top = (i - first) * panel->cell_height;
+            gl_draw_text_simple(lines[i], TEXT_PANEL_MARGIN, cell_top + panel->baseline, font_size);
+        }
+        gl_flush_batches();
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)previous_fbo);
+    glDeleteFramebuffers(1, &fbo);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    glClearColor(clear_color[0], clear_color[1], clear_color[2], clear_color[3]);
+    gl_state.projection = screen_projection;
+    memcpy(gl_state.color, color, sizeof(color));
+    g_multiview.active = multiview;
+    g_multiview.view_count = view_count;
+
+    if (!complete) {
+        SDL_Log("[Comet Busters] [GL] Text panel framebuffer incomplete, drawing text directly\n");
+        glDeleteTextures(panel->page_count, panel->pages);
+        panel->page_count = 0;
+        return false;
+    }
+
+    panel->ready = true;
+    SDL_Log("[Comet Busters] [GL] Text panel: %d lines at %d px, %d page(s) of %dx%d\n",
+            line_count, font_size, panel->page_count, panel->page_width, TEXT_PANEL_PAGE_HEIGHT);
+    return true;
+}
+
+// Build (or rebuild) the panel for this line list. A failed build is not
+// retried until the list changes.
+static bool gl_text_panel_prepare(GLTextPanel *panel, const char **lines, int line_count, int font_size) {
+    if (panel->lines != lines || panel->line_count != line_count || panel->font_size != font_size) {
+        gl_text_panel_build(panel, lines, line_count, font_size);
+    }
+    return panel->ready;
+}
+
+// Draw line 'line' exactly where gl_draw_text_simple(text, x, baseline_y)
+// would, in the current colour
+static void gl_text_panel_draw_line(const GLTextPanel *panel, int line, float x, float baseline_y) {
+    int page = line / panel->lines_per_page;
+    int cell_top = (line % panel->lines_per_page) * panel->cell_height;
+
+    GlyphInstance quad;
+    quad.x = x - TEXT_PANEL_MARGIN;
+    quad.y = baseline_y - panel->baseline;
+    quad.w = (float)panel->page_width;
+    quad.h = (float)panel->cell_height;
+    quad.u0 = 0.0f;
+    quad.u1 = 1.0f;
+    quad.v0 = (float)cell_top / TEXT_PANEL_PAGE_HEIGHT;
+    quad.v1 = (float)(cell_top + panel->cell_height) / TEXT_PANEL_PAGE_HEIGHT;
+    quad.color = gl_current_color_packed();
+
+    gl_set_blend_mode(BLEND_ALPHA);
+    gl_draw_coverage_quad(panel->pages[page], &quad);
+}
+
 void comet_buster_draw_splash_screen_gl(CometBusterGame *game, void *cr, int width, int height) {
     if (!game || !game->splash_screen_active) return;
     
@@ -2543,25 +3518,10 @@ void comet_buster_draw_splash_screen_gl(CometBusterGame *game, void *cr, int wid
     gl_set_color(0.04f, 0.06f, 0.15f);
     gl_draw_rect_filled(0.0f, 0.0f, (float)width, (float)height);
     
-    // Draw grid (extended 50 pixels further to the right)
-    gl_set_color(0.1f, 0.15f, 0.35f);
-    for (int i = 0; i <= width + 50; i += 50) {
-        gl_draw_line((float)i, 0.0f, (float)i, (float)height, 0.5f);
-    }
-    for (int i = 0; i <= height; i += 50) {
-        gl_draw_line(0.0f, (float)i, (float)(width + 50), (float)i, 0.5f);
-    }
-    
-    // Draw game elements in background
-    draw_comet_buster_comets_gl(game, cr, width, height);
-    draw_comet_buster_enemy_ships_gl(game, cr, width, height);
-    draw_comet_buster_enemy_bullets_gl(game, cr, width, height);
-    draw_comet_buster_particles_gl(game, cr, width, height);
-    
-    // Draw boss if active
-    if (game->boss_active) {
-        draw_comet_buster_boss_gl(game, &game->boss, cr, width, height);
-    }
+    // Grid, then the game elements moving behind the crawl
+    static DrawList backdrop;
+    drawlist_build_splash(&backdrop, game, width, height);
+    drawlist_replay_gl(&backdrop);
     
     // Dim the background with overlay for text visibility
     gl_set_color_alpha(0.0f, 0.0f, 0.0f, 0.3f);
@@ -2575,6 +3535,7 @@ void comet_buster_draw_splash_screen_gl(CometBusterGame *game, void *cr, int wid
         // GET LANGUAGE-SPECIFIC ARRAYS
         const char **crawl_lines = get_opening_crawl_for_language(game->current_language);
         int num_crawl_lines = get_num_crawl_lines_for_language(game->current_language);
+        bool panel = gl_text_panel_prepare(&g_crawl_panel, crawl_lines, num_crawl_lines, 24);
         
         gl_set_color(1.0f, 0.95f, 0.0f);
         
@@ -2615,13 +3576,18 @@ void comet_buster_draw_splash_screen_gl(CometBusterGame *game, void *cr, int wid
             gl_set_color_alpha(1.0f, 0.95f, 0.0f, (float)alpha);
             
             // Center text horizontally using actual text width
-            float text_width = gl_calculate_text_width(crawl_lines[line_index], 24);
+            float text_width = panel ? g_crawl_panel.widths[line_index]
+                                     : gl_calculate_text_width(crawl_lines[line_index], 24);
             float ideal_x = (viewport_width - text_width) / 2.0f;
             // Clamp to viewport bounds: min 30px margin to prevent cutoff (text can be long)
             int x_pos = (int)ideal_x;
             if (x_pos < 30) x_pos = 30;
             if (x_pos + text_width > viewport_width - 30) x_pos = viewport_width - (int)text_width - 30;
-            gl_draw_text_simple(crawl_lines[line_index], x_pos, (int)y_pos, 24);
+            if (panel) {
+                gl_text_panel_draw_line(&g_crawl_panel, line_index, (float)x_pos, (float)(int)y_pos);
+            } else {
+                gl_draw_text_simple(crawl_lines[line_index], x_pos, (int)y_pos, 24);
+            }
         }
     }
     // ===== TITLE PHASE =====
@@ -2723,6 +3689,7 @@ void comet_buster_draw_victory_scroll_gl(CometBusterGame *game, void *cr, int wi
     // GET LANGUAGE-SPECIFIC ARRAYS
     const char **victory_lines = get_victory_scroll_for_language(game->current_language);
     int num_victory_lines = get_num_victory_lines_for_language(game->current_language);
+    bool panel = gl_text_panel_prepare(&g_victory_panel, victory_lines, num_victory_lines, 24);
     
     // Setup text
     gl_set_color(1.0f, 1.0f, 0.0f);
@@ -2757,14 +3724,19 @@ void comet_buster_draw_victory_scroll_gl(CometBusterGame *game, void *cr, int wi
         
         // Center text horizontally using actual text width
         const char *line_text = victory_lines[start_line + i];
-        float text_width = gl_calculate_text_width(line_text, 24);
+        float text_width = panel ? g_victory_panel.widths[start_line + i]
+                                 : gl_calculate_text_width(line_text, 24);
         float ideal_x = (viewport_width - text_width) / 2.0f;
         // Clamp to viewport bounds with safe margin to prevent cutoff
         int x_pos = (int)ideal_x;
         if (x_pos < 30) x_pos = 30;
         if (x_pos + text_width > viewport_width - 30) x_pos = viewport_width - (int)text_width - 30;
         
-        gl_draw_text_simple(line_text, x_pos, y_pos + i * 40, 24);
+        if (panel) {
+            gl_text_panel_draw_line(&g_victory_panel, start_line + i, (float)x_pos, (float)(y_pos + i * 40));
+        } else {
+            gl_draw_text_simple(line_text, x_pos, y_pos + i * 40, 24);
+        }
     }
 }
 
@@ -2785,6 +3757,7 @@ void comet_buster_draw_finale_splash_gl(CometBusterGame *game, void *cr, int wid
     // GET LANGUAGE-SPECIFIC ARRAYS
     const char **victory_lines = get_victory_scroll_for_language(game->current_language);
     int num_victory_lines = get_num_victory_lines_for_language(game->current_language);
+    bool panel = gl_text_panel_prepare(&g_finale_panel, victory_lines, num_victory_lines, 15);
     
     // Victory scroll text - scrolling effect
     gl_set_color(0.2f, 0.8f, 1.0f);
@@ -2796,9 +3769,13 @@ void comet_buster_draw_finale_splash_gl(CometBusterGame *game, void *cr, int wid
     float y_pos = 150.0f;
     for (int i = start_line; i <= game->finale_scroll_line_index && i < num_victory_lines; i++) {
         const char *line_text = victory_lines[i];
-        float text_width = gl_calculate_text_width(line_text, 15);
+        float text_width = panel ? g_finale_panel.widths[i] : gl_calculate_text_width(line_text, 15);
         float text_x = (width - text_width) / 2.0f;
-        gl_draw_text_simple(line_text, (int)text_x, (int)y_pos, 15);
+        if (panel) {
+            gl_text_panel_draw_line(&g_finale_panel, i, (float)(int)text_x, (float)(int)y_pos);
+        } else {
+            gl_draw_text_simple(line_text, (int)text_x, (int)y_pos, 15);
+        }
         y_pos += 22.0f;
     }
     
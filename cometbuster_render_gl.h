@@ -1,5 +1,8 @@
 #include <GL/glew.h>
 #include <GL/gl.h>
+#ifdef ANDROID
+#include <GLES3/gl3.h>      // glMapBufferRange, fences (context is ES 3.0)
+#endif
 #include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -11,6 +14,7 @@
 #include "visualization.h"
 
 const int MAX_VERTS = 1000000;
+const int MAX_INDICES = MAX_VERTS * 2;
 
 
 // Simple matrix math
@@ -24,11 +28,71 @@ typedef struct {
     float r, g, b, a;
 } Vertex;
 
+// GPU vertex format - 16 bytes instead of 24. Vertex is still what most
+// drawing code builds; draw_vertices() packs it into the frame stream.
+typedef struct {
+    GLubyte r, g, b, a;
+} PackedColor;
+
+typedef struct {
+    float x, y;
+    PackedColor color;          // Normalised RGBA8
+    GLshort edge[2];            // Strokes: signed distance from the centre
+                                // line and half width, in 1/16 px. 0,0 =
+                                // fill (full coverage) - leave it zeroed
+} PackedVertex;
+
+// ============================================================
+// STREAMING BUFFERS
+// ============================================================
+// Per-frame vertex and index data goes through a ring of
+// GL_STREAM_REGIONS regions inside one buffer object:
+//
+//   GL 4.4 / ARB_buffer_storage: the ring is persistently mapped and
+//     written directly. Leaving a region drops a fence; a region is
+//     reused only once its fence has signalled, so up to three
+//     frames can be in flight without the driver synchronising.
+//   GLES 3 / older GL: each upload maps just its own sub-range
+//     unsynchronized, and the whole buffer is orphaned once the ring
+//     wraps - no per-call orphaning of the full buffer.
+//
+// Buffers start small and grow to fit the largest frame seen (the
+// high-water mark), so memory tracks what the game actually draws.
+#define GL_STREAM_REGIONS 3
+#define GL_STREAM_ALIGN 64
+
+typedef struct {
+    GLenum target;
+    GLuint buffer;
+    bool persistent;
+    unsigned char *mapped;          // Whole ring, persistent mode only
+    GLsizeiptr region_size;         // Bytes per region
+    GLsizeiptr grow_to;             // Pending region size (applied at next upload)
+    int region;                     // Region being written
+    GLsizeiptr cursor;              // Next free byte in the ring
+    GLsync fences[GL_STREAM_REGIONS];
+    GLsizeiptr frame_bytes;         // Uploaded this frame
+    GLsizeiptr high_water;          // Largest frame_bytes seen
+    int waits;                      // Uploads that blocked on a fence
+    const char *name;
+} GLStreamBuffer;
+
+void gl_stream_init(GLStreamBuffer *stream, GLenum target, GLsizeiptr region_size, const char *name);
+
+// Copy 'size' bytes into the ring and return their byte offset in
+// stream->buffer, which is left bound to stream->target
+GLintptr gl_stream_upload(GLStreamBuffer *stream, const void *data, GLsizeiptr size);
+
+// Update the high-water mark; the ring grows on the next upload if a
+// frame no longer fits in one region
+void gl_stream_end_frame(GLStreamBuffer *stream);
+
 // Global GL state
 typedef struct {
     GLuint program;
     GLuint vao;
-    GLuint vbo;
+    GLStreamBuffer vertices;
+    GLStreamBuffer indices;
     Mat4 projection;
     float color[4];
     
@@ -38,6 +102,22 @@ typedef struct {
 
 extern GLRenderState gl_state;
 
+static inline GLubyte gl_unit_to_byte(float v) {
+    if (v <= 0.0f) return 0;
+    if (v >= 1.0f) return 255;
+    return (GLubyte)(v * 255.0f + 0.5f);
+}
+
+static inline PackedColor gl_pack_color(float r, float g, float b, float a) {
+    PackedColor c = {gl_unit_to_byte(r), gl_unit_to_byte(g), gl_unit_to_byte(b), gl_unit_to_byte(a)};
+    return c;
+}
+
+// The colour set by gl_set_color()/gl_set_color_alpha()
+static inline PackedColor gl_current_color_packed(void) {
+    return gl_pack_color(gl_state.color[0], gl_state.color[1], gl_state.color[2], gl_state.color[3]);
+}
+
 
 void ft_init(void);
 void ft_init_from_base64(void);
@@ -47,3 +127,151 @@ unsigned int utf8_to_codepoint(const unsigned char *str, int *bytes_read);
 float gl_calculate_text_width(const char *text, int font_size);
 void gl_draw_text_simple(const char *text, int x, int y, int font_size);
 void draw_vertices(Vertex *verts, int count, GLenum mode);
+void draw_packed_vertices(const PackedVertex *verts, int count, GLenum mode);
+
+// Shared vertices: 'indices' index into 'verts'. mode is GL_TRIANGLES or GL_LINES.
+void draw_packed_indexed(const PackedVertex *verts, int count,
+                         const GLushort *indices, int index_count, GLenum mode);
+
+// Frame batching - draw_vertices() queues into one vertex/index stream that
+// is uploaded and drawn by gl_flush_batches(). Line modes are tessellated
+// into anti-aliased triangles at the current gl_set_line_width(), so the
+// width is vertex data and never breaks a batch. Blend mode is batch state,
+// so set it here rather than with glBlendFunc.
+typedef enum {
+    BLEND_ALPHA = 0,        // SRC_ALPHA, ONE_MINUS_SRC_ALPHA
+    BLEND_ADDITIVE          // SRC_ALPHA, ONE
+} GLBlendMode;
+
+typedef struct {
+    int submissions;        // draw_vertices() calls
+    int draw_calls;         // glDrawElements() calls
+    int uploads;            // Stream uploads (flushes)
+    int upload_bytes;       // Bytes copied into the stream buffers
+    int vertices;
+    int indices;
+    int sprites;            // Sprite instances
+    int glyphs;             // Glyph quads
+    int meshes;             // Baked mesh instances
+    int stream_waits;       // Uploads that waited for the GPU
+} GLFrameStats;
+
+// Sprites - one instance each, shape/trail/fade generated in the shader.
+// Consecutive sprites are drawn with one instanced call. trail_x/trail_y
+// is the vector from the tail of the trail to the sprite (0,0 = none);
+// age 0..1 fades the sprite out.
+typedef enum {
+    SPRITE_DISC = 0,
+    SPRITE_DIAMOND = 1,
+    // 2 is the trail quad inside the sprite shader
+    SPRITE_RING = 3,
+    SPRITE_GLOW = 4,
+    SPRITE_ARC = 5
+} SpriteShape;
+
+void gl_draw_sprite(float x, float y, float trail_x, float trail_y, float size, float age,
+                    PackedColor color, SpriteShape shape);
+
+// SDF circles - one sprite instance each in the current colour, cut out
+// per pixel by the sprite shader, so there is no tessellation or trig on
+// the CPU and the edge stays one pixel soft at any radius. They batch with
+// sprites. gl_draw_circle()/gl_draw_circle_outline() go through these.
+// A glow fades from the current alpha at the centre to nothing at
+// 'radius'. Arc angles are radians from +x, increasing clockwise on screen.
+void gl_draw_disc(float cx, float cy, float radius);
+void gl_draw_ring(float cx, float cy, float radius, float thickness);
+void gl_draw_glow(float cx, float cy, float radius);
+void gl_draw_arc(float cx, float cy, float radius, float thickness, float start, float sweep);
+
+// Baked meshes - the fixed vector art of ships, UFOs, pickups and boss
+// bodies, recorded once at gl_init() from the same drawing calls in local
+// coordinates (facing +x, origin at the centre) into a static buffer.
+// Each draw is one instance with a position, rotation, scale and tint
+// (multiplied into the baked colours); consecutive instances of a mesh are
+// one instanced draw. Animated parts - flames, flashes, shields, health
+// bars - are still drawn with the immediate calls around them.
+typedef enum {
+    MESH_PLAYER_SHIP = 0,
+    MESH_ENEMY_SHIP,                        // + ship_type (0-5)
+    MESH_UFO = MESH_ENEMY_SHIP + 6,         // White - tint with the hull colour
+    MESH_CANISTER,
+    MESH_MISSILE_PICKUP,
+    MESH_BOMB_PICKUP,
+    MESH_BOSS_BODY,                         // Death Star hull
+    MESH_BOSS_DETAIL,                       // Rim, spokes and core on top of it
+    MESH_COUNT
+} GLMeshId;
+
+void gl_draw_mesh(GLMeshId mesh, float x, float y, float angle, float scale, PackedColor tint);
+
+// Glyphs - one textured quad per character from the glyph atlas that
+// cometbuster_render_gl_font.cpp maintains. Batched like sprites.
+typedef struct {
+    float x, y, w, h;           // Screen rectangle
+    float u0, v0, u1, v1;       // Atlas rectangle
+    PackedColor color;
+} GlyphInstance;
+
+// false if the glyph shader failed - text then draws as pixel quads
+bool gl_glyphs_ready(void);
+void gl_draw_glyph(const GlyphInstance *glyph);
+GLuint ft_glyph_atlas_texture(void);
+
+// Same quad from any texture holding coverage in its red channel
+void gl_draw_coverage_quad(GLuint texture, const GlyphInstance *quad);
+
+void gl_set_line_width(float width);
+void gl_set_blend_mode(GLBlendMode mode);
+void gl_flush_batches(void);
+void gl_end_frame(void);
+
+// Counters for the last completed frame
+void gl_get_frame_stats(GLFrameStats *stats);
+
+// Debug overlay (F3): two lines on a dark band along the bottom of a
+// width x height play area. Front-ends whose draw callback has no access
+// to their state (GTK) set the text beforehand; NULL hides it.
+void gl_set_debug_overlay(const char *pacing, const char *quality);
+void gl_draw_debug_overlay(int width, int height);
+
+// Background layer - the grid (and anything else behind the game that only
+// changes with the window size) from a static buffer in one draw. Rebuilt
+// when width/height change.
+void gl_draw_background(int width, int height);
+
+// GPU particles - explosion debris simulated with transform feedback.
+// gl_init() turns it on when the context supports it and tells the
+// simulation via comet_buster_set_gpu_particles(). Call
+// gl_set_gpu_particles_allowed(false) before gl_init() to keep every
+// particle on the CPU (replays do).
+void gl_set_gpu_particles_allowed(bool allowed);
+
+// Front-ends that also draw with Cairo (GTK) switch the GPU path off
+// while Cairo is showing - nothing would draw the debris - and back on
+// with the GL view. Safe before gl_init().
+void gl_set_gpu_particles_active(bool active);
+
+// Runs a fixed burst through the GPU path and the CPU integration and
+// compares them (reads the buffer back, so tests only). Needs gl_init().
+bool gl_gpu_particles_self_test(void);
+
+// Single-pass stereo (OVR_multiview2, desktop GL). Between
+// gl_begin_multiview() and gl_end_multiview() everything is drawn into a
+// framebuffer whose colour attachment is two texture-array layers
+// (glFramebufferTextureMultiviewOVR), both views in each draw.
+// gl_begin_multiview() returns false - draw each eye on its own - when
+// the extension or its shaders are missing.
+bool gl_multiview_supported(void);
+bool gl_begin_multiview(GLuint fbo);
+void gl_end_multiview(void);
+
+// Per-view transforms applied after the 2D projection, as 'count' (1 or
+// 2) column-major 4x4 matrices. A multiview pass uses one per layer; a
+// single-view pass uses the first. NULL goes back to the flat screen.
+void gl_set_view_transforms(const float *views, int count);
+
+// Draws a test scene one eye at a time into the layers of an offscreen
+// texture array (the OpenXR path without multiview) and checks both
+// layers got their eye; with OVR_multiview2, draws it again in one
+// multiview pass and compares the pixels. Needs gl_init().
+bool gl_multiview_self_test(void);
@@ -9,6 +9,8 @@
 #include <gtk/gtk.h>
 #include "cometbuster.h"
 #include "visualization.h"
+#include "comet_sim_thread.h"
+#include "cometbuster_quality.h"
 
 #ifdef ANDROID
 #include <SDL.h>
@@ -36,23 +38,11 @@ gboolean on_realize(GtkGLArea *area, gpointer data) {
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    // GL_LINE_SMOOTH and GL_MULTISAMPLE are unsupported or broken on Mesa/VC4
-    // (Raspberry Pi), causing game-screen lines to render as garbage.
-    // Only enable them when the driver actually advertises smooth-line support.
-    // On desktop drivers this path is still taken, so no visual regression there.
+    // Lines are tessellated and anti-aliased by the renderer's shaders, so
+    // no GL_LINE_SMOOTH/GL_MULTISAMPLE - those were slow or broken on
+    // Mesa/VC4 (Raspberry Pi) and llvmpipe anyway
     const char *renderer = (const char *)glGetString(GL_RENDERER);
-    bool is_pi_mesa = renderer &&
-                      (strstr(renderer, "V3D")    != NULL ||
-                       strstr(renderer, "VC4")    != NULL ||
-                       strstr(renderer, "llvmpipe") != NULL ||   // software fallback
-                       strstr(renderer, "softpipe") != NULL);
-    if (!is_pi_mesa) {
-        glEnable(GL_LINE_SMOOTH);
-        glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
-        glEnable(GL_MULTISAMPLE);
-    }
-    SDL_Log("[Comet Busters] [GL] Renderer: %s — line smooth: %s\n",
-            renderer ? renderer : "unknown", is_pi_mesa ? "DISABLED" : "enabled");
+    SDL_Log("[Comet Busters] [GL] Renderer: %s\n", renderer ? renderer : "unknown");
 
     gl_init();
     
@@ -62,7 +52,10 @@ gboolean on_realize(GtkGLArea *area, gpointer data) {
 
 gboolean on_render(GtkGLArea *area, GdkGLContext *context, gpointer data) {
     (void)context;
-    Visualizer *vis = (Visualizer *)data;
+    quality_frame_begin();
+    
+    // Draw the newest published simulation snapshot (see comet_sim_thread.h)
+    Visualizer *vis = sim_thread_acquire_snapshot((SimThread *)data);
     if (!vis) return FALSE;
     
     gtk_gl_area_make_current(area);
@@ -94,9 +87,13 @@ gboolean on_render(GtkGLArea *area, GdkGLContext *context, gpointer data) {
     
     // RENDER ONLY - game updates happen in game_update_timer callback
     draw_comet_buster_gl(vis, NULL);
+    gl_draw_debug_overlay(vis->width, vis->height);     // Text set by on_frame_tick
+    gl_end_frame();
+    quality_frame_work_done();
     
+    // No queue_draw here: the front-end's frame clock tick schedules the
+    // next frame
     glFlush();
-    gtk_widget_queue_draw(GTK_WIDGET(area));
     
     return TRUE;
 }
@@ -6,6 +6,7 @@
 #include <string.h>
 #include <time.h>
 #include <vector>
+#include <unordered_map>
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include "cometbuster.h"
@@ -164,8 +165,11 @@ void ft_init_from_base64(void) {
     SDL_Log("[Comet Busters] [FONT] Font family: %s, style: %s\n", ft_face_primary->family_name, ft_face_primary->style_name);
 }
 
+static void ft_atlas_cleanup(void);
+
 // Cleanup FreeType resources
 void ft_cleanup(void) {
+    ft_atlas_cleanup();
     if (ft_face_primary) {
         FT_Done_Face(ft_face_primary);
         ft_face_primary = NULL;
@@ -245,19 +249,248 @@ unsigned int utf8_to_codepoint(const unsigned char *str, int *bytes_read) {
     return 0;
 }
 
-// Calculate actual text width based on FreeType glyph metrics
-float gl_calculate_text_width(const char *text, int font_size) {
+// ============================================================================
+// GLYPH CACHE
+// ============================================================================
+// Every glyph is rendered by FreeType once per (face, pixel size, codepoint)
+// and packed into a single-channel atlas texture; after that a character
+// costs a hash lookup and one GlyphInstance. Kerning pairs are cached the
+// same way. The atlas is packed in shelves (rows as tall as their tallest
+// glyph) with a blank texel between glyphs so linear filtering stays
+// inside each one. When it fills up the pending text is drawn and the
+// cache starts over - the menus and HUD use a handful of sizes, so that
+// only happens after a language change or two.
+
+#define GLYPH_ATLAS_SIZE 1024
+#define GLYPH_ATLAS_PADDING 1
+
+typedef struct {
+    FT_UInt index;          // Glyph index, for kerning
+    int atlas_x, atlas_y;   // Bitmap position in the atlas
+    int width, height;      // 0 for blank/missing glyphs
+    int left, top;          // FreeType bitmap_left / bitmap_top
+    float advance;
+} CachedGlyph;
+
+static struct {
+    GLuint texture;
+    unsigned char *pixels;  // CPU copy - the pixel-quad fallback reads it
+    int shelf_x, shelf_y, shelf_height;
+    std::unordered_map<uint64_t, CachedGlyph> glyphs;
+    std::unordered_map<uint64_t, float> kerning;
+    FT_Face sized_face;     // Face/size last passed to FT_Set_Pixel_Sizes
+    int sized_font_size;
+} g_glyph_atlas;
+
+GLuint ft_glyph_atlas_texture(void) {
+    return g_glyph_atlas.texture;
+}
 
-    if (!text || !text[0] || !ft_face_primary) return 0.0f;
+static bool ft_set_size(FT_Face face, int font_size) {
+    if (face == g_glyph_atlas.sized_face && font_size == g_glyph_atlas.sized_font_size) return true;
 
-    // Set font size (in 1/64th of a point, so multiply by 64)
-    FT_Error error = FT_Set_Pixel_Sizes(ft_face_primary, 0, font_size);
+    FT_Error error = FT_Set_Pixel_Sizes(face, 0, font_size);
     if (error) {
         SDL_Log("[Comet Busters] [FONT] Warning: Failed to set font size\n");
-        return 0.0f;
+        g_glyph_atlas.sized_face = NULL;
+        return false;
+    }
+    g_glyph_atlas.sized_face = face;
+    g_glyph_atlas.sized_font_size = font_size;
+    return true;
+}
+
+static bool ft_atlas_create(void) {
+    if (g_glyph_atlas.pixels) return true;
+
+    g_glyph_atlas.pixels = (unsigned char *)calloc(GLYPH_ATLAS_SIZE * GLYPH_ATLAS_SIZE, 1);
+    if (!g_glyph_atlas.pixels) return false;
+    g_glyph_atlas.shelf_x = GLYPH_ATLAS_PADDING;
+    g_glyph_atlas.shelf_y = GLYPH_ATLAS_PADDING;
+    g_glyph_atlas.shelf_height = 0;
+
+    if (gl_glyphs_ready()) {
+        glGenTextures(1, &g_glyph_atlas.texture);
+        glBindTexture(GL_TEXTURE_2D, g_glyph_atlas.texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, GLYPH_ATLAS_SIZE, GLYPH_ATLAS_SIZE, 0,
+                     GL_RED, GL_UNSIGNED_BYTE, g_glyph_atlas.pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    SDL_Log("[Comet Busters] [FONT] Glyph atlas: %dx%d\n", GLYPH_ATLAS_SIZE, GLYPH_ATLAS_SIZE);
+    return true;
+}
+
+// Drop every cached glyph. Text already queued is drawn first because it
+// points into the old atlas contents.
+static void ft_atlas_reset(void) {
+    gl_flush_batches();
+
+    g_glyph_atlas.glyphs.clear();
+    memset(g_glyph_atlas.pixels, 0, GLYPH_ATLAS_SIZE * GLYPH_ATLAS_SIZE);
+    g_glyph_atlas.shelf_x = GLYPH_ATLAS_PADDING;
+    g_glyph_atlas.shelf_y = GLYPH_ATLAS_PADDING;
+    g_glyph_atlas.shelf_height = 0;
+
+    if (g_glyph_atlas.texture) {
+        glBindTexture(GL_TEXTURE_2D, g_glyph_atlas.texture);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, GLYPH_ATLAS_SIZE, GLYPH_ATLAS_SIZE,
+                        GL_RED, GL_UNSIGNED_BYTE, g_glyph_atlas.pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    SDL_Log("[Comet Busters] [FONT] Glyph atlas full, starting over\n");
+}
+
+// Find room for a width x height bitmap; false if the atlas is full
+static bool ft_atlas_place(int width, int height, int *x, int *y) {
+    if (width + 2 * GLYPH_ATLAS_PADDING > GLYPH_ATLAS_SIZE ||
+        height + 2 * GLYPH_ATLAS_PADDING > GLYPH_ATLAS_SIZE) {
+        return false;
+    }
+
+    if (g_glyph_atlas.shelf_x + width + GLYPH_ATLAS_PADDING > GLYPH_ATLAS_SIZE) {
+        // Next shelf
+        g_glyph_atlas.shelf_x = GLYPH_ATLAS_PADDING;
+        g_glyph_atlas.shelf_y += g_glyph_atlas.shelf_height + GLYPH_ATLAS_PADDING;
+        g_glyph_atlas.shelf_height = 0;
+    }
+    if (g_glyph_atlas.shelf_y + height + GLYPH_ATLAS_PADDING > GLYPH_ATLAS_SIZE) {
+        return false;
+    }
+
+    *x = g_glyph_atlas.shelf_x;
+    *y = g_glyph_atlas.shelf_y;
+    g_glyph_atlas.shelf_x += width + GLYPH_ATLAS_PADDING;
+    if (height > g_glyph_atlas.shelf_height) g_glyph_atlas.shelf_height = height;
+    return true;
+}
+
+static uint64_t ft_glyph_key(FT_Face face, int font_size, unsigned int codepoint) {
+    uint64_t face_id = (face == ft_face_primary) ? 0 : 1;
+    return (face_id << 56) | ((uint64_t)(unsigned int)font_size << 32) | codepoint;
+}
+
+// Render a glyph into the atlas. On a miss the face is left set to font_size.
+static const CachedGlyph *ft_cached_glyph(FT_Face face, int font_size, unsigned int codepoint) {
+    uint64_t key = ft_glyph_key(face, font_size, codepoint);
+    std::unordered_map<uint64_t, CachedGlyph>::iterator it = g_glyph_atlas.glyphs.find(key);
+    if (it != g_glyph_atlas.glyphs.end()) return &it->second;
+
+    if (!ft_atlas_create() || !ft_set_size(face, font_size)) return NULL;
+
+    CachedGlyph glyph;
+    memset(&glyph, 0, sizeof(glyph));
+    glyph.index = FT_Get_Char_Index(face, codepoint);
+
+    if (FT_Load_Glyph(face, glyph.index, FT_LOAD_RENDER) != 0) {
+        // Skip glyphs that can't be rendered, but keep their advance
+        if (FT_Load_Glyph(face, glyph.index, FT_LOAD_DEFAULT) == 0) {
+            glyph.advance = (float)(face->glyph->advance.x >> 6);
+        }
+        return &(g_glyph_atlas.glyphs[key] = glyph);
+    }
+
+    FT_GlyphSlot slot = face->glyph;
+    FT_Bitmap *bitmap = &slot->bitmap;
+    glyph.advance = (float)(slot->advance.x >> 6);
+    glyph.left = slot->bitmap_left;
+    glyph.top = slot->bitmap_top;
+
+    if (bitmap->buffer && bitmap->width > 0 && bitmap->rows > 0) {
+        int x, y;
+        if (!ft_atlas_place((int)bitmap->width, (int)bitmap->rows, &x, &y)) {
+            ft_atlas_reset();
+            if (!ft_atlas_place((int)bitmap->width, (int)bitmap->rows, &x, &y)) {
+                // Bigger than the whole atlas - advance only
+                return &(g_glyph_atlas.glyphs[key] = glyph);
+            }
+        }
+
+        glyph.atlas_x = x;
+        glyph.atlas_y = y;
+        glyph.width = (int)bitmap->width;
+        glyph.height = (int)bitmap->rows;
+        for (int row = 0; row < glyph.height; row++) {
+            memcpy(g_glyph_atlas.pixels + (y + row) * GLYPH_ATLAS_SIZE + x,
+                   bitmap->buffer + row * bitmap->pitch, glyph.width);
+        }
+
+        if (g_glyph_atlas.texture) {
+            glBindTexture(GL_TEXTURE_2D, g_glyph_atlas.texture);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, GLYPH_ATLAS_SIZE);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, glyph.width, glyph.height, GL_RED, GL_UNSIGNED_BYTE,
+                            g_glyph_atlas.pixels + y * GLYPH_ATLAS_SIZE + x);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            glBindTexture(GL_TEXTURE_2D, 0);
+        }
+    }
+
+    return &(g_glyph_atlas.glyphs[key] = glyph);
+}
+
+// Horizontal kerning between two glyph indices, in pixels
+static float ft_kerning(FT_Face face, int font_size, FT_UInt left, FT_UInt right) {
+    if (!left || !FT_HAS_KERNING(face)) return 0.0f;
+
+    uint64_t face_id = (face == ft_face_primary) ? 0 : 1;
+    uint64_t key = (face_id << 63) | ((uint64_t)(font_size & 0x7FF) << 52) |
+                   ((uint64_t)(left & 0x3FFFFFF) << 26) | (right & 0x3FFFFFF);
+    std::unordered_map<uint64_t, float>::iterator it = g_glyph_atlas.kerning.find(key);
+    if (it != g_glyph_atlas.kerning.end()) return it->second;
+
+    float kern = 0.0f;
+    FT_Vector delta;
+    if (ft_set_size(face, font_size) &&
+        FT_Get_Kerning(face, left, right, FT_KERNING_DEFAULT, &delta) == 0) {
+        kern = (float)(delta.x >> 6);
+    }
+    g_glyph_atlas.kerning[key] = kern;
+    return kern;
+}
+
+// CJK strings use the CJK face; NULL if that font is not installed
+static FT_Face ft_face_for_text(const char *text) {
+    if (text_contains_cjk(text)) return ft_face_cjk;
+    return ft_face_primary;
+}
+
+static void ft_atlas_cleanup(void) {
+    if (g_glyph_atlas.texture) {
+        glDeleteTextures(1, &g_glyph_atlas.texture);
+        g_glyph_atlas.texture = 0;
     }
+    free(g_glyph_atlas.pixels);
+    g_glyph_atlas.pixels = NULL;
+    g_glyph_atlas.glyphs.clear();
+    g_glyph_atlas.kerning.clear();
+    g_glyph_atlas.sized_face = NULL;
+}
+
+// ============================================================================
+// TEXT
+// ============================================================================
+
+// Calculate actual text width based on FreeType glyph metrics
+float gl_calculate_text_width(const char *text, int font_size) {
+
+    if (!text || !text[0] || !ft_face_primary) return 0.0f;
+
+    FT_Face ft_face = ft_face_for_text(text);
+    if (!ft_face) return 0.0f;
     
     float width = 0.0f;
+    FT_UInt previous = 0;
     
     // Process UTF-8 text
     for (int i = 0; text[i]; ) {
@@ -269,13 +502,10 @@ float gl_calculate_text_width(const char *text, int font_size) {
             continue;
         }
         
-        // Load the glyph and get metrics
-        FT_UInt glyph_index = FT_Get_Char_Index(ft_face_primary, codepoint);
-        error = FT_Load_Glyph(ft_face_primary, glyph_index, FT_LOAD_DEFAULT);
-        
-        if (!error) {
-            // Use advance width from the glyph slot
-            width += (float)(ft_face_primary->glyph->advance.x >> 6);  // Convert from 1/64th pixel to pixels
+        const CachedGlyph *glyph = ft_cached_glyph(ft_face, font_size, codepoint);
+        if (glyph) {
+            width += ft_kerning(ft_face, font_size, previous, glyph->index) + glyph->advance;
+            previous = glyph->index;
         }
         
         i += bytes_read;
@@ -284,38 +514,69 @@ float gl_calculate_text_width(const char *text, int font_size) {
     return width;
 }
 
+// Fallback when the glyph shader is unavailable: one quad per lit pixel,
+// read from the atlas copy
+static int ft_glyph_pixel_quads(const CachedGlyph *glyph, float glyph_x, float glyph_y,
+                                std::vector<Vertex> &verts, int vert_count) {
+    float r = gl_state.color[0];
+    float g = gl_state.color[1];
+    float b = gl_state.color[2];
+    
+    size_t needed = vert_count + (size_t)glyph->width * glyph->height * 6;
+    if (needed > (size_t)MAX_VERTS) needed = MAX_VERTS;
+    if (verts.size() < needed) verts.resize(needed);
+    
+    for (int row = 0; row < glyph->height && vert_count < MAX_VERTS - 6; row++) {
+        float pixel_y = glyph_y + row;
+        const unsigned char *src = g_glyph_atlas.pixels +
+                                   (glyph->atlas_y + row) * GLYPH_ATLAS_SIZE + glyph->atlas_x;
+        
+        for (int col = 0; col < glyph->width && vert_count < MAX_VERTS - 6; col++) {
+            unsigned char pixel_value = src[col];
+            
+            if (pixel_value > 3) {
+                float pixel_x = glyph_x + col;
+                float alpha = gl_state.color[3] * ((float)pixel_value / 255.0f);
+                
+                // Create two triangles for the pixel
+                verts[vert_count++] = {pixel_x, pixel_y, r, g, b, alpha};
+                verts[vert_count++] = {pixel_x + 1.0f, pixel_y, r, g, b, alpha};
+                verts[vert_count++] = {pixel_x + 1.0f, pixel_y + 1.0f, r, g, b, alpha};
+                
+                verts[vert_count++] = {pixel_x, pixel_y, r, g, b, alpha};
+                verts[vert_count++] = {pixel_x + 1.0f, pixel_y + 1.0f, r, g, b, alpha};
+                verts[vert_count++] = {pixel_x, pixel_y + 1.0f, r, g, b, alpha};
+            }
+        }
+    }
+    return vert_count;
+}
+
 void gl_draw_text_simple(const char *text, int x, int y, int font_size) {
     if (!text || !text[0] || !ft_face_primary) return;
 
-    FT_Face ft_face;
-
-    if (text_contains_cjk(text))
-        ft_face = ft_face_cjk;
-    else
-        ft_face = ft_face_primary;
-    
-    // Set font size
-    FT_Error error = FT_Set_Pixel_Sizes(ft_face, 0, font_size);
-    if (error) {
-        SDL_Log("[Comet Busters] [FONT] Warning: Failed to set font size\n");
-        return;
-    }
+    FT_Face ft_face = ft_face_for_text(text);
+    if (!ft_face) return;
     
     // Disable scissor test to prevent text clipping
     glDisable(GL_SCISSOR_TEST);
+    gl_set_blend_mode(BLEND_ALPHA);
     
     float current_x = (float)x;
     float baseline_y = (float)y;
     float line_height = (float)font_size * 1.2f;  // Line height with 20% spacing
     
-    // Build vertex array
+    bool quads = gl_glyphs_ready();
+    PackedColor color = gl_current_color_packed();
+    const float texel = 1.0f / GLYPH_ATLAS_SIZE;
+    
+    // Pixel-quad fallback only; grows to the longest string drawn so far
     static std::vector<Vertex> verts;
-
-    if (verts.empty()) verts.resize(MAX_VERTS);
     int vert_count = 0;
+    FT_UInt previous = 0;
     
     // Process UTF-8 text
-    for (int i = 0; text[i] && vert_count < MAX_VERTS - 6; ) {
+    for (int i = 0; text[i]; ) {
         int bytes_read = 0;
         unsigned int codepoint = utf8_to_codepoint((const unsigned char*)&text[i], &bytes_read);
         
@@ -328,68 +589,47 @@ void gl_draw_text_simple(const char *text, int x, int y, int font_size) {
         if (codepoint == '\n') {
             current_x = (float)x;
             baseline_y += line_height;
+            previous = 0;
             i += bytes_read;
             continue;
         }
         
-        // Get glyph index and load it
-        FT_UInt glyph_index = FT_Get_Char_Index(ft_face, codepoint);
-        error = FT_Load_Glyph(ft_face, glyph_index, FT_LOAD_RENDER);
-        
-        if (error) {
-            // Skip glyphs that can't be loaded, but advance position
-            if (FT_Load_Glyph(ft_face, glyph_index, FT_LOAD_DEFAULT) == 0) {
-                current_x += (float)(ft_face->glyph->advance.x >> 6);
-            }
+        const CachedGlyph *glyph = ft_cached_glyph(ft_face, font_size, codepoint);
+        if (!glyph) {
             i += bytes_read;
             continue;
         }
         
-        FT_GlyphSlot slot = ft_face->glyph;
-        FT_Bitmap *bitmap = &slot->bitmap;
+        current_x += ft_kerning(ft_face, font_size, previous, glyph->index);
+        previous = glyph->index;
         
-        if (bitmap->buffer && bitmap->width > 0 && bitmap->rows > 0) {
-            // Render glyph bitmap as vertices
-            float glyph_x = current_x + slot->bitmap_left;
-            float glyph_y = baseline_y - slot->bitmap_top;
+        if (glyph->width > 0) {
+            float glyph_x = current_x + glyph->left;
+            float glyph_y = baseline_y - glyph->top;
             
-            for (int row = 0; row < (int)bitmap->rows && vert_count < MAX_VERTS - 6; row++) {
-                float pixel_y = glyph_y + row;
-                
-                for (int col = 0; col < (int)bitmap->width && vert_count < MAX_VERTS - 6; col++) {
-                    unsigned char pixel_value = bitmap->buffer[row * bitmap->pitch + col];
-                    
-                    if (pixel_value > 3) {
-                        float pixel_x = glyph_x + col;
-                        float alpha = gl_state.color[3] * ((float)pixel_value / 255.0f);
-                        
-                        float r = gl_state.color[0];
-                        float g = gl_state.color[1];
-                        float b = gl_state.color[2];
-                        
-                        // Create two triangles for the pixel
-                        verts[vert_count++] = {pixel_x, pixel_y, r, g, b, alpha};
-                        verts[vert_count++] = {pixel_x + 1.0f, pixel_y, r, g, b, alpha};
-                        verts[vert_count++] = {pixel_x + 1.0f, pixel_y + 1.0f, r, g, b, alpha};
-                        
-                        verts[vert_count++] = {pixel_x, pixel_y, r, g, b, alpha};
-                        verts[vert_count++] = {pixel_x + 1.0f, pixel_y + 1.0f, r, g, b, alpha};
-                        verts[vert_count++] = {pixel_x, pixel_y + 1.0f, r, g, b, alpha};
-                    }
-                }
+            if (quads) {
+                GlyphInstance quad;
+                quad.x = glyph_x;
+                quad.y = glyph_y;
+                quad.w = (float)glyph->width;
+                quad.h = (float)glyph->height;
+                quad.u0 = glyph->atlas_x * texel;
+                quad.v0 = glyph->atlas_y * texel;
+                quad.u1 = (glyph->atlas_x + glyph->width) * texel;
+                quad.v1 = (glyph->atlas_y + glyph->height) * texel;
+                quad.color = color;
+                gl_draw_glyph(&quad);
+            } else {
+                vert_count = ft_glyph_pixel_quads(glyph, glyph_x, glyph_y, verts, vert_count);
             }
         }
         
         // Advance to next character position
-        current_x += (float)(slot->advance.x >> 6);
+        current_x += glyph->advance;
         i += bytes_read;
     }
     
-    // Draw all glyphs at once
     if (vert_count > 0) {
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         draw_vertices(verts.data(), vert_count, GL_TRIANGLES);
     }
 }
-
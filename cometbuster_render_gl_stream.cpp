@@ -0,0 +1,182 @@
+#include <GL/glew.h>
+#include <GL/gl.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cometbuster_render_gl.h"
+
+#ifdef ANDROID
+#include <SDL.h>
+#else
+#include <SDL2/SDL.h>
+#endif
+
+// ============================================================================
+// STREAMING VERTEX / INDEX BUFFERS
+// ============================================================================
+// See GLStreamBuffer in cometbuster_render_gl.h. Everything here runs on
+// the render thread with the GL context current and the renderer's VAO
+// bound (the element buffer binding is VAO state).
+
+static GLsizeiptr gl_stream_round_up(GLsizeiptr size) {
+    GLsizeiptr rounded = 4096;
+    while (rounded < size) rounded *= 2;
+    return rounded;
+}
+
+static bool gl_stream_can_persist(void) {
+#ifdef ANDROID
+    // GLES 3.0 has no buffer storage
+    return false;
+#else
+    return GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+#endif
+}
+
+static void gl_stream_release(GLStreamBuffer *stream) {
+    for (int i = 0; i < GL_STREAM_REGIONS; i++) {
+        if (stream->fences[i]) {
+            glDeleteSync(stream->fences[i]);
+            stream->fences[i] = 0;
+        }
+    }
+    if (stream->buffer) {
+        if (stream->mapped) {
+            glBindBuffer(stream->target, stream->buffer);
+            glUnmapBuffer(stream->target);
+            stream->mapped = NULL;
+        }
+        // The driver keeps the old storage alive until queued draws finish
+        glDeleteBuffers(1, &stream->buffer);
+        stream->buffer = 0;
+    }
+}
+
+static void gl_stream_allocate(GLStreamBuffer *stream, GLsizeiptr region_size) {
+    gl_stream_release(stream);
+
+    GLsizeiptr total = region_size * GL_STREAM_REGIONS;
+    stream->region_size = region_size;
+    stream->grow_to = 0;
+    stream->region = 0;
+    stream->cursor = 0;
+
+    glGenBuffers(1, &stream->buffer);
+    glBindBuffer(stream->target, stream->buffer);
+
+#ifndef ANDROID
+    if (stream->persistent) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(stream->target, total, NULL, flags);
+        stream->mapped = (unsigned char *)glMapBufferRange(stream->target, 0, total, flags);
+        if (!stream->mapped) {
+            SDL_Log("[Comet Busters] [GL] %s stream: persistent map failed, using orphaning\n",
+                    stream->name);
+            stream->persistent = false;
+            glDeleteBuffers(1, &stream->buffer);
+            glGenBuffers(1, &stream->buffer);
+            glBindBuffer(stream->target, stream->buffer);
+        }
+    }
+#endif
+
+    if (!stream->persistent) {
+        glBufferData(stream->target, total, NULL, GL_STREAM_DRAW);
+    }
+
+    SDL_Log("[Comet Busters] [GL] %s stream: %ld KB (%d x %ld KB, %s)\n",
+            stream->name, (long)(total / 1024), GL_STREAM_REGIONS, (long)(region_size / 1024),
+            stream->persistent ? "persistent" : "orphaning");
+}
+
+// Block until the GPU is done with 'region'
+static void gl_stream_wait(GLStreamBuffer *stream, int region) {
+    GLsync fence = stream->fences[region];
+    if (!fence) return;
+
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        stream->waits++;
+        do {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+        } while (result == GL_TIMEOUT_EXPIRED);
+    }
+
+    glDeleteSync(fence);
+    stream->fences[region] = 0;
+}
+
+void gl_stream_init(GLStreamBuffer *stream, GLenum target, GLsizeiptr region_size, const char *name) {
+    memset(stream, 0, sizeof(*stream));
+    stream->target = target;
+    stream->persistent = gl_stream_can_persist();
+    stream->grow_to = gl_stream_round_up(region_size);
+    stream->name = name;
+}
+
+GLintptr gl_stream_upload(GLStreamBuffer *stream, const void *data, GLsizeiptr size) {
+    GLsizeiptr aligned = (size + GL_STREAM_ALIGN - 1) & ~(GLsizeiptr)(GL_STREAM_ALIGN - 1);
+
+    // One upload must always fit in a region
+    GLsizeiptr wanted = stream->grow_to;
+    if (aligned > stream->region_size && aligned > wanted) {
+        wanted = gl_stream_round_up(aligned);
+    }
+    if (!stream->buffer || wanted > stream->region_size) {
+        gl_stream_allocate(stream, wanted > stream->region_size ? wanted : stream->region_size);
+    } else {
+        glBindBuffer(stream->target, stream->buffer);
+    }
+
+    stream->frame_bytes += aligned;
+
+    if (stream->persistent) {
+        GLsizeiptr region_end = (GLsizeiptr)(stream->region + 1) * stream->region_size;
+        if (stream->cursor + aligned > region_end) {
+            // Everything drawn from this region has been queued - fence it
+            // and move on to the oldest one
+            stream->fences[stream->region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            stream->region = (stream->region + 1) % GL_STREAM_REGIONS;
+            gl_stream_wait(stream, stream->region);
+            stream->cursor = (GLsizeiptr)stream->region * stream->region_size;
+        }
+
+        GLintptr offset = stream->cursor;
+        memcpy(stream->mapped + offset, data, size);
+        stream->cursor += aligned;
+        return offset;
+    }
+
+    // Sub-range orphaning: nothing below the cursor is rewritten until the
+    // ring wraps, and at that point the old storage is orphaned, so each
+    // range can be mapped without synchronising
+    GLsizeiptr total = stream->region_size * GL_STREAM_REGIONS;
+    if (stream->cursor + aligned > total) {
+        glBufferData(stream->target, total, NULL, GL_STREAM_DRAW);
+        stream->cursor = 0;
+    }
+
+    GLintptr offset = stream->cursor;
+    void *ptr = glMapBufferRange(stream->target, offset, size,
+                                 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (ptr) {
+        memcpy(ptr, data, size);
+        glUnmapBuffer(stream->target);
+    } else {
+        glBufferSubData(stream->target, offset, size, data);
+    }
+    stream->cursor += aligned;
+    return offset;
+}
+
+void gl_stream_end_frame(GLStreamBuffer *stream) {
+    if (stream->frame_bytes > stream->high_water) {
+        stream->high_water = stream->frame_bytes;
+
+        // Keep a whole frame inside one region so the ring holds
+        // GL_STREAM_REGIONS frames before it has to wait on the GPU
+        if (stream->high_water > stream->region_size) {
+            stream->grow_to = gl_stream_round_up(stream->high_water);
+        }
+    }
+    stream->frame_bytes = 0;
+}
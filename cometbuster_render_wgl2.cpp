@@ -150,7 +150,8 @@ bool sdl_wgl_init(GtkWidget *placeholder)
 
     // ------------------------------------------------------------------ 4.
     // Set pixel format on our real HDC.
-    // Try ARB (MSAA) first, fall back to legacy.
+    // Try ARB first, fall back to legacy. No multisampling - the renderer
+    // anti-aliases its own edges.
     {
         bool fmt_set = false;
 
@@ -163,8 +164,6 @@ bool sdl_wgl_init(GtkWidget *placeholder)
                 WGL_COLOR_BITS_ARB,     32,
                 WGL_DEPTH_BITS_ARB,     24,
                 WGL_STENCIL_BITS_ARB,   8,
-                WGL_SAMPLE_BUFFERS_ARB, 1,
-                WGL_SAMPLES_ARB,        4,
                 0
             };
             int  chosen = 0;
@@ -233,9 +232,6 @@ bool sdl_wgl_init(GtkWidget *placeholder)
     glClearColor(0.04f, 0.06f, 0.15f, 1.0f);
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glEnable(GL_LINE_SMOOTH);
-    glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
-    glEnable(GL_MULTISAMPLE);
 
     gl_init();
 
@@ -294,6 +290,8 @@ void sdl_wgl_render_frame(Visualizer *vis)
     glViewport(vp_x, vp_y, vp_w, vp_h);
 
     draw_comet_buster_gl(vis, NULL);
+    gl_draw_debug_overlay(vis->width, vis->height);     // Text set by gtk_request_redraw
+    gl_end_frame();
 
     SwapBuffers(g_wgl.hdc);
 
@@ -0,0 +1,827 @@
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#ifdef ANDROID
+#include <SDL.h>
+#else
+#include <SDL2/SDL.h>
+#endif
+#include "cometbuster_simd.h"
+#include "cometbuster_fastmath.h"
+
+// ============================================================================
+// PLATFORM SELECTION
+// ============================================================================
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SIMD_HAVE_SSE2 1
+
+// Wider variants are compiled with per-function target attributes and only
+// selected when CPUID says so. MinGW does not align the stack to 32 bytes,
+// so any spilled __m256 can fault (GCC bug 54412) - Windows builds stay on
+// SSE2 until the toolchain is fixed.
+#if defined(__GNUC__) && !defined(_WIN32)
+#include <immintrin.h>
+#define SIMD_HAVE_AVX 1
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+// AVX-512F brings its own FMA instructions; keep mul+add separate so the
+// results match the other levels exactly
+#ifdef __clang__
+#define SIMD_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define SIMD_TARGET_AVX512 __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#endif
+#endif
+
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define SIMD_HAVE_NEON 1
+#endif
+
+// The AoS kernels treat x,y,vx,vy as one packed vector. That only matches
+// the scalar update when the fields are doubles (the float32 build does its
+// arithmetic in double and rounds per field), so float builds keep the
+// scalar AoS loops at every level.
+#ifndef SIM_FLOAT32
+#define SIMD_AOS_VECTOR 1
+static_assert(offsetof(Particle, vx) == offsetof(Particle, x) + 2 * sizeof(double),
+              "Particle x,y,vx,vy must be contiguous");
+static_assert(offsetof(Comet, vx) == offsetof(Comet, x) + 2 * sizeof(double),
+              "Comet x,y,vx,vy must be contiguous");
+#endif
+
+// ============================================================================
+// SCALAR
+// ============================================================================
+
+static void soa_integrate_scalar(double *x, double *y, const double *vx, const double *vy,
+                                 double *life, int n, double dt) {
+    for (int i = 0; i < n; i++) {
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+        life[i] -= dt;
+    }
+}
+
+static int soa_first_within_scalar(const double *x, const double *y, const double *life,
+                                   int n, double cx, double cy, double r2, int start) {
+    for (int i = start < 0 ? 0 : start; i < n; i++) {
+        double dx = x[i] - cx;
+        double dy = y[i] - cy;
+        if (dx * dx + dy * dy < r2 && life[i] > 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void particles_integrate_scalar(Particle *particles, int n, double dt, double gravity) {
+    for (int i = 0; i < n; i++) {
+        Particle *p = &particles[i];
+        p->lifetime -= dt;
+        if (p->lifetime <= 0) continue;
+
+        p->x += p->vx * dt;
+        p->y += p->vy * dt;
+        p->vy += gravity * dt;
+    }
+}
+
+static inline void comet_advance_rotation(Comet *c, double dt) {
+    c->rotation += c->rotation_speed * dt;
+    while (c->rotation > 360) c->rotation -= 360;
+}
+
+static void comets_advance_scalar(Comet *comets, int n, double dt) {
+    for (int i = 0; i < n; i++) {
+        Comet *c = &comets[i];
+        c->x += c->vx * dt;
+        c->y += c->vy * dt;
+        comet_advance_rotation(c, dt);
+    }
+}
+
+static void sincos_batch_scalar(const float *angles, float *s, float *c, int n) {
+    for (int i = 0; i < n; i++) {
+        double ds, dc;
+        fm_sincos(angles[i], &ds, &dc);
+        s[i] = (float)ds;
+        c[i] = (float)dc;
+    }
+}
+
+// Points [first, segments) of a circle, shared tail for every level
+static void circle_points_tail(float cx, float cy, float radius, int first, int segments,
+                               float step, float *xy) {
+    for (int i = first; i < segments; i++) {
+        double s, c;
+        fm_sincos(step * i, &s, &c);
+        xy[i * 2] = cx + radius * (float)c;
+        xy[i * 2 + 1] = cy + radius * (float)s;
+    }
+
+    // Close exactly on the first point
+    xy[segments * 2] = xy[0];
+    xy[segments * 2 + 1] = xy[1];
+}
+
+static void circle_points_scalar(float cx, float cy, float radius, int segments, float *xy) {
+    if (segments <= 0 || !xy) return;
+    circle_points_tail(cx, cy, radius, 0, segments, (float)(2.0 * FM_PI / segments), xy);
+}
+
+// Polynomial constants shared by the float sincos kernels (same reduction
+// and Cephes polynomials as fm_sincos, pi/2 split in three parts)
+#define SIMD_TWO_OVER_PI 0.63661977236758134f
+#define SIMD_DP1 1.5703125f
+#define SIMD_DP2 4.837512969970703125e-4f
+#define SIMD_DP3 7.54978995489188216e-8f
+#define SIMD_S0 -1.9515295891e-4f
+#define SIMD_S1 8.3321608736e-3f
+#define SIMD_S2 -1.6666654611e-1f
+#define SIMD_C0 2.443315711809948e-5f
+#define SIMD_C1 -1.388731625493765e-3f
+#define SIMD_C2 4.166664568298827e-2f
+
+// ============================================================================
+// SSE2
+// ============================================================================
+
+#ifdef SIMD_HAVE_SSE2
+
+static void soa_integrate_sse2(double *x, double *y, const double *vx, const double *vy,
+                               double *life, int n, double dt) {
+    const __m128d vdt = _mm_set1_pd(dt);
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(x + i, _mm_add_pd(_mm_loadu_pd(x + i), _mm_mul_pd(_mm_loadu_pd(vx + i), vdt)));
+        _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_mul_pd(_mm_loadu_pd(vy + i), vdt)));
+        _mm_storeu_pd(life + i, _mm_sub_pd(_mm_loadu_pd(life + i), vdt));
+    }
+    soa_integrate_scalar(x + i, y + i, vx + i, vy + i, life + i, n - i, dt);
+}
+
+static int soa_first_within_sse2(const double *x, const double *y, const double *life,
+                                 int n, double cx, double cy, double r2, int start) {
+    const __m128d vcx = _mm_set1_pd(cx);
+    const __m128d vcy = _mm_set1_pd(cy);
+    const __m128d vr2 = _mm_set1_pd(r2);
+    const __m128d zero = _mm_setzero_pd();
+    int i = start < 0 ? 0 : start;
+    for (; i + 2 <= n; i += 2) {
+        __m128d dx = _mm_sub_pd(_mm_loadu_pd(x + i), vcx);
+        __m128d dy = _mm_sub_pd(_mm_loadu_pd(y + i), vcy);
+        __m128d d2 = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+        __m128d hit = _mm_and_pd(_mm_cmplt_pd(d2, vr2), _mm_cmpgt_pd(_mm_loadu_pd(life + i), zero));
+        int bits = _mm_movemask_pd(hit);
+        if (bits) return i + ((bits & 1) ? 0 : 1);
+    }
+    return soa_first_within_scalar(x, y, life, n, cx, cy, r2, i);
+}
+
+#ifdef SIMD_AOS_VECTOR
+static void particles_integrate_sse2(Particle *particles, int n, double dt, double gravity) {
+    const __m128d vdt = _mm_set1_pd(dt);
+    const __m128d vfall = _mm_set_pd(gravity * dt, 0.0);
+    for (int i = 0; i < n; i++) {
+        Particle *p = &particles[i];
+        p->lifetime -= dt;
+        if (p->lifetime <= 0) continue;
+
+        __m128d vel = _mm_loadu_pd(&p->vx);
+        _mm_storeu_pd(&p->x, _mm_add_pd(_mm_loadu_pd(&p->x), _mm_mul_pd(vel, vdt)));
+        _mm_storeu_pd(&p->vx, _mm_add_pd(vel, vfall));
+    }
+}
+
+static void comets_advance_sse2(Comet *comets, int n, double dt) {
+    const __m128d vdt = _mm_set1_pd(dt);
+    for (int i = 0; i < n; i++) {
+        Comet *c = &comets[i];
+        _mm_storeu_pd(&c->x, _mm_add_pd(_mm_loadu_pd(&c->x), _mm_mul_pd(_mm_loadu_pd(&c->vx), vdt)));
+        comet_advance_rotation(c, dt);
+    }
+}
+#endif
+
+// Four lanes of fm_sincos in float
+static inline void sincos_ps_sse2(__m128 angle, __m128 *s_out, __m128 *c_out) {
+    // Round to nearest quadrant (cvtps uses the default round-to-nearest mode)
+    __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(angle, _mm_set1_ps(SIMD_TWO_OVER_PI)));
+    __m128 k = _mm_cvtepi32_ps(quadrant);
+
+    __m128 r = _mm_sub_ps(angle, _mm_mul_ps(k, _mm_set1_ps(SIMD_DP1)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(SIMD_DP2)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(SIMD_DP3)));
+    __m128 r2 = _mm_mul_ps(r, r);
+
+    __m128 sp = _mm_add_ps(_mm_set1_ps(SIMD_S1), _mm_mul_ps(r2, _mm_set1_ps(SIMD_S0)));
+    sp = _mm_add_ps(_mm_set1_ps(SIMD_S2), _mm_mul_ps(r2, sp));
+    sp = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), sp));
+
+    __m128 cp = _mm_add_ps(_mm_set1_ps(SIMD_C1), _mm_mul_ps(r2, _mm_set1_ps(SIMD_C0)));
+    cp = _mm_add_ps(_mm_set1_ps(SIMD_C2), _mm_mul_ps(r2, cp));
+    cp = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), r2)),
+                    _mm_mul_ps(_mm_mul_ps(r2, r2), cp));
+
+    // Odd quadrants swap sin and cos
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+    __m128 s = _mm_or_ps(_mm_and_ps(swap, cp), _mm_andnot_ps(swap, sp));
+    __m128 c = _mm_or_ps(_mm_and_ps(swap, sp), _mm_andnot_ps(swap, cp));
+
+    // sin is negative in quadrants 2,3; cos in quadrants 1,2
+    __m128i s_sign = _mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30);
+    __m128i c_sign = _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30);
+    *s_out = _mm_xor_ps(s, _mm_castsi128_ps(s_sign));
+    *c_out = _mm_xor_ps(c, _mm_castsi128_ps(c_sign));
+}
+
+static void sincos_batch_sse2(const float *angles, float *s, float *c, int n) {
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 vs, vc;
+        sincos_ps_sse2(_mm_loadu_ps(angles + i), &vs, &vc);
+        _mm_storeu_ps(s + i, vs);
+        _mm_storeu_ps(c + i, vc);
+    }
+    sincos_batch_scalar(angles + i, s + i, c + i, n - i);
+}
+
+static void circle_points_sse2(float cx, float cy, float radius, int segments, float *xy) {
+    if (segments <= 0 || !xy) return;
+
+    float step = (float)(2.0 * FM_PI / segments);
+    const __m128 lane = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    const __m128 vstep = _mm_set1_ps(step);
+    const __m128 vr = _mm_set1_ps(radius);
+    const __m128 vcx = _mm_set1_ps(cx);
+    const __m128 vcy = _mm_set1_ps(cy);
+
+    int i = 0;
+    for (; i + 4 <= segments; i += 4) {
+        __m128 angle = _mm_mul_ps(_mm_add_ps(_mm_set1_ps((float)i), lane), vstep);
+        __m128 vs, vc;
+        sincos_ps_sse2(angle, &vs, &vc);
+
+        __m128 px = _mm_add_ps(vcx, _mm_mul_ps(vr, vc));
+        __m128 py = _mm_add_ps(vcy, _mm_mul_ps(vr, vs));
+
+        // Interleave into x,y pairs
+        _mm_storeu_ps(xy + i * 2, _mm_unpacklo_ps(px, py));
+        _mm_storeu_ps(xy + i * 2 + 4, _mm_unpackhi_ps(px, py));
+    }
+    circle_points_tail(cx, cy, radius, i, segments, step, xy);
+}
+
+#endif // SIMD_HAVE_SSE2
+
+// ============================================================================
+// AVX2
+// ============================================================================
+
+#ifdef SIMD_HAVE_AVX
+
+SIMD_TARGET_AVX2
+static void soa_integrate_avx2(double *x, double *y, const double *vx, const double *vy,
+                               double *life, int n, double dt) {
+    const __m256d vdt = _mm256_set1_pd(dt);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(x + i, _mm256_add_pd(_mm256_loadu_pd(x + i), _mm256_mul_pd(_mm256_loadu_pd(vx + i), vdt)));
+        _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_mul_pd(_mm256_loadu_pd(vy + i), vdt)));
+        _mm256_storeu_pd(life + i, _mm256_sub_pd(_mm256_loadu_pd(life + i), vdt));
+    }
+    soa_integrate_scalar(x + i, y + i, vx + i, vy + i, life + i, n - i, dt);
+}
+
+SIMD_TARGET_AVX2
+static int soa_first_within_avx2(const double *x, const double *y, const double *life,
+                                 int n, double cx, double cy, double r2, int start) {
+    const __m256d vcx = _mm256_set1_pd(cx);
+    const __m256d vcy = _mm256_set1_pd(cy);
+    const __m256d vr2 = _mm256_set1_pd(r2);
+    const __m256d zero = _mm256_setzero_pd();
+    int i = start < 0 ? 0 : start;
+    for (; i + 4 <= n; i += 4) {
+        __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(x + i), vcx);
+        __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(y + i), vcy);
+        __m256d d2 = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+        __m256d hit = _mm256_and_pd(_mm256_cmp_pd(d2, vr2, _CMP_LT_OQ),
+                                    _mm256_cmp_pd(_mm256_loadu_pd(life + i), zero, _CMP_GT_OQ));
+        int bits = _mm256_movemask_pd(hit);
+        if (bits) return i + __builtin_ctz(bits);
+    }
+    return soa_first_within_scalar(x, y, life, n, cx, cy, r2, i);
+}
+
+#ifdef SIMD_AOS_VECTOR
+// x,y,vx,vy fill one 256-bit register: the upper half is copied down to
+// get the step, and the fall is added to the vy lane only
+SIMD_TARGET_AVX2
+static void particles_integrate_avx2(Particle *particles, int n, double dt, double gravity) {
+    const __m256d vdt = _mm256_set_pd(0.0, 0.0, dt, dt);
+    const __m256d vfall = _mm256_set_pd(gravity * dt, 0.0, 0.0, 0.0);
+    for (int i = 0; i < n; i++) {
+        Particle *p = &particles[i];
+        p->lifetime -= dt;
+        if (p->lifetime <= 0) continue;
+
+        __m256d state = _mm256_loadu_pd(&p->x);
+        __m256d vel = _mm256_permute2f128_pd(state, state, 0x11);
+        __m256d step = _mm256_add_pd(_mm256_mul_pd(vel, vdt), vfall);
+        _mm256_storeu_pd(&p->x, _mm256_add_pd(state, step));
+    }
+}
+#endif
+
+SIMD_TARGET_AVX2
+static inline void sincos_ps_avx2(__m256 angle, __m256 *s_out, __m256 *c_out) {
+    __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(angle, _mm256_set1_ps(SIMD_TWO_OVER_PI)));
+    __m256 k = _mm256_cvtepi32_ps(quadrant);
+
+    __m256 r = _mm256_sub_ps(angle, _mm256_mul_ps(k, _mm256_set1_ps(SIMD_DP1)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(k, _mm256_set1_ps(SIMD_DP2)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(k, _mm256_set1_ps(SIMD_DP3)));
+    __m256 r2 = _mm256_mul_ps(r, r);
+
+    __m256 sp = _mm256_add_ps(_mm256_set1_ps(SIMD_S1), _mm256_mul_ps(r2, _mm256_set1_ps(SIMD_S0)));
+    sp = _mm256_add_ps(_mm256_set1_ps(SIMD_S2), _mm256_mul_ps(r2, sp));
+    sp = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2), sp));
+
+    __m256 cp = _mm256_add_ps(_mm256_set1_ps(SIMD_C1), _mm256_mul_ps(r2, _mm256_set1_ps(SIMD_C0)));
+    cp = _mm256_add_ps(_mm256_set1_ps(SIMD_C2), _mm256_mul_ps(r2, cp));
+    cp = _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), r2)),
+                       _mm256_mul_ps(_mm256_mul_ps(r2, r2), cp));
+
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(1)),
+                                                         _mm256_set1_epi32(1)));
+    __m256 s = _mm256_blendv_ps(sp, cp, swap);
+    __m256 c = _mm256_blendv_ps(cp, sp, swap);
+
+    __m256i s_sign = _mm256_slli_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(2)), 30);
+    __m256i c_sign = _mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, _mm256_set1_epi32(1)),
+                                                        _mm256_set1_epi32(2)), 30);
+    *s_out = _mm256_xor_ps(s, _mm256_castsi256_ps(s_sign));
+    *c_out = _mm256_xor_ps(c, _mm256_castsi256_ps(c_sign));
+}
+
+SIMD_TARGET_AVX2
+static void sincos_batch_avx2(const float *angles, float *s, float *c, int n) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 vs, vc;
+        sincos_ps_avx2(_mm256_loadu_ps(angles + i), &vs, &vc);
+        _mm256_storeu_ps(s + i, vs);
+        _mm256_storeu_ps(c + i, vc);
+    }
+    sincos_batch_scalar(angles + i, s + i, c + i, n - i);
+}
+
+SIMD_TARGET_AVX2
+static void circle_points_avx2(float cx, float cy, float radius, int segments, float *xy) {
+    if (segments <= 0 || !xy) return;
+
+    float step = (float)(2.0 * FM_PI / segments);
+    const __m256 lane = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+    const __m256 vstep = _mm256_set1_ps(step);
+    const __m256 vr = _mm256_set1_ps(radius);
+    const __m256 vcx = _mm256_set1_ps(cx);
+    const __m256 vcy = _mm256_set1_ps(cy);
+
+    int i = 0;
+    for (; i + 8 <= segments; i += 8) {
+        __m256 angle = _mm256_mul_ps(_mm256_add_ps(_mm256_set1_ps((float)i), lane), vstep);
+        __m256 vs, vc;
+        sincos_ps_avx2(angle, &vs, &vc);
+
+        __m256 px = _mm256_add_ps(vcx, _mm256_mul_ps(vr, vc));
+        __m256 py = _mm256_add_ps(vcy, _mm256_mul_ps(vr, vs));
+
+        // unpack works per 128-bit half: lo = points 0,1,4,5  hi = 2,3,6,7
+        __m256 lo = _mm256_unpacklo_ps(px, py);
+        __m256 hi = _mm256_unpackhi_ps(px, py);
+        _mm256_storeu_ps(xy + i * 2, _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(xy + i * 2 + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+    circle_points_tail(cx, cy, radius, i, segments, step, xy);
+}
+
+// ============================================================================
+// AVX-512F (SoA kernels only - the AoS entities are 256 bits wide)
+// ============================================================================
+
+SIMD_TARGET_AVX512
+static void soa_integrate_avx512(double *x, double *y, const double *vx, const double *vy,
+                                 double *life, int n, double dt) {
+    const __m512d vdt = _mm512_set1_pd(dt);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(x + i, _mm512_add_pd(_mm512_loadu_pd(x + i), _mm512_mul_pd(_mm512_loadu_pd(vx + i), vdt)));
+        _mm512_storeu_pd(y + i, _mm512_add_pd(_mm512_loadu_pd(y + i), _mm512_mul_pd(_mm512_loadu_pd(vy + i), vdt)));
+        _mm512_storeu_pd(life + i, _mm512_sub_pd(_mm512_loadu_pd(life + i), vdt));
+    }
+    soa_integrate_scalar(x + i, y + i, vx + i, vy + i, life + i, n - i, dt);
+}
+
+SIMD_TARGET_AVX512
+static int soa_first_within_avx512(const double *x, const double *y, const double *life,
+                                   int n, double cx, double cy, double r2, int start) {
+    const __m512d vcx = _mm512_set1_pd(cx);
+    const __m512d vcy = _mm512_set1_pd(cy);
+    const __m512d vr2 = _mm512_set1_pd(r2);
+    const __m512d zero = _mm512_setzero_pd();
+    int i = start < 0 ? 0 : start;
+    for (; i + 8 <= n; i += 8) {
+        __m512d dx = _mm512_sub_pd(_mm512_loadu_pd(x + i), vcx);
+        __m512d dy = _mm512_sub_pd(_mm512_loadu_pd(y + i), vcy);
+        __m512d d2 = _mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy));
+        __mmask8 hit = _mm512_cmp_pd_mask(d2, vr2, _CMP_LT_OQ) &
+                       _mm512_cmp_pd_mask(_mm512_loadu_pd(life + i), zero, _CMP_GT_OQ);
+        if (hit) return i + __builtin_ctz(hit);
+    }
+    return soa_first_within_scalar(x, y, life, n, cx, cy, r2, i);
+}
+
+#endif // SIMD_HAVE_AVX
+
+// ============================================================================
+// NEON (arm64)
+// ============================================================================
+
+#ifdef SIMD_HAVE_NEON
+
+static void soa_integrate_neon(double *x, double *y, const double *vx, const double *vy,
+                               double *life, int n, double dt) {
+    const float64x2_t vdt = vdupq_n_f64(dt);
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        vst1q_f64(x + i, vaddq_f64(vld1q_f64(x + i), vmulq_f64(vld1q_f64(vx + i), vdt)));
+        vst1q_f64(y + i, vaddq_f64(vld1q_f64(y + i), vmulq_f64(vld1q_f64(vy + i), vdt)));
+        vst1q_f64(life + i, vsubq_f64(vld1q_f64(life + i), vdt));
+    }
+    soa_integrate_scalar(x + i, y + i, vx + i, vy + i, life + i, n - i, dt);
+}
+
+static int soa_first_within_neon(const double *x, const double *y, const double *life,
+                                 int n, double cx, double cy, double r2, int start) {
+    const float64x2_t vcx = vdupq_n_f64(cx);
+    const float64x2_t vcy = vdupq_n_f64(cy);
+    const float64x2_t vr2 = vdupq_n_f64(r2);
+    const float64x2_t zero = vdupq_n_f64(0.0);
+    int i = start < 0 ? 0 : start;
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t dx = vsubq_f64(vld1q_f64(x + i), vcx);
+        float64x2_t dy = vsubq_f64(vld1q_f64(y + i), vcy);
+        float64x2_t d2 = vaddq_f64(vmulq_f64(dx, dx), vmulq_f64(dy, dy));
+        uint64x2_t hit = vandq_u64(vcltq_f64(d2, vr2), vcgtq_f64(vld1q_f64(life + i), zero));
+        if (vgetq_lane_u64(hit, 0)) return i;
+        if (vgetq_lane_u64(hit, 1)) return i + 1;
+    }
+    return soa_first_within_scalar(x, y, life, n, cx, cy, r2, i);
+}
+
+#ifdef SIMD_AOS_VECTOR
+static void particles_integrate_neon(Particle *particles, int n, double dt, double gravity) {
+    const float64x2_t vdt = vdupq_n_f64(dt);
+    const float64x2_t vfall = vsetq_lane_f64(gravity * dt, vdupq_n_f64(0.0), 1);
+    for (int i = 0; i < n; i++) {
+        Particle *p = &particles[i];
+        p->lifetime -= dt;
+        if (p->lifetime <= 0) continue;
+
+        float64x2_t vel = vld1q_f64(&p->vx);
+        vst1q_f64(&p->x, vaddq_f64(vld1q_f64(&p->x), vmulq_f64(vel, vdt)));
+        vst1q_f64(&p->vx, vaddq_f64(vel, vfall));
+    }
+}
+
+static void comets_advance_neon(Comet *comets, int n, double dt) {
+    const float64x2_t vdt = vdupq_n_f64(dt);
+    for (int i = 0; i < n; i++) {
+        Comet *c = &comets[i];
+        vst1q_f64(&c->x, vaddq_f64(vld1q_f64(&c->x), vmulq_f64(vld1q_f64(&c->vx), vdt)));
+        comet_advance_rotation(c, dt);
+    }
+}
+#endif
+
+static inline void sincos_ps_neon(float32x4_t angle, float32x4_t *s_out, float32x4_t *c_out) {
+    // vcvtnq rounds to nearest even, like cvtps on x86
+    int32x4_t quadrant = vcvtnq_s32_f32(vmulq_f32(angle, vdupq_n_f32(SIMD_TWO_OVER_PI)));
+    float32x4_t k = vcvtq_f32_s32(quadrant);
+
+    float32x4_t r = vsubq_f32(angle, vmulq_f32(k, vdupq_n_f32(SIMD_DP1)));
+    r = vsubq_f32(r, vmulq_f32(k, vdupq_n_f32(SIMD_DP2)));
+    r = vsubq_f32(r, vmulq_f32(k, vdupq_n_f32(SIMD_DP3)));
+    float32x4_t r2 = vmulq_f32(r, r);
+
+    float32x4_t sp = vaddq_f32(vdupq_n_f32(SIMD_S1), vmulq_f32(r2, vdupq_n_f32(SIMD_S0)));
+    sp = vaddq_f32(vdupq_n_f32(SIMD_S2), vmulq_f32(r2, sp));
+    sp = vaddq_f32(r, vmulq_f32(vmulq_f32(r, r2), sp));
+
+    float32x4_t cp = vaddq_f32(vdupq_n_f32(SIMD_C1), vmulq_f32(r2, vdupq_n_f32(SIMD_C0)));
+    cp = vaddq_f32(vdupq_n_f32(SIMD_C2), vmulq_f32(r2, cp));
+    cp = vaddq_f32(vsubq_f32(vdupq_n_f32(1.0f), vmulq_f32(vdupq_n_f32(0.5f), r2)),
+                   vmulq_f32(vmulq_f32(r2, r2), cp));
+
+    uint32x4_t swap = vceqq_s32(vandq_s32(quadrant, vdupq_n_s32(1)), vdupq_n_s32(1));
+    float32x4_t s = vbslq_f32(swap, cp, sp);
+    float32x4_t c = vbslq_f32(swap, sp, cp);
+
+    uint32x4_t s_sign = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(quadrant, vdupq_n_s32(2))), 30);
+    uint32x4_t c_sign = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(vaddq_s32(quadrant, vdupq_n_s32(1)),
+                                                                    vdupq_n_s32(2))), 30);
+    *s_out = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(s), s_sign));
+    *c_out = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(c), c_sign));
+}
+
+static void sincos_batch_neon(const float *angles, float *s, float *c, int n) {
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t vs, vc;
+        sincos_ps_neon(vld1q_f32(angles + i), &vs, &vc);
+        vst1q_f32(s + i, vs);
+        vst1q_f32(c + i, vc);
+    }
+    sincos_batch_scalar(angles + i, s + i, c + i, n - i);
+}
+
+static void circle_points_neon(float cx, float cy, float radius, int segments, float *xy) {
+    if (segments <= 0 || !xy) return;
+
+    float step = (float)(2.0 * FM_PI / segments);
+    static const float lane_init[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+    const float32x4_t lane = vld1q_f32(lane_init);
+    const float32x4_t vstep = vdupq_n_f32(step);
+    const float32x4_t vr = vdupq_n_f32(radius);
+    const float32x4_t vcx = vdupq_n_f32(cx);
+    const float32x4_t vcy = vdupq_n_f32(cy);
+
+    int i = 0;
+    for (; i + 4 <= segments; i += 4) {
+        float32x4_t angle = vmulq_f32(vaddq_f32(vdupq_n_f32((float)i), lane), vstep);
+        float32x4_t vs, vc;
+        sincos_ps_neon(angle, &vs, &vc);
+
+        // vst2 interleaves x,y pairs on the store
+        float32x4x2_t pts;
+        pts.val[0] = vaddq_f32(vcx, vmulq_f32(vr, vc));
+        pts.val[1] = vaddq_f32(vcy, vmulq_f32(vr, vs));
+        vst2q_f32(xy + i * 2, pts);
+    }
+    circle_points_tail(cx, cy, radius, i, segments, step, xy);
+}
+
+#endif // SIMD_HAVE_NEON
+
+// ============================================================================
+// DISPATCH
+// ============================================================================
+
+static const SimdKernels simd_table_scalar = {
+    soa_integrate_scalar, soa_first_within_scalar,
+    particles_integrate_scalar, comets_advance_scalar,
+    sincos_batch_scalar, circle_points_scalar
+};
+
+#ifdef SIMD_AOS_VECTOR
+#define SIMD_AOS_KERNELS(isa) particles_integrate_##isa, comets_advance_##isa
+#else
+#define SIMD_AOS_KERNELS(isa) particles_integrate_scalar, comets_advance_scalar
+#endif
+
+#ifdef SIMD_HAVE_SSE2
+static const SimdKernels simd_table_sse2 = {
+    soa_integrate_sse2, soa_first_within_sse2,
+    SIMD_AOS_KERNELS(sse2),
+    sincos_batch_sse2, circle_points_sse2
+};
+#endif
+
+#ifdef SIMD_HAVE_AVX
+// Comets carry radius/rotation right after vx,vy, so a 256-bit load/store
+// would not save anything over SSE2 there
+static const SimdKernels simd_table_avx2 = {
+    soa_integrate_avx2, soa_first_within_avx2,
+#ifdef SIMD_AOS_VECTOR
+    particles_integrate_avx2, comets_advance_sse2,
+#else
+    particles_integrate_scalar, comets_advance_scalar,
+#endif
+    sincos_batch_avx2, circle_points_avx2
+};
+
+static const SimdKernels simd_table_avx512 = {
+    soa_integrate_avx512, soa_first_within_avx512,
+#ifdef SIMD_AOS_VECTOR
+    particles_integrate_avx2, comets_advance_sse2,
+#else
+    particles_integrate_scalar, comets_advance_scalar,
+#endif
+    sincos_batch_avx2, circle_points_avx2
+};
+#endif
+
+#ifdef SIMD_HAVE_NEON
+static const SimdKernels simd_table_neon = {
+    soa_integrate_neon, soa_first_within_neon,
+    SIMD_AOS_KERNELS(neon),
+    sincos_batch_neon, circle_points_neon
+};
+#endif
+
+// Baseline until simd_init() runs
+#if defined(SIMD_HAVE_SSE2)
+SimdKernels simd_kernels = simd_table_sse2;
+static SimdLevel simd_current = SIMD_LEVEL_SSE2;
+#elif defined(SIMD_HAVE_NEON)
+SimdKernels simd_kernels = simd_table_neon;
+static SimdLevel simd_current = SIMD_LEVEL_NEON;
+#else
+SimdKernels simd_kernels = simd_table_scalar;
+static SimdLevel simd_current = SIMD_LEVEL_SCALAR;
+#endif
+
+static SimdLevel simd_detected = SIMD_LEVEL_SCALAR;
+static bool simd_detect_done = false;
+
+static SimdLevel simd_detect(void) {
+#if defined(SIMD_HAVE_AVX)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SIMD_LEVEL_AVX512;
+    if (__builtin_cpu_supports("avx2")) return SIMD_LEVEL_AVX2;
+    return SIMD_LEVEL_SSE2;
+#elif defined(SIMD_HAVE_SSE2)
+    return SIMD_LEVEL_SSE2;
+#elif defined(SIMD_HAVE_NEON)
+    return SIMD_LEVEL_NEON;
+#else
+    return SIMD_LEVEL_SCALAR;
+#endif
+}
+
+static void simd_select(SimdLevel level) {
+    switch (level) {
+#ifdef SIMD_HAVE_AVX
+        case SIMD_LEVEL_AVX512: simd_kernels = simd_table_avx512; break;
+        case SIMD_LEVEL_AVX2:   simd_kernels = simd_table_avx2; break;
+#endif
+#ifdef SIMD_HAVE_SSE2
+        case SIMD_LEVEL_SSE2:   simd_kernels = simd_table_sse2; break;
+#endif
+#ifdef SIMD_HAVE_NEON
+        case SIMD_LEVEL_NEON:   simd_kernels = simd_table_neon; break;
+#endif
+        default:
+            level = SIMD_LEVEL_SCALAR;
+            simd_kernels = simd_table_scalar;
+            break;
+    }
+    simd_current = level;
+}
+
+void simd_init(void) {
+    if (simd_detect_done) return;
+
+    simd_detected = simd_detect();
+    simd_detect_done = true;
+    simd_select(simd_detected);
+
+    SDL_Log("[Comet Busters] [SIMD] Using %s kernels\n", simd_level_name(simd_current));
+}
+
+SimdLevel simd_level(void) {
+    return simd_current;
+}
+
+const char *simd_level_name(SimdLevel level) {
+    switch (level) {
+        case SIMD_LEVEL_SSE2:   return "SSE2";
+        case SIMD_LEVEL_AVX2:   return "AVX2";
+        case SIMD_LEVEL_AVX512: return "AVX-512";
+        case SIMD_LEVEL_NEON:   return "NEON";
+        default:                return "scalar";
+    }
+}
+
+void simd_force_level(SimdLevel level) {
+    if (!simd_detect_done) {
+        simd_detected = simd_detect();
+        simd_detect_done = true;
+    }
+
+    // NEON and the x86 levels are separate ladders; scalar works everywhere
+    bool supported;
+    if (simd_detected == SIMD_LEVEL_NEON) {
+        supported = level == SIMD_LEVEL_NEON || level == SIMD_LEVEL_SCALAR;
+    } else {
+        supported = level != SIMD_LEVEL_NEON && level <= simd_detected;
+    }
+    simd_select(supported ? level : simd_detected);
+
+    SDL_Log("[Comet Busters] [SIMD] Forced %s kernels\n", simd_level_name(simd_current));
+}
+
+// ============================================================================
+// SELF CHECK
+// ============================================================================
+
+#define SIMD_CHECK_COUNT 1021           // Odd, so every variant runs its tail
+#define SIMD_CHECK_ROUNDS 256
+
+typedef struct {
+    double x[SIMD_CHECK_COUNT], y[SIMD_CHECK_COUNT];
+    double vx[SIMD_CHECK_COUNT], vy[SIMD_CHECK_COUNT];
+    double life[SIMD_CHECK_COUNT];
+    Particle particles[SIMD_CHECK_COUNT];
+    float angles[SIMD_CHECK_COUNT];
+    float s[SIMD_CHECK_COUNT], c[SIMD_CHECK_COUNT];
+    int first_hit;
+} SimdCheckData;
+
+static void simd_check_fill(SimdCheckData *d) {
+    memset(d, 0, sizeof(SimdCheckData));
+    unsigned int seed = 12345;
+    for (int i = 0; i < SIMD_CHECK_COUNT; i++) {
+        seed = seed * 1103515245u + 12345u;
+        double r = (seed >> 8) / (double)(1 << 24);
+        d->x[i] = r * 1920.0;
+        d->y[i] = (1.0 - r) * 1080.0;
+        d->vx[i] = (r - 0.5) * 300.0;
+        d->vy[i] = (0.5 - r) * 200.0;
+        d->life[i] = (i % 5) * 0.5;
+        d->particles[i].x = d->x[i];
+        d->particles[i].y = d->y[i];
+        d->particles[i].vx = d->vx[i];
+        d->particles[i].vy = d->vy[i];
+        d->particles[i].lifetime = d->life[i];
+        d->angles[i] = (float)((r - 0.5) * 16.0 * FM_PI);
+    }
+}
+
+static void simd_check_run(SimdCheckData *d) {
+    for (int round = 0; round < SIMD_CHECK_ROUNDS; round++) {
+        simd_kernels.soa_integrate(d->x, d->y, d->vx, d->vy, d->life, SIMD_CHECK_COUNT, 1.0 / 60.0);
+        simd_kernels.particles_integrate(d->particles, SIMD_CHECK_COUNT, 1.0 / 60.0, 100.0);
+        simd_kernels.sincos_batch(d->angles, d->s, d->c, SIMD_CHECK_COUNT);
+    }
+    d->first_hit = simd_kernels.soa_first_within(d->x, d->y, d->life, SIMD_CHECK_COUNT, 960.0, 540.0, 400.0 * 400.0, 3);
+}
+
+bool simd_self_check(void) {
+    static SimdCheckData reference;
+    static SimdCheckData candidate;
+
+    simd_init();
+    SimdLevel chosen = simd_current;
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    bool all_same = true;
+
+    simd_select(SIMD_LEVEL_SCALAR);
+    simd_check_fill(&reference);
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    simd_check_run(&reference);
+    double scalar_ms = (SDL_GetPerformanceCounter() - t0) * 1000.0 / freq;
+
+    static const SimdLevel levels[] = {SIMD_LEVEL_SSE2, SIMD_LEVEL_AVX2, SIMD_LEVEL_AVX512, SIMD_LEVEL_NEON};
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        simd_select(levels[l]);
+        if (simd_current != levels[l]) continue;               // Not compiled in
+        if (levels[l] != SIMD_LEVEL_NEON && levels[l] > simd_detected) continue;
+
+        simd_check_fill(&candidate);
+        t0 = SDL_GetPerformanceCounter();
+        simd_check_run(&candidate);
+        double ms = (SDL_GetPerformanceCounter() - t0) * 1000.0 / freq;
+
+        // Simulation kernels must match bit for bit (fields compared one by
+        // one to skip the padding inside Particle)
+        bool same = memcmp(candidate.x, reference.x, sizeof(reference.x)) == 0 &&
+                    memcmp(candidate.y, reference.y, sizeof(reference.y)) == 0 &&
+                    memcmp(candidate.life, reference.life, sizeof(reference.life)) == 0 &&
+                    candidate.first_hit == reference.first_hit;
+        for (int i = 0; same && i < SIMD_CHECK_COUNT; i++) {
+            same = candidate.particles[i].x == reference.particles[i].x &&
+                   candidate.particles[i].y == reference.particles[i].y &&
+                   candidate.particles[i].vy == reference.particles[i].vy &&
+                   candidate.particles[i].lifetime == reference.particles[i].lifetime;
+        }
+
+        // The vector sincos is float, the scalar one double - compare
+        // against the documented fm_sincos_batch bound instead
+        double trig_error = 0.0;
+        for (int i = 0; i < SIMD_CHECK_COUNT; i++) {
+            trig_error = fmax(trig_error, fabs((double)candidate.s[i] - reference.s[i]));
+            trig_error = fmax(trig_error, fabs((double)candidate.c[i] - reference.c[i]));
+        }
+        if (trig_error > 2e-7) same = false;
+
+        SDL_Log("[Comet Busters] [SIMD] %s: %.2f ms (scalar %.2f ms), sincos diff %.1e - %s\n",
+                simd_level_name(levels[l]), ms, scalar_ms, trig_error, same ? "matches scalar" : "MISMATCH");
+        if (!same) all_same = false;
+    }
+
+    simd_select(chosen);
+    return all_same;
+}
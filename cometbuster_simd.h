@@ -0,0 +1,81 @@
+#ifndef COMETBUSTER_SIMD_H
+#define COMETBUSTER_SIMD_H
+
+#include <stdbool.h>
+#include "cometbuster.h"
+
+// ============================================================
+// RUNTIME-DISPATCHED SIMD KERNELS
+// ============================================================
+// The release binaries are built for the baseline ISA of each
+// platform (x86-64 = SSE2, Android arm64 = NEON). The hot inner
+// loops below are compiled once per vector width and simd_init()
+// picks the widest one the CPU supports, so one binary uses
+// AVX2/AVX-512 where available without dropping older machines.
+//
+//   x86-64:  SSE2 (baseline) -> AVX2 -> AVX-512F
+//   arm64:   NEON (baseline)
+//   other:   scalar
+//
+// Call the kernels through the simd_kernels table. It starts out
+// pointing at the baseline versions, so calling a kernel before
+// simd_init() is safe - just not as fast.
+//
+// The simulation kernels produce the same result as the scalar loop
+// they replace (same operations in the same order per element), so
+// the game stays bit-identical whichever level is selected. The trig
+// kernels only feed vertex generation and work in float, so they
+// agree with the scalar path to the fm_sincos_batch error bound.
+// ============================================================
+
+typedef enum {
+    SIMD_LEVEL_SCALAR = 0,
+    SIMD_LEVEL_SSE2,
+    SIMD_LEVEL_AVX2,
+    SIMD_LEVEL_AVX512,
+    SIMD_LEVEL_NEON
+} SimdLevel;
+
+typedef struct {
+    // Boss bullet pool (structure of arrays):
+    // x += vx*dt, y += vy*dt, life -= dt
+    void (*soa_integrate)(double *x, double *y, const double *vx, const double *vy,
+                          double *life, int n, double dt);
+
+    // First index >= start whose point lies strictly inside the circle
+    // (cx, cy, sqrt(r2)) and whose lifetime is > 0, or -1
+    int (*soa_first_within)(const double *x, const double *y, const double *life,
+                            int n, double cx, double cy, double r2, int start);
+
+    // Particle motion: lifetime -= dt, then live particles move and
+    // fall with 'gravity' px/s^2
+    void (*particles_integrate)(Particle *particles, int n, double dt, double gravity);
+
+    // Comet motion: position by velocity, rotation by rotation speed
+    // (wrapping and gravity wells stay in the caller)
+    void (*comets_advance)(Comet *comets, int n, double dt);
+
+    // Vertex generation - see fm_sincos_batch/fm_circle_points
+    void (*sincos_batch)(const float *angles, float *s, float *c, int n);
+    void (*circle_points)(float cx, float cy, float radius, int segments, float *xy);
+} SimdKernels;
+
+extern SimdKernels simd_kernels;
+
+// Detect CPU features and point simd_kernels at the best variants.
+// Safe to call more than once; the game init calls it.
+void simd_init(void);
+
+SimdLevel simd_level(void);
+const char *simd_level_name(SimdLevel level);
+
+// Force a level (clamped to what the CPU supports). Used for A/B timing
+// and to check that every variant gives the same result.
+void simd_force_level(SimdLevel level);
+
+// Run every supported level against the scalar kernels and log timings
+// and whether the results match. False on any mismatch. Debug builds
+// run it once at startup.
+bool simd_self_check(void);
+
+#endif // COMETBUSTER_SIMD_H
@@ -4,6 +4,7 @@
 #include <string.h>
 #include <time.h>
 #include "cometbuster.h"
+#include "cometbuster_fastmath.h"
 #include "visualization.h"
 #ifdef ANDROID
 #include <SDL.h>
@@ -416,29 +417,91 @@ void comet_buster_spawn_spread_fire(CometBusterGame *game, void *vis) {
     game->muzzle_flash_timer = 0.12;
 }
 
+// ============================================================
+// COSMETIC PARTICLES
+// ============================================================
+// Explosion debris never affects gameplay, so when the renderer can
+// simulate particles itself (transform feedback) the emitters below
+// write ParticleSpawn records instead of filling particles[]. Only the
+// MAX_PARTICLES cap differs between the two, and particles draw from
+// comet_buster_cosmetic_rand(), so the game plays out the same either way.
+
+static SDL_atomic_t gpu_particles_enabled;
+static SDL_atomic_t particle_epochs;        // Never repeats, even across resets
+
+void comet_buster_set_gpu_particles(bool enabled) {
+    SDL_AtomicSet(&gpu_particles_enabled, enabled ? 1 : 0);
+}
+
+bool comet_buster_gpu_particles_enabled(void) {
+    return SDL_AtomicGet(&gpu_particles_enabled) != 0;
+}
+
+int comet_buster_cosmetic_rand(CometBusterGame *game) {
+    // Same LCG and range as most C libraries' rand()
+    game->cosmetic_seed = game->cosmetic_seed * 1103515245u + 12345u;
+    return (int)((game->cosmetic_seed >> 16) & 0x7fff);
+}
+
+void comet_buster_clear_particles(CometBusterGame *game) {
+    if (!game) return;
+    game->particle_count = 0;
+    game->particle_spawn_seq = 0;
+    game->particle_epoch = (unsigned int)SDL_AtomicAdd(&particle_epochs, 1) + 1;
+}
+
+static void comet_buster_emit_particle(CometBusterGame *game, const Particle *p, bool gpu) {
+    if (!gpu) {
+        game->particles[game->particle_count] = *p;
+        game->particle_count++;
+        return;
+    }
+
+    // The ring never refuses a record - if the renderer falls more than
+    // MAX_PARTICLE_SPAWNS behind it skips the oldest ones
+    ParticleSpawn *s = &game->particle_spawns[game->particle_spawn_seq % MAX_PARTICLE_SPAWNS];
+    s->x = (float)p->x;
+    s->y = (float)p->y;
+    s->vx = (float)p->vx;
+    s->vy = (float)p->vy;
+    s->lifetime = (float)p->lifetime;
+    s->size = (float)p->size;
+    s->color[0] = (float)p->color[0];
+    s->color[1] = (float)p->color[1];
+    s->color[2] = (float)p->color[2];
+    game->particle_spawn_seq++;
+}
+
 void comet_buster_spawn_explosion(CometBusterGame *game, double x, double y,
                                    int frequency_band, int particle_count) {
+    bool gpu = comet_buster_gpu_particles_enabled();
+    
+    // Always the full count - the quality governor thins debris where it
+    // is drawn (drawlist_keep_particle), so a replay plays out the same
+    // at any quality level
     for (int i = 0; i < particle_count; i++) {
-        if (game->particle_count >= MAX_PARTICLES) {
+        if (!gpu && game->particle_count >= MAX_PARTICLES) {
             break;
         }
         
-        int slot = game->particle_count;
-        Particle *p = &game->particles[slot];
+        Particle particle;
+        Particle *p = &particle;
         
         memset(p, 0, sizeof(Particle));
         
         double angle = (2.0 * M_PI * i) / particle_count + 
-                       ((rand() % 100) / 100.0) * 0.3;
-        double speed = 100.0 + (rand() % 100);
+                       ((comet_buster_cosmetic_rand(game) % 100) / 100.0) * 0.3;
+        double speed = 100.0 + (comet_buster_cosmetic_rand(game) % 100);
         
         p->x = x;
         p->y = y;
-        p->vx = cos(angle) * speed;
-        p->vy = sin(angle) * speed;
-        p->lifetime = 0.3 + (rand() % 20) / 100.0;
+        double dir_s, dir_c;
+        fm_sincos(angle, &dir_s, &dir_c);
+        p->vx = dir_c * speed;
+        p->vy = dir_s * speed;
+        p->lifetime = 0.3 + (comet_buster_cosmetic_rand(game) % 20) / 100.0;
         p->max_lifetime = p->lifetime;
-        p->size = 2.0 + (rand() % 4);
+        p->size = 2.0 + (comet_buster_cosmetic_rand(game) % 4);
         p->active = true;
         
         comet_buster_get_frequency_color(frequency_band,
@@ -446,7 +509,7 @@ void comet_buster_spawn_explosion(CometBusterGame *game, double x, double y,
                                         &p->color[1],
                                         &p->color[2]);
         
-        game->particle_count++;
+        comet_buster_emit_particle(game, p, gpu);
     }
 }
 
@@ -454,25 +517,29 @@ void comet_buster_spawn_explosion(CometBusterGame *game, double x, double y,
 void comet_buster_spawn_ship_death_explosion(CometBusterGame *game, double x, double y) {
     if (!game) return;
     
+    bool gpu = comet_buster_gpu_particles_enabled();
+    
     // Spawn purple/blue explosion particles
     // Core burst - 100 particles
     for (int burst = 0; burst < 100; burst++) {
-        if (game->particle_count >= MAX_PARTICLES - 50) break;
+        if (!gpu && game->particle_count >= MAX_PARTICLES - 50) break;
         
-        int slot = game->particle_count;
-        Particle *p = &game->particles[slot];
+        Particle particle;
+        Particle *p = &particle;
         memset(p, 0, sizeof(Particle));
         
-        double angle = (2.0 * M_PI * burst) / 100.0 + ((rand() % 100) / 100.0) * 0.3;
-        double speed = 120.0 + (rand() % 100);  // 120-220 px/sec
+        double angle = (2.0 * M_PI * burst) / 100.0 + ((comet_buster_cosmetic_rand(game) % 100) / 100.0) * 0.3;
+        double speed = 120.0 + (comet_buster_cosmetic_rand(game) % 100);  // 120-220 px/sec
         
         p->x = x;
         p->y = y;
-        p->vx = cos(angle) * speed;
-        p->vy = sin(angle) * speed;
-        p->lifetime = 0.8 + (rand() % 20) / 100.0;  // 0.8-1.0 seconds
+        double dir_s, dir_c;
+        fm_sincos(angle, &dir_s, &dir_c);
+        p->vx = dir_c * speed;
+        p->vy = dir_s * speed;
+        p->lifetime = 0.8 + (comet_buster_cosmetic_rand(game) % 20) / 100.0;  // 0.8-1.0 seconds
         p->max_lifetime = p->lifetime;
-        p->size = 4.0 + (rand() % 5);  // 4-9 pixels
+        p->size = 4.0 + (comet_buster_cosmetic_rand(game) % 5);  // 4-9 pixels
         p->active = true;
         
         // Purple/blue core
@@ -480,27 +547,29 @@ void comet_buster_spawn_ship_death_explosion(CometBusterGame *game, double x, do
         p->color[1] = 0.3;
         p->color[2] = 1.0;
         
-        game->particle_count++;
+        comet_buster_emit_particle(game, p, gpu);
     }
     
     // Trailing debris - 70 particles
     for (int burst = 0; burst < 70; burst++) {
-        if (game->particle_count >= MAX_PARTICLES - 30) break;
+        if (!gpu && game->particle_count >= MAX_PARTICLES - 30) break;
         
-        int slot = game->particle_count;
-        Particle *p = &game->particles[slot];
+        Particle particle;
+        Particle *p = &particle;
         memset(p, 0, sizeof(Particle));
         
-        double angle = (2.0 * M_PI * burst) / 70.0 + ((rand() % 100) / 100.0) * 0.5;
-        double speed = 80.0 + (rand() % 60);  // 80-140 px/sec
+        double angle = (2.0 * M_PI * burst) / 70.0 + ((comet_buster_cosmetic_rand(game) % 100) / 100.0) * 0.5;
+        double speed = 80.0 + (comet_buster_cosmetic_rand(game) % 60);  // 80-140 px/sec
         
         p->x = x;
         p->y = y;
-        p->vx = cos(angle) * speed;
-        p->vy = sin(angle) * speed;
-        p->lifetime = 1.0 + (rand() % 20) / 100.0;  // 1.0-1.2 seconds
+        double dir_s, dir_c;
+        fm_sincos(angle, &dir_s, &dir_c);
+        p->vx = dir_c * speed;
+        p->vy = dir_s * speed;
+        p->lifetime = 1.0 + (comet_buster_cosmetic_rand(game) % 20) / 100.0;  // 1.0-1.2 seconds
         p->max_lifetime = p->lifetime;
-        p->size = 3.0 + (rand() % 4);  // 3-7 pixels
+        p->size = 3.0 + (comet_buster_cosmetic_rand(game) % 4);  // 3-7 pixels
         p->active = true;
         
         // Light blue trailing smoke
@@ -508,7 +577,7 @@ void comet_buster_spawn_ship_death_explosion(CometBusterGame *game, double x, do
         p->color[1] = 0.6;
         p->color[2] = 1.0;
         
-        game->particle_count++;
+        comet_buster_emit_particle(game, p, gpu);
     }
     
     // Apply explosion damage in radius - up to 20 damage based on distance
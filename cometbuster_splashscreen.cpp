@@ -318,7 +318,7 @@ void comet_buster_exit_splash_screen(CometBusterGame *game) {
     // Clear all objects to start fresh game
     game->comet_count = 0;
     game->bullet_count = 0;
-    game->particle_count = 0;
+    comet_buster_clear_particles(game);
     game->floating_text_count = 0;
     game->canister_count = 0;
     game->missile_count = 0;
@@ -326,6 +326,7 @@ void comet_buster_exit_splash_screen(CometBusterGame *game) {
     // NOTE: high_score_count is NOT reset - high scores persist from disk load
     game->enemy_ship_count = 0;
     game->enemy_bullet_count = 0;
+    boss_bullet_pool_clear(&game->boss_bullets);
     
     game->boss_active = false;
     game->boss.active = false;
@@ -426,8 +426,8 @@ static void star_vortex_shoot_asteroids(CometBusterGame *game) {
             double spawn_x = boss->x + cos(star_point_angle) * 50.0;
             double spawn_y = boss->y + sin(star_point_angle) * 50.0;
             
-            // Spawn as enemy bullet with boss as owner
-            comet_buster_spawn_enemy_bullet_from_ship(game, spawn_x, spawn_y, vx, vy, -3);
+            // Spawn as boss bullet with boss as owner
+            boss_bullet_spawn(&game->boss_bullets, spawn_x, spawn_y, vx, vy, -3);
             targets_shot++;
         }
     }
@@ -541,11 +541,6 @@ void star_vortex_final_explosion(CometBusterGame *game) {
     }
     
     // Fire 8 bullets in all directions (45 degree intervals, offset by 22.5 degrees)
-    for (int i = 0; i < 8; i++) {
-        double angle = (i * 2.0 * M_PI / 8.0) + (M_PI / 8.0);  // Offset 22.5 degrees
-        double vx = cos(angle) * bullet_speed;
-        double vy = sin(angle) * bullet_speed;
-        
-        comet_buster_spawn_enemy_bullet(game, explosion_x, explosion_y, vx, vy);
-    }
+    BulletPattern ring = {PATTERN_RING, 8, bullet_speed, 0.0, 0.0, 0.0};
+    bullet_pattern_emit(&game->boss_bullets, &ring, explosion_x, explosion_y, M_PI / 8.0, -1);
 }
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stddef.h>
 #include <time.h>
 #include "cometbuster.h"
 #include "visualization.h"
@@ -41,6 +42,23 @@ void comet_buster_get_frequency_color(int frequency_band, double *r, double *g,
     }
 }
 
+#ifdef SIM_FLOAT32
+void comet_buster_wrap_position(sim_real *x, sim_real *y, int width, int height) {
+    if (*x < -50) *x = width + 50;
+    if (*x > width + 50) *x = -50;
+    if (*y < -50) *y = height + 50;
+    if (*y > height + 50) *y = -50;
+}
+
+void comet_buster_get_frequency_color(int frequency_band, sim_real *r, sim_real *g, sim_real *b) {
+    double dr = *r, dg = *g, db = *b;
+    comet_buster_get_frequency_color(frequency_band, &dr, &dg, &db);
+    *r = (sim_real)dr;
+    *g = (sim_real)dg;
+    *b = (sim_real)db;
+}
+#endif
+
 // ============================================================================
 // AUDIO INTEGRATION (Stubs)
 // ============================================================================
@@ -67,3 +85,53 @@ void comet_buster_increase_difficulty(CometBusterGame *game) {
     game->base_spawn_rate *= 0.9;
     if (game->base_spawn_rate < 0.3) game->base_spawn_rate = 0.3;
 }
+
+// ============================================================================
+// STATE SIZE REPORT
+// ============================================================================
+
+typedef struct {
+    const char *name;
+    size_t offset;
+    size_t size;
+} StateFieldSize;
+
+#define SIM_FIELD(field) { #field, offsetof(SimState, field), sizeof(((SimState *)0)->field) }
+#define COLD_FIELD(field) { #field, 0, sizeof(((CometBusterGame *)0)->field) }
+
+void comet_buster_log_state_sizes(void) {
+    // Entity arrays and other large members, in declaration order
+    static const StateFieldSize hot[] = {
+        SIM_FIELD(comets), SIM_FIELD(bullets), SIM_FIELD(particles), SIM_FIELD(particle_spawns),
+        SIM_FIELD(floating_texts), SIM_FIELD(canisters), SIM_FIELD(missiles),
+        SIM_FIELD(missile_pickups), SIM_FIELD(bombs), SIM_FIELD(bomb_pickups),
+        SIM_FIELD(enemy_ships), SIM_FIELD(enemy_bullets), SIM_FIELD(boss_bullets),
+        SIM_FIELD(ufos), SIM_FIELD(boss), SIM_FIELD(spawn_queen), SIM_FIELD(keyboard)
+    };
+    static const StateFieldSize cold[] = {
+        COLD_FIELD(high_scores), COLD_FIELD(boss_explosion_effect), COLD_FIELD(haptic_manager)
+    };
+    const int hot_count = (int)(sizeof(hot) / sizeof(hot[0]));
+    const int cold_count = (int)(sizeof(cold) / sizeof(cold[0]));
+
+    size_t listed = 0;
+    SDL_Log("[Comet Busters] [STATE] SimState: %zu bytes\n", sizeof(SimState));
+    for (int i = 0; i < hot_count; i++) {
+        SDL_Log("[Comet Busters] [STATE]   %-22s %8zu  (@%zu)\n", hot[i].name, hot[i].size, hot[i].offset);
+        listed += hot[i].size;
+    }
+    SDL_Log("[Comet Busters] [STATE]   %-22s %8zu  (ship, counters, timers, input, padding)\n",
+            "scalars", sizeof(SimState) - listed);
+
+    listed = 0;
+    size_t cold_size = sizeof(CometBusterGame) - sizeof(SimState);
+    SDL_Log("[Comet Busters] [STATE] Cold: %zu bytes\n", cold_size);
+    for (int i = 0; i < cold_count; i++) {
+        SDL_Log("[Comet Busters] [STATE]   %-22s %8zu\n", cold[i].name, cold[i].size);
+        listed += cold[i].size;
+    }
+    SDL_Log("[Comet Busters] [STATE]   %-22s %8zu  (finale, language, padding)\n", "scalars", cold_size - listed);
+
+    SDL_Log("[Comet Busters] [STATE] CometBusterGame: %zu bytes, Visualizer: %zu bytes\n",
+            sizeof(CometBusterGame), sizeof(Visualizer));
+}
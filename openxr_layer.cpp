@@ -107,13 +107,17 @@ int openxr_init(OpenXRContext *ctx) {
     swapchain_info.width = 1920;   // Per eye
     swapchain_info.height = 1080;
     swapchain_info.faceCount = 1;
-    swapchain_info.arraySize = 1;
     swapchain_info.mipCount = 1;
     
+    // One image holds both eyes as layers. With multiview they are drawn
+    // in a single pass; otherwise one after the other, a layer each
+    ctx->multiview = GLEW_OVR_multiview2 != 0;
+    swapchain_info.arraySize = 2;
+    
     CHECK_XR(xrCreateSwapchain(ctx->session, &swapchain_info, &ctx->swapchain));
     ctx->swapchain_width = 1920;
     ctx->swapchain_height = 1080;
-    fprintf(stderr, "[XR] Swapchain created\n");
+    fprintf(stderr, "[XR] Swapchain created (2 layers, %s)\n", ctx->multiview ? "multiview" : "one pass per eye");
     
     // Get swapchain images
     CHECK_XR(xrEnumerateSwapchainImages(ctx->swapchain, 0, &ctx->swapchain_length, NULL));
@@ -122,6 +126,7 @@ int openxr_init(OpenXRContext *ctx) {
         (XrSwapchainImageOpenGLKHR*)malloc(ctx->swapchain_length * sizeof(XrSwapchainImageOpenGLKHR));
     ctx->swapchain_textures = (GLuint*)malloc(ctx->swapchain_length * sizeof(GLuint));
     ctx->swapchain_fbos = (GLuint*)malloc(ctx->swapchain_length * sizeof(GLuint));
+    ctx->swapchain_eye_fbos = (GLuint*)malloc(ctx->swapchain_length * 2 * sizeof(GLuint));
     
     for (uint32_t i = 0; i < ctx->swapchain_length; i++) {
         memset(&gl_images[i], 0, sizeof(XrSwapchainImageOpenGLKHR));
@@ -138,14 +143,36 @@ int openxr_init(OpenXRContext *ctx) {
         
         glGenFramebuffers(1, &ctx->swapchain_fbos[i]);
         glBindFramebuffer(GL_FRAMEBUFFER, ctx->swapchain_fbos[i]);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 
-                              GL_TEXTURE_2D, ctx->swapchain_textures[i], 0);
+        if (ctx->multiview) {
+            glFramebufferTextureMultiviewOVR(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                             ctx->swapchain_textures[i], 0, 0, 2);
+        } else {
+            glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                      ctx->swapchain_textures[i], 0, 0);
+        }
         
         GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
         if (status != GL_FRAMEBUFFER_COMPLETE) {
             fprintf(stderr, "[XR] FBO error: %x\n", status);
             return -1;
         }
+        
+        // One layer per eye, for when the multiview shaders are not
+        // available. gl_multiview_self_test() draws through the same
+        // per-layer attachments (--multiview-test); no headset has
+        // exercised this path.
+        for (int eye = 0; eye < 2; eye++) {
+            GLuint *eye_fbo = &ctx->swapchain_eye_fbos[i * 2 + eye];
+            glGenFramebuffers(1, eye_fbo);
+            glBindFramebuffer(GL_FRAMEBUFFER, *eye_fbo);
+            glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                                      ctx->swapchain_textures[i], 0, eye);
+            status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+            if (status != GL_FRAMEBUFFER_COMPLETE) {
+                fprintf(stderr, "[XR] Eye FBO error: %x\n", status);
+                return -1;
+            }
+        }
     }
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     
@@ -300,6 +327,7 @@ void openxr_shutdown(OpenXRContext *ctx) {
     
     if (ctx->swapchain_textures) free(ctx->swapchain_textures);
     if (ctx->swapchain_fbos) free(ctx->swapchain_fbos);
+    if (ctx->swapchain_eye_fbos) free(ctx->swapchain_eye_fbos);
     
     memset(ctx, 0, sizeof(OpenXRContext));
     fprintf(stderr, "[XR] Shutdown complete\n");
@@ -31,9 +31,11 @@ typedef struct {
     XrSwapchain swapchain;
     uint32_t swapchain_length;
     GLuint *swapchain_textures;
-    GLuint *swapchain_fbos;
+    GLuint *swapchain_fbos;     // Both layers when multiview, else layer 0
+    GLuint *swapchain_eye_fbos; // [image * 2 + eye] - one layer each
     int swapchain_width;
     int swapchain_height;
+    bool multiview;             // Both eyes in one pass (OVR_multiview2)
     
     XrFrameState frame_state;
     XrViewState view_state;
@@ -290,6 +290,8 @@ void update_comet_buster(Visualizer *vis_ptr, double dt);
 void update_touch_input(Visualizer *vis, CometBusterGame *game, double dt);
 #ifdef CAIROBUILD
 void draw_comet_buster(Visualizer *vis_ptr, cairo_t *cr);
+// Frees the cached background surface; call before the window goes away
+void draw_comet_buster_cleanup(void);
 #endif
 void comet_buster_cleanup(CometBusterGame *game);
 void comet_buster_on_ship_hit(CometBusterGame *game, Visualizer *visualizer);
@@ -309,5 +311,34 @@ bool comet_buster_check_ship_bomb_pickup(CometBusterGame *game, BombPickup *p, V
 
 void draw_comet_buster_gl(Visualizer *visualizer, void *gl_context);
 
+// Draw a frame from a list built by drawlist_build_game() (see
+// cometbuster_drawlist.h) - for front-ends that draw one frame to
+// several views
+typedef struct DrawList DrawList;
+void draw_comet_buster_gl_list(Visualizer *visualizer, const DrawList *list);
+
+// The GL renderer batches a whole frame into one upload. Front-ends call
+// gl_end_frame() after the last draw of a frame (before swapping), and
+// gl_flush_batches() before switching render target mid-frame.
+void gl_flush_batches(void);
+void gl_end_frame(void);
+
+// Explosion particles on the GPU (transform feedback) - see
+// cometbuster_render_gl.h
+void gl_set_gpu_particles_allowed(bool allowed);
+void gl_set_gpu_particles_active(bool active);
+bool gl_gpu_particles_self_test(void);
+
+// Debug overlay (F3) - see cometbuster_render_gl.h
+void gl_set_debug_overlay(const char *pacing, const char *quality);
+void gl_draw_debug_overlay(int width, int height);
+
+// Single-pass stereo for the OpenXR front-end - see cometbuster_render_gl.h
+bool gl_multiview_supported(void);
+bool gl_begin_multiview(unsigned int fbo);     // GLuint
+void gl_end_multiview(void);
+void gl_set_view_transforms(const float *views, int count);
+bool gl_multiview_self_test(void);
+
 
 #endif